@@ -30,11 +30,21 @@
  * MEMORIES
  */
 
+// Must match SafetyIslandCfg.NumBanks and SafetyIslandCfg.BankNumBytes. The bank count is passed
+// from SAFED_NUM_BANKS by the test Makefiles, like NumBanks to the testbench.
+#ifndef ARCHI_SAFETY_ISLAND_NB_BANKS
+#define ARCHI_SAFETY_ISLAND_NB_BANKS 2
+#endif
+#define ARCHI_SAFETY_ISLAND_BANK_SIZE 0x00010000
+
+#define ARCHI_LOCAL_BANK_ADDR(bank) ( ARCHI_LOCAL_PRIV0_ADDR + (bank) * ARCHI_SAFETY_ISLAND_BANK_SIZE )
+
 #define ARCHI_LOCAL_PRIV0_ADDR  ( ARCHI_SAFETY_ISLAND_BASE_ADDR + ARCHI_SAFETY_ISLAND_MEM_OFFSET )
-#define ARCHI_LOCAL_PRIV0_SIZE  0x00010000
+#define ARCHI_LOCAL_PRIV0_SIZE  ARCHI_SAFETY_ISLAND_BANK_SIZE
 
+// PRIV1 spans all remaining banks
 #define ARCHI_LOCAL_PRIV1_ADDR  ( ARCHI_LOCAL_PRIV0_ADDR + ARCHI_LOCAL_PRIV0_SIZE )
-#define ARCHI_LOCAL_PRIV1_SIZE  0x00010000
+#define ARCHI_LOCAL_PRIV1_SIZE  ( (ARCHI_SAFETY_ISLAND_NB_BANKS - 1) * ARCHI_SAFETY_ISLAND_BANK_SIZE )
 
 // L2 alias
 #define ARCHI_L2_PRIV0_ADDR  ARCHI_LOCAL_PRIV0_ADDR
@@ -57,16 +67,54 @@
 #define ARCHI_BOOT_ROM_OFFSET       0x00001000
 #define ARCHI_GLOBAL_PREPEND_OFFSET 0x00002000
 #define ARCHI_DEBUG_OFFSET          0x00003000
+#define ARCHI_ECC_MGR_OFFSET        0x00004000
 #define ARCHI_CLIC_OFFSET           0x00010000
 #define ARCHI_HMR_OFFSET            0x00005000
 #define ARCHI_STDOUT_OFFSET     0x00006000
+#define ARCHI_ICACHE_OFFSET         0x00007000
+#define ARCHI_TIMER_OFFSET          0x00008000
+#define ARCHI_PERF_MON_OFFSET       0x00021000
+#define ARCHI_TCLS_RESYNC_OFFSET    0x00022000
+#define ARCHI_SPLIT_CTRL_OFFSET     0x00023000
+#define ARCHI_IRQ_TIMESTAMP_OFFSET  0x00024000
+#define ARCHI_TRACE_OFFSET          0x00025000
+#define ARCHI_SPLIT_ERR_OFFSET      0x00026000
+#define ARCHI_SENSOR_DMA_OFFSET     0x00030000
+#define ARCHI_STORE_MERGE_OFFSET    0x00031000
+#define ARCHI_MAILBOX_OFFSET        0x00032000
+#define ARCHI_XBAR_QOS_OFFSET       0x00034000
+#define ARCHI_BANK_INIT_OFFSET      0x00035000
+#define ARCHI_SCRUB_CTRL_OFFSET     0x00036000
+#define ARCHI_ECC_LOG_OFFSET        0x00037000
+#define ARCHI_SCHED_TABLE_OFFSET    0x00038000
 
 #define ARCHI_SOC_CTRL_ADDR         ( ARCHI_SAFETY_ISLAND_PERIPHERALS_ADDR + ARCHI_SOC_CTRL_OFFSET )
 #define ARCHI_BOOT_ROM_ADDR         ( ARCHI_SAFETY_ISLAND_PERIPHERALS_ADDR + ARCHI_BOOT_ROM_OFFSET )
 #define ARCHI_GLOBAL_PREPEND_ADDR   ( ARCHI_SAFETY_ISLAND_PERIPHERALS_ADDR + ARCHI_GLOBAL_PREPEND_OFFSET )
 #define ARCHI_DEBUG_ADDR            ( ARCHI_SAFETY_ISLAND_PERIPHERALS_ADDR + ARCHI_DEBUG_OFFSET )
+#define ARCHI_ECC_MGR_ADDR          ( ARCHI_SAFETY_ISLAND_PERIPHERALS_ADDR + ARCHI_ECC_MGR_OFFSET )
 #define ARCHI_CLIC_ADDR             ( ARCHI_SAFETY_ISLAND_PERIPHERALS_ADDR + ARCHI_CLIC_OFFSET )
 #define ARCHI_HMR_ADDR              ( ARCHI_SAFETY_ISLAND_PERIPHERALS_ADDR + ARCHI_HMR_OFFSET )
 #define ARCHI_STDOUT_ADDR           ( ARCHI_SAFETY_ISLAND_PERIPHERALS_ADDR + ARCHI_STDOUT_OFFSET )
+#define ARCHI_ICACHE_ADDR           ( ARCHI_SAFETY_ISLAND_PERIPHERALS_ADDR + ARCHI_ICACHE_OFFSET )
+#define ARCHI_TIMER_ADDR            ( ARCHI_SAFETY_ISLAND_PERIPHERALS_ADDR + ARCHI_TIMER_OFFSET )
+#define ARCHI_PERF_MON_ADDR         ( ARCHI_SAFETY_ISLAND_PERIPHERALS_ADDR + ARCHI_PERF_MON_OFFSET )
+#define ARCHI_TCLS_RESYNC_ADDR      ( ARCHI_SAFETY_ISLAND_PERIPHERALS_ADDR + ARCHI_TCLS_RESYNC_OFFSET )
+#define ARCHI_SPLIT_CTRL_ADDR       ( ARCHI_SAFETY_ISLAND_PERIPHERALS_ADDR + ARCHI_SPLIT_CTRL_OFFSET )
+#define ARCHI_IRQ_TIMESTAMP_ADDR    ( ARCHI_SAFETY_ISLAND_PERIPHERALS_ADDR + ARCHI_IRQ_TIMESTAMP_OFFSET )
+#define ARCHI_TRACE_ADDR            ( ARCHI_SAFETY_ISLAND_PERIPHERALS_ADDR + ARCHI_TRACE_OFFSET )
+#define ARCHI_SPLIT_ERR_ADDR        ( ARCHI_SAFETY_ISLAND_PERIPHERALS_ADDR + ARCHI_SPLIT_ERR_OFFSET )
+#define ARCHI_SENSOR_DMA_ADDR       ( ARCHI_SAFETY_ISLAND_PERIPHERALS_ADDR + ARCHI_SENSOR_DMA_OFFSET )
+#define ARCHI_STORE_MERGE_ADDR      ( ARCHI_SAFETY_ISLAND_PERIPHERALS_ADDR + ARCHI_STORE_MERGE_OFFSET )
+#define ARCHI_MAILBOX_ADDR          ( ARCHI_SAFETY_ISLAND_PERIPHERALS_ADDR + ARCHI_MAILBOX_OFFSET )
+#define ARCHI_XBAR_QOS_ADDR         ( ARCHI_SAFETY_ISLAND_PERIPHERALS_ADDR + ARCHI_XBAR_QOS_OFFSET )
+#define ARCHI_BANK_INIT_ADDR        ( ARCHI_SAFETY_ISLAND_PERIPHERALS_ADDR + ARCHI_BANK_INIT_OFFSET )
+#define ARCHI_SCRUB_CTRL_ADDR       ( ARCHI_SAFETY_ISLAND_PERIPHERALS_ADDR + ARCHI_SCRUB_CTRL_OFFSET )
+#define ARCHI_ECC_LOG_ADDR          ( ARCHI_SAFETY_ISLAND_PERIPHERALS_ADDR + ARCHI_ECC_LOG_OFFSET )
+#define ARCHI_SCHED_TABLE_ADDR      ( ARCHI_SAFETY_ISLAND_PERIPHERALS_ADDR + ARCHI_SCHED_TABLE_OFFSET )
+
+// One ECC manager register window per memory bank
+#define ARCHI_ECC_MGR_BANK_SIZE     0x00000020
+#define ARCHI_ECC_MGR_BANK_ADDR(bank) ( ARCHI_ECC_MGR_ADDR + (bank) * ARCHI_ECC_MGR_BANK_SIZE )
 
 #endif
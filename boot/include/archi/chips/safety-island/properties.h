@@ -38,22 +38,7 @@
 #define ARCHI_HAS_L2_MULTI             1
 // #define ARCHI_HAS_L1                   1
 
-#define ARCHI_LOCAL_PRIV0_ADDR  ( ARCHI_SAFETY_ISLAND_BASE_ADDR + ARCHI_SAFETY_ISLAND_MEM_OFFSET )
-#define ARCHI_LOCAL_PRIV0_SIZE  0x00010000
-
-#define ARCHI_LOCAL_PRIV1_ADDR  ( ARCHI_LOCAL_PRIV0_ADDR + ARCHI_LOCAL_PRIV0_SIZE )
-#define ARCHI_LOCAL_PRIV1_SIZE  0x00010000
-
-// L2 alias
-#define ARCHI_L2_PRIV0_ADDR  ARCHI_LOCAL_PRIV0_ADDR
-#define ARCHI_L2_PRIV0_SIZE  ARCHI_LOCAL_PRIV0_SIZE
-
-#define ARCHI_L2_PRIV1_ADDR  ARCHI_LOCAL_PRIV1_ADDR
-#define ARCHI_L2_PRIV1_SIZE  ARCHI_LOCAL_PRIV1_SIZE
-
-// Shared L2
-#define ARCHI_L2_SHARED_ADDR 0
-#define ARCHI_L2_SHARED_SIZE 0
+// The bank layout and the local memory regions are in memory_map.h
 
 /*
  * MEMORY ALIAS
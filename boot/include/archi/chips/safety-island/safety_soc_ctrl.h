@@ -33,6 +33,15 @@ extern "C" {
 #define SAFETY_SOC_CTRL_BOOTMODE_BOOTMODE_FIELD \
   ((bitfield_field32_t) { .mask = SAFETY_SOC_CTRL_BOOTMODE_BOOTMODE_MASK, .index = SAFETY_SOC_CTRL_BOOTMODE_BOOTMODE_OFFSET })
 
+// Interrupt lines to the host
+#define SAFETY_SOC_CTRL_HOSTIRQ_REG_OFFSET 0x10
+
+// Raise interrupt lines to the host
+#define SAFETY_SOC_CTRL_HOSTIRQ_SET_REG_OFFSET 0x14
+
+// Lower interrupt lines to the host
+#define SAFETY_SOC_CTRL_HOSTIRQ_CLR_REG_OFFSET 0x18
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
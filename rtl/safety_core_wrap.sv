@@ -12,6 +12,7 @@ module safety_core_wrap import safety_island_pkg::*; #(
   parameter safety_island_cfg_t SafetyIslandCfg = safety_island_pkg::SafetyIslandDefaultConfig,
   parameter bit [         31:0] PeriphBaseAddr  = 32'h0020_0000,
   parameter int unsigned        NumBusErrBits   = 2,
+  parameter int unsigned        NumManagers     = 7,
   parameter type                reg_req_t       = logic,
   parameter type                reg_rsp_t       = logic
 ) (
@@ -21,7 +22,24 @@ module safety_core_wrap import safety_island_pkg::*; #(
   input  logic test_enable_i,
 
   input logic [SafetyIslandCfg.NumInterrupts-1:0] irqs_i,
-  input logic [NumTimerInterrupts-1:0] timer_irqs_i,
+  input logic [2*SafetyIslandCfg.NumTimers-1:0] timer_irqs_i,
+  input logic [NumPeriphInterrupts-1:0] periph_irqs_i,
+
+  // Errors of posted writes on the AXI output
+  input  logic        posted_err_valid_i,
+  input  logic [31:0] posted_err_addr_i,
+  input  logic [1:0]  posted_err_i,
+  output logic        posted_err_ready_o,
+
+  // Island events for the performance monitor
+  input  logic [NumManagers-1:0]              perf_mgr_req_i,
+  input  logic [NumManagers-1:0]              perf_mgr_gnt_i,
+  input  logic [SafetyIslandCfg.NumBanks-1:0] perf_bank_conflict_i,
+  input  logic [SafetyIslandCfg.NumBanks-1:0] perf_ecc_corr_i,
+  input  logic        perf_axi_out_req_i,
+  input  logic        perf_axi_out_gnt_i,
+  input  logic        perf_axi_out_we_i,
+  input  logic        perf_axi_out_rvalid_i,
 
   // Core-local peripherals
   input  reg_req_t    cl_periph_req_i,
@@ -61,6 +79,35 @@ module safety_core_wrap import safety_island_pkg::*; #(
   input  logic [31:0] shadow_rdata_i,
   input  logic [NumBusErrBits-1:0] shadow_err_i,
 
+  // Instruction and data interfaces of harts 1 and 2 in split mode
+  output logic [NumSplitHarts-1:0]       split_instr_req_o,
+  input  logic [NumSplitHarts-1:0]       split_instr_gnt_i,
+  input  logic [NumSplitHarts-1:0]       split_instr_rvalid_i,
+  output logic [NumSplitHarts-1:0][31:0] split_instr_addr_o,
+  input  logic [NumSplitHarts-1:0][31:0] split_instr_rdata_i,
+  input  logic [NumSplitHarts-1:0][NumBusErrBits-1:0] split_instr_err_i,
+
+  output logic [NumSplitHarts-1:0]       split_data_req_o,
+  input  logic [NumSplitHarts-1:0]       split_data_gnt_i,
+  input  logic [NumSplitHarts-1:0]       split_data_rvalid_i,
+  output logic [NumSplitHarts-1:0]       split_data_we_o,
+  output logic [NumSplitHarts-1:0][3:0]  split_data_be_o,
+  output logic [NumSplitHarts-1:0][31:0] split_data_addr_o,
+  output logic [NumSplitHarts-1:0][31:0] split_data_wdata_o,
+  output logic [NumSplitHarts-1:0][5:0]  split_data_atop_o,
+  input  logic [NumSplitHarts-1:0][31:0] split_data_rdata_i,
+  input  logic [NumSplitHarts-1:0][NumBusErrBits-1:0] split_data_err_i,
+
+  // Trace buffer write port
+  output logic        trace_req_o,
+  input  logic        trace_gnt_i,
+  input  logic        trace_rvalid_i,
+  output logic [31:0] trace_addr_o,
+  output logic [31:0] trace_wdata_o,
+  input  logic        trace_err_i,
+  // Hold back new fetches while the trace cannot take a packet
+  output logic        trace_stall_o,
+
   // Debug Interface
   input  logic        debug_req_i,
 
@@ -68,9 +115,16 @@ module safety_core_wrap import safety_island_pkg::*; #(
   input  logic        fetch_enable_i
 );
 
-  localparam int unsigned TotalNumInterrupts = SafetyIslandCfg.NumInterrupts + 32;
+  // Timers beyond the first are connected after the input interrupts
+  localparam int unsigned NumExtraTimerIrqs  = 2*(SafetyIslandCfg.NumTimers-1);
+  localparam int unsigned TotalNumInterrupts = SafetyIslandCfg.NumInterrupts + 32 +
+                                               NumExtraTimerIrqs;
+
+  // CLIC, TCLS, 3xBus_err, PerfMon, Resync, SplitCtrl, IrqTimestamp, Trace, SplitErr
+  localparam int unsigned NumCoreLocalPeriphs = 11;
 
-  localparam int unsigned NumCoreLocalPeriphs = 5; // CLIC, TCLS, 3xBus_err
+  // Instruction, data and shadow port of each hart
+  localparam int unsigned NumSplitPorts = 3*(NumSplitHarts+1);
 
   localparam addr_map_rule_t [NumCoreLocalPeriphs-1:0] ClRegbusAddrMapRule = '{
    '{ idx: RegbusOutTCLS,
@@ -87,7 +141,25 @@ module safety_core_wrap import safety_island_pkg::*; #(
       end_addr: PeriphBaseAddr+DataErrOffset+DataErrRange   },
    '{ idx: RegbusOutShadowErr,
       start_addr: PeriphBaseAddr+ShadowErrOffset,
-      end_addr: PeriphBaseAddr+ShadowErrOffset+ShadowErrRange }
+      end_addr: PeriphBaseAddr+ShadowErrOffset+ShadowErrRange },
+   '{ idx: RegbusOutPerfMon,
+      start_addr: PeriphBaseAddr+PerfMonOffset,
+      end_addr: PeriphBaseAddr+PerfMonOffset+PerfMonRange },
+   '{ idx: RegbusOutTclsResync,
+      start_addr: PeriphBaseAddr+TclsResyncOffset,
+      end_addr: PeriphBaseAddr+TclsResyncOffset+TclsResyncRange },
+   '{ idx: RegbusOutSplitCtrl,
+      start_addr: PeriphBaseAddr+SplitCtrlOffset,
+      end_addr: PeriphBaseAddr+SplitCtrlOffset+SplitCtrlRange },
+   '{ idx: RegbusOutIrqTimestamp,
+      start_addr: PeriphBaseAddr+IrqTimestampOffset,
+      end_addr: PeriphBaseAddr+IrqTimestampOffset+IrqTimestampRange },
+   '{ idx: RegbusOutTrace,
+      start_addr: PeriphBaseAddr+TraceOffset,
+      end_addr: PeriphBaseAddr+TraceOffset+TraceRange },
+   '{ idx: RegbusOutSplitErr,
+      start_addr: PeriphBaseAddr+SplitErrOffset,
+      end_addr: PeriphBaseAddr+SplitErrOffset+SplitErrRange }
   };
 
   reg_req_t [NumCoreLocalPeriphs-1:0] cl_periph_req;
@@ -101,8 +173,15 @@ module safety_core_wrap import safety_island_pkg::*; #(
   logic core_irq_valid, core_irq_ready, core_irq_shv;
 
   logic [2:0] bus_err_irq;
+  logic [NumSplitHarts-1:0] split_instr_err_irq, split_data_err_irq;
   logic resynch_irq;
 
+  // Split mode
+  logic                              split_mode, split_setback;
+  logic [NumSplitHarts:0][31:0]      split_boot_addr;
+  logic [NumSplitHarts:0]            split_irqs;
+  logic [NumSplitPorts-1:0]          split_port_req, split_port_gnt, split_port_rvalid;
+
   if (SafetyIslandCfg.UseTCLS) begin : gen_TCLS_core
     localparam int unsigned NumHMRCores = 3;
     localparam int unsigned NumBuses = 2;
@@ -167,21 +246,23 @@ module safety_core_wrap import safety_island_pkg::*; #(
     } hmr_cv32e40p_bus_outputs_t;
 
     hmr_cv32e40p_all_inputs_t                   sys_inputs;
-    hmr_cv32e40p_all_inputs_t [NumHMRCores-1:0] core_inputs;
+    hmr_cv32e40p_all_inputs_t [NumHMRCores-1:0] core_inputs, hmr_core_inputs, split_core_inputs;
 
     hmr_cv32e40p_nominal_outputs_t                   sys_outputs;
-    hmr_cv32e40p_nominal_outputs_t [NumHMRCores-1:0] core_outputs;
+    hmr_cv32e40p_nominal_outputs_t [NumHMRCores-1:0] core_outputs, hmr_core_outputs;
 
     hmr_cv32e40p_bus_outputs_t                  [NumBuses-1:0] sys_bus_outputs;
     hmr_cv32e40p_bus_outputs_t [NumHMRCores-1:0][NumBuses-1:0] core_bus_outputs;
+    hmr_cv32e40p_bus_outputs_t [NumHMRCores-1:0][NumBuses-1:0] hmr_core_bus_outputs;
     logic                                       [NumBuses-1:0] enable_bus_output;
 
-    logic [NumHMRCores-1:0] core_setback;
+    logic [NumHMRCores-1:0] core_setback, hmr_setback;
+    logic                   hmr_resynch_req;
 
     assign sys_inputs = '{
       pulp_clock_en:     '0,
       scan_cg_en_i:      test_enable_i,
-      boot_addr:         boot_addr_i,
+      boot_addr:         split_boot_addr[0],
       mtvec_addr:        32'h0000_0000,
       mtvt_addr:         32'h0000_0000,
       dm_halt_addr:      PeriphBaseAddr + DebugAddrOffset + dm::HaltAddress[31:0],
@@ -245,7 +326,7 @@ module safety_core_wrap import safety_island_pkg::*; #(
 
       .tmr_failure_o         (),
       .tmr_error_o           (),
-      .tmr_resynch_req_o     ( resynch_irq ),
+      .tmr_resynch_req_o     ( hmr_resynch_req ),
       .tmr_sw_synch_req_o    (), // Not used in fixed mode
       .tmr_cores_synch_i     ('0), // Not used in fixed mode
 
@@ -260,13 +341,73 @@ module safety_core_wrap import safety_island_pkg::*; #(
       .sys_bus_outputs_o     ( sys_bus_outputs ),
       .sys_fetch_en_i        ( fetch_enable_i  ),
 
-      .core_setback_o        ( core_setback     ),
-      .core_inputs_o         ( core_inputs      ),
-      .core_nominal_outputs_i( core_outputs     ),
-      .core_bus_outputs_i    ( core_bus_outputs ),
+      .core_setback_o        ( hmr_setback          ),
+      .core_inputs_o         ( hmr_core_inputs      ),
+      .core_nominal_outputs_i( hmr_core_outputs     ),
+      .core_bus_outputs_i    ( hmr_core_bus_outputs ),
       .enable_bus_vote_i     ( enable_bus_output )
     );
 
+    // In split mode, the HMR unit sees hart 0 on all its core ports, so it neither detects
+    // mismatches nor sets back the harts, and harts 1 and 2 use their own bus ports.
+    assign resynch_irq = hmr_resynch_req && !split_mode;
+
+    for (genvar i = 0; i < NumHMRCores; i++) begin : gen_split_mux
+      assign hmr_core_outputs[i]     = split_mode ? core_outputs[0]     : core_outputs[i];
+      assign hmr_core_bus_outputs[i] = split_mode ? core_bus_outputs[0] : core_bus_outputs[i];
+      assign core_inputs[i]  = split_mode && i != 0 ? split_core_inputs[i] : hmr_core_inputs[i];
+      assign core_setback[i] = (hmr_setback[i] && !split_mode) || split_setback;
+
+      assign split_port_req   [3*i+:3] = {core_outputs[i].shadow_req,
+                                          core_outputs[i].data_req,
+                                          core_outputs[i].instr_req};
+      assign split_port_gnt   [3*i+:3] = {core_inputs[i].shadow_gnt,
+                                          core_inputs[i].data_gnt,
+                                          core_inputs[i].instr_gnt};
+      assign split_port_rvalid[3*i+:3] = {core_inputs[i].shadow_rvalid,
+                                          core_inputs[i].data_rvalid,
+                                          core_inputs[i].instr_rvalid};
+    end
+
+    // Harts 1 and 2 in split mode: own hart ID, boot address and software interrupt (msip), no
+    // shadow port as they do not take vectored interrupts
+    assign split_core_inputs[0] = '0;
+    for (genvar i = 1; i < NumHMRCores; i++) begin : gen_split_harts
+      assign split_core_inputs[i] = '{
+        pulp_clock_en:     '0,
+        scan_cg_en_i:      test_enable_i,
+        boot_addr:         split_boot_addr[i],
+        mtvec_addr:        32'h0000_0000,
+        mtvt_addr:         32'h0000_0000,
+        dm_halt_addr:      PeriphBaseAddr + DebugAddrOffset + dm::HaltAddress[31:0],
+        hart_id:           hart_id_i + 32'(i),
+        dm_exception_addr: PeriphBaseAddr + DebugAddrOffset + dm::ExceptionAddress[31:0],
+        instr_gnt:         split_instr_gnt_i   [i-1],
+        instr_rvalid:      split_instr_rvalid_i[i-1],
+        instr_rdata:       split_instr_rdata_i [i-1],
+        data_gnt:          split_data_gnt_i    [i-1],
+        data_rvalid:       split_data_rvalid_i [i-1],
+        data_rdata:        split_data_rdata_i  [i-1],
+        shadow_gnt:        1'b0,
+        shadow_rvalid:     1'b0,
+        shadow_rdata:      '0,
+        irq:               {{(TotalNumInterrupts-4){1'b0}}, split_irqs[i], 3'b000},
+        irq_level:         8'hFF,
+        irq_shv:           1'b0,
+        debug_req:         1'b0,
+        fetch_enable:      fetch_enable_i
+      };
+
+      assign split_instr_req_o [i-1] = split_mode && core_outputs[i].instr_req;
+      assign split_instr_addr_o[i-1] = core_outputs[i].instr_addr;
+      assign split_data_req_o  [i-1] = split_mode && core_outputs[i].data_req;
+      assign split_data_we_o   [i-1] = core_bus_outputs[i][DataBus].we;
+      assign split_data_be_o   [i-1] = core_bus_outputs[i][DataBus].be;
+      assign split_data_addr_o [i-1] = core_bus_outputs[i][DataBus].addr;
+      assign split_data_wdata_o[i-1] = core_bus_outputs[i][DataBus].wdata;
+      assign split_data_atop_o [i-1] = core_bus_outputs[i][DataBus].atop;
+    end
+
     for (genvar i = 0; i < NumHMRCores; i++) begin : gen_cores
       // APU signals
       logic                                                  apu_req;
@@ -401,6 +542,20 @@ module safety_core_wrap import safety_island_pkg::*; #(
 
   end else begin : gen_single_core
 
+    assign resynch_irq = 1'b0;
+
+    assign split_port_req     = '0;
+    assign split_port_gnt     = '0;
+    assign split_port_rvalid  = '0;
+    assign split_instr_req_o  = '0;
+    assign split_instr_addr_o = '0;
+    assign split_data_req_o   = '0;
+    assign split_data_we_o    = '0;
+    assign split_data_be_o    = '0;
+    assign split_data_addr_o  = '0;
+    assign split_data_wdata_o = '0;
+    assign split_data_atop_o  = '0;
+
     // APU signals
     logic                           apu_req;
     logic [cv32e40p_apu_core_pkg::APU_NARGS_CPU-1:0][31:0] apu_operands;
@@ -598,7 +753,40 @@ module safety_core_wrap import safety_island_pkg::*; #(
     .reg_rsp_o   (cl_periph_rsp[RegbusOutInstrErr])
   );
 
-  // Instr Bus Err Unit
+  // Errors of posted writes were already acknowledged to the core, so they are injected into the
+  // data bus error unit as an erroneous transaction while the core's data bus is idle.
+  logic [1:0]  data_outstanding_q;
+  logic        posted_err_inject, posted_err_rsp_q;
+  logic [1:0]  posted_err_q;
+  logic        data_err_mon_req, data_err_mon_gnt, data_err_mon_rvalid;
+  logic [31:0] data_err_mon_addr;
+  logic [NumBusErrBits-1:0] data_err_mon_err;
+
+  assign posted_err_inject  = posted_err_valid_i && !data_req_o && data_outstanding_q == '0 &&
+                              !posted_err_rsp_q;
+  assign posted_err_ready_o = posted_err_inject;
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_data_outstanding
+    if (!rst_ni) begin
+      data_outstanding_q <= '0;
+      posted_err_rsp_q   <= 1'b0;
+      posted_err_q       <= '0;
+    end else begin
+      data_outstanding_q <= data_outstanding_q + (data_req_o && data_gnt_i) - data_rvalid_i;
+      posted_err_rsp_q   <= posted_err_inject;
+      if (posted_err_inject) begin
+        posted_err_q <= posted_err_i;
+      end
+    end
+  end
+
+  assign data_err_mon_req    = data_req_o || posted_err_inject;
+  assign data_err_mon_gnt    = data_gnt_i || posted_err_inject;
+  assign data_err_mon_rvalid = data_rvalid_i || posted_err_rsp_q;
+  assign data_err_mon_addr   = posted_err_inject ? posted_err_addr_i : data_addr_o;
+  assign data_err_mon_err    = posted_err_rsp_q ? NumBusErrBits'(posted_err_q) : data_err_i;
+
+  // Data Bus Err Unit
   obi_err_unit_wrap #(
     .AddrWidth       ( 32   ),
     .MetaDataWidth   ( 1 ),
@@ -613,11 +801,11 @@ module safety_core_wrap import safety_island_pkg::*; #(
     .rst_ni,
     .testmode_i ( test_enable_i ),
 
-    .obi_req_i   ( data_req_o ),
-    .obi_gnt_i   ( data_gnt_i ),
-    .obi_rvalid_i( data_rvalid_i ),
-    .obi_addr_i  ( data_addr_o ),
-    .obi_err_i   ( data_err_i ),
+    .obi_req_i   ( data_err_mon_req ),
+    .obi_gnt_i   ( data_err_mon_gnt ),
+    .obi_rvalid_i( data_err_mon_rvalid ),
+    .obi_addr_i  ( data_err_mon_addr ),
+    .obi_err_i   ( data_err_mon_err ),
     .obi_metadata_i ( '0 ),
 
     .err_irq_o   ( bus_err_irq[1] ),
@@ -669,13 +857,18 @@ module safety_core_wrap import safety_island_pkg::*; #(
   always_comb begin : assign_clic_irqs
     seip = '0;
     meip = '0;
-    msip = '0;
+    msip = split_irqs[0];
     clic_irqs = '0; // Default assignment to avoid unassigned irqs
-    clic_irqs[TotalNumInterrupts-1:32] = irqs_i;
-    clic_irqs[31:22] = '0;
+    clic_irqs[32+:SafetyIslandCfg.NumInterrupts] = irqs_i;
+    for (int unsigned i = 0; i < NumExtraTimerIrqs; i++) begin
+      clic_irqs[32+SafetyIslandCfg.NumInterrupts+i] = timer_irqs_i[2+i];
+    end
+    clic_irqs[31:22] = periph_irqs_i;
     clic_irqs[21]    = resynch_irq;
-    clic_irqs[20:18] = bus_err_irq[2:0];
-    clic_irqs[17:16] = timer_irqs_i;
+    clic_irqs[20]    = bus_err_irq[2];
+    clic_irqs[19]    = bus_err_irq[1] || |split_data_err_irq;
+    clic_irqs[18]    = bus_err_irq[0] || |split_instr_err_irq;
+    clic_irqs[17:16] = timer_irqs_i[1:0];
     clic_irqs[15:0]  = {
       {4{1'b0}},       // reserved
       meip,            // meip
@@ -720,4 +913,293 @@ module safety_core_wrap import safety_island_pkg::*; #(
     .irq_kill_ack_i ('0)
   );
 
+  // Performance monitor
+  if (SafetyIslandCfg.UsePerfMon) begin : gen_perf_mon
+    safety_island_perf_mon #(
+      .NumManagers ( NumManagers                    ),
+      .NumBanks    ( SafetyIslandCfg.NumBanks       ),
+      .MaxTrans    ( SafetyIslandCfg.AxiOutMaxTrans ),
+      .reg_req_t   ( reg_req_t                      ),
+      .reg_rsp_t   ( reg_rsp_t                      )
+    ) i_perf_mon (
+      .clk_i,
+      .rst_ni,
+      .testmode_i       ( test_enable_i ),
+
+      .reg_req_i        ( cl_periph_req[RegbusOutPerfMon] ),
+      .reg_rsp_o        ( cl_periph_rsp[RegbusOutPerfMon] ),
+
+      .mgr_req_i        ( perf_mgr_req_i        ),
+      .mgr_gnt_i        ( perf_mgr_gnt_i        ),
+      .bank_conflict_i  ( perf_bank_conflict_i  ),
+      .ecc_corr_i       ( perf_ecc_corr_i       ),
+      .axi_out_req_i    ( perf_axi_out_req_i    ),
+      .axi_out_gnt_i    ( perf_axi_out_gnt_i    ),
+      .axi_out_we_i     ( perf_axi_out_we_i     ),
+      .axi_out_rvalid_i ( perf_axi_out_rvalid_i ),
+      .irq_valid_i      ( core_irq_valid        ),
+      .irq_ready_i      ( core_irq_ready        )
+    );
+  end else begin : gen_no_perf_mon
+    reg_err_slv #(
+      .DW      ( 32           ),
+      .ERR_VAL ( 32'hBADCAB1E ),
+      .req_t   ( reg_req_t    ),
+      .rsp_t   ( reg_rsp_t    )
+    ) i_reg_err_slv_perf_mon (
+      .req_i   ( cl_periph_req[RegbusOutPerfMon] ),
+      .rsp_o   ( cl_periph_rsp[RegbusOutPerfMon] )
+    );
+  end
+
+  // Interrupt latency timestamps
+  if (SafetyIslandCfg.UseIrqTimestamp) begin : gen_irq_timestamp
+    safety_island_irq_timestamp #(
+      .NumSources ( TotalNumInterrupts                ),
+      .NumSlots   ( SafetyIslandCfg.IrqTimestampSlots ),
+      .Depth      ( SafetyIslandCfg.IrqTimestampDepth ),
+      .reg_req_t  ( reg_req_t                         ),
+      .reg_rsp_t  ( reg_rsp_t                         )
+    ) i_irq_timestamp (
+      .clk_i,
+      .rst_ni,
+      .reg_req_i   ( cl_periph_req[RegbusOutIrqTimestamp] ),
+      .reg_rsp_o   ( cl_periph_rsp[RegbusOutIrqTimestamp] ),
+      .intr_src_i  ( clic_irqs      ),
+      .irq_valid_i ( core_irq_valid ),
+      .irq_ready_i ( core_irq_ready ),
+      .irq_id_i    ( core_irq_id    )
+    );
+  end else begin : gen_no_irq_timestamp
+    reg_err_slv #(
+      .DW      ( 32           ),
+      .ERR_VAL ( 32'hBADCAB1E ),
+      .req_t   ( reg_req_t    ),
+      .rsp_t   ( reg_rsp_t    )
+    ) i_reg_err_slv_irq_timestamp (
+      .req_i   ( cl_periph_req[RegbusOutIrqTimestamp] ),
+      .rsp_o   ( cl_periph_rsp[RegbusOutIrqTimestamp] )
+    );
+  end
+
+  // Branch trace of the (voted) fetches of hart 0
+  if (SafetyIslandCfg.UseTrace) begin : gen_trace
+    safety_island_trace #(
+      .FifoDepth ( SafetyIslandCfg.TraceFifoDepth ),
+      .reg_req_t ( reg_req_t                      ),
+      .reg_rsp_t ( reg_rsp_t                      )
+    ) i_trace (
+      .clk_i,
+      .rst_ni,
+      .testmode_i   ( test_enable_i                 ),
+      .reg_req_i    ( cl_periph_req[RegbusOutTrace] ),
+      .reg_rsp_o    ( cl_periph_rsp[RegbusOutTrace] ),
+      .fetch_req_i  ( instr_req_o                   ),
+      .fetch_gnt_i  ( instr_gnt_i                   ),
+      .fetch_addr_i ( instr_addr_o                  ),
+      .irq_ack_i    ( core_irq_ready                ),
+      .irq_id_i     ( 8'(core_irq_id)               ),
+      .stall_o      ( trace_stall_o                 ),
+      .mem_req_o    ( trace_req_o                   ),
+      .mem_gnt_i    ( trace_gnt_i                   ),
+      .mem_addr_o   ( trace_addr_o                  ),
+      .mem_wdata_o  ( trace_wdata_o                 ),
+      .mem_rvalid_i ( trace_rvalid_i                ),
+      .mem_err_i    ( trace_err_i                   )
+    );
+  end else begin : gen_no_trace
+    assign trace_req_o   = 1'b0;
+    assign trace_addr_o  = '0;
+    assign trace_wdata_o = '0;
+    assign trace_stall_o = 1'b0;
+
+    reg_err_slv #(
+      .DW      ( 32           ),
+      .ERR_VAL ( 32'hBADCAB1E ),
+      .req_t   ( reg_req_t    ),
+      .rsp_t   ( reg_rsp_t    )
+    ) i_reg_err_slv_trace (
+      .req_i   ( cl_periph_req[RegbusOutTrace] ),
+      .rsp_o   ( cl_periph_rsp[RegbusOutTrace] )
+    );
+  end
+
+  // TCLS resynchronization assist
+  if (SafetyIslandCfg.UseTCLS && SafetyIslandCfg.UseTclsResync) begin : gen_tcls_resync
+    safety_island_tcls_resync #(
+      .NumStateWords ( 64        ),
+      .reg_req_t     ( reg_req_t ),
+      .reg_rsp_t     ( reg_rsp_t )
+    ) i_tcls_resync (
+      .clk_i,
+      .rst_ni,
+      .reg_req_i     ( cl_periph_req[RegbusOutTclsResync] ),
+      .reg_rsp_o     ( cl_periph_rsp[RegbusOutTclsResync] ),
+      .resynch_req_i ( resynch_irq                        )
+    );
+  end else begin : gen_no_tcls_resync
+    reg_err_slv #(
+      .DW      ( 32           ),
+      .ERR_VAL ( 32'hBADCAB1E ),
+      .req_t   ( reg_req_t    ),
+      .rsp_t   ( reg_rsp_t    )
+    ) i_reg_err_slv_tcls_resync (
+      .req_i   ( cl_periph_req[RegbusOutTclsResync] ),
+      .rsp_o   ( cl_periph_rsp[RegbusOutTclsResync] )
+    );
+  end
+
+  // The resynchronization handler restores mhpmcounter3-10 and their events from the state buffer,
+  // so a counter hit by a fault is voted back like the register file
+  if (SafetyIslandCfg.UseTCLS && SafetyIslandCfg.UseTclsResync &&
+      SafetyIslandCfg.NumMhpmCounters > 8) begin : gen_mhpm_counters_check
+    $fatal(1, "NumMhpmCounters=%0d exceeds the 8 counters kept by the TCLS resynchronization",
+           SafetyIslandCfg.NumMhpmCounters);
+  end
+
+  // Split mode
+  if (SafetyIslandCfg.UseTCLS && SafetyIslandCfg.UseSplitMode) begin : gen_split_ctrl
+    safety_island_split_ctrl #(
+      .NumHarts  ( NumSplitHarts+1 ),
+      .NumPorts  ( NumSplitPorts   ),
+      .reg_req_t ( reg_req_t       ),
+      .reg_rsp_t ( reg_rsp_t       )
+    ) i_split_ctrl (
+      .clk_i,
+      .rst_ni,
+      .reg_req_i     ( cl_periph_req[RegbusOutSplitCtrl] ),
+      .reg_rsp_o     ( cl_periph_rsp[RegbusOutSplitCtrl] ),
+      .boot_addr_i,
+      .split_o       ( split_mode        ),
+      .setback_o     ( split_setback     ),
+      .boot_addr_o   ( split_boot_addr   ),
+      .sw_irqs_o     ( split_irqs        ),
+      .port_req_i    ( split_port_req    ),
+      .port_gnt_i    ( split_port_gnt    ),
+      .port_rvalid_i ( split_port_rvalid )
+    );
+
+    // Bus error units of harts 1 and 2, one 0x10 window per bus: instruction bus of hart h at
+    // 0x20*(h-1), data bus at 0x20*(h-1)+0x10. Their interrupts share the CLIC lines of the
+    // instruction and data bus error units of hart 0.
+    localparam int unsigned NumSplitErrUnits = 2*NumSplitHarts;
+
+    reg_req_t [NumSplitErrUnits:0] split_err_req;
+    reg_rsp_t [NumSplitErrUnits:0] split_err_rsp;
+    logic [cf_math_pkg::idx_width(NumSplitErrUnits+1)-1:0] split_err_idx;
+
+    // Accesses beyond the last unit go to the error slave on the last port
+    assign split_err_idx =
+      cl_periph_req[RegbusOutSplitErr].addr[11:4] < NumSplitErrUnits ?
+        cl_periph_req[RegbusOutSplitErr].addr[4+:$bits(split_err_idx)] : NumSplitErrUnits;
+
+    reg_demux #(
+      .NoPorts ( NumSplitErrUnits+1 ),
+      .req_t   ( reg_req_t          ),
+      .rsp_t   ( reg_rsp_t          )
+    ) i_split_err_demux (
+      .clk_i,
+      .rst_ni,
+      .in_select_i ( split_err_idx                     ),
+      .in_req_i    ( cl_periph_req[RegbusOutSplitErr] ),
+      .in_rsp_o    ( cl_periph_rsp[RegbusOutSplitErr] ),
+      .out_req_o   ( split_err_req                     ),
+      .out_rsp_i   ( split_err_rsp                     )
+    );
+
+    for (genvar i = 0; i < NumSplitHarts; i++) begin : gen_split_bus_err
+      obi_err_unit_wrap #(
+        .AddrWidth       ( 32   ),
+        .MetaDataWidth   ( 1 ),
+        .ErrBits         ( NumBusErrBits ),
+        .NumOutstanding  ( 2    ),
+        .NumStoredErrors ( 8    ),
+        .DropOldest      ( 1'b0 ),
+        .reg_req_t      ( reg_req_t ),
+        .reg_rsp_t      ( reg_rsp_t )
+      ) i_instr_bus_err (
+        .clk_i,
+        .rst_ni,
+        .testmode_i ( test_enable_i ),
+
+        .obi_req_i   ( split_instr_req_o   [i] ),
+        .obi_gnt_i   ( split_instr_gnt_i   [i] ),
+        .obi_rvalid_i( split_instr_rvalid_i[i] ),
+        .obi_addr_i  ( split_instr_addr_o  [i] ),
+        .obi_err_i   ( split_instr_err_i   [i] ),
+        .obi_metadata_i ( '0 ),
+
+        .err_irq_o   ( split_instr_err_irq[i] ),
+
+        .reg_req_i   ( split_err_req[2*i] ),
+        .reg_rsp_o   ( split_err_rsp[2*i] )
+      );
+
+      obi_err_unit_wrap #(
+        .AddrWidth       ( 32   ),
+        .MetaDataWidth   ( 1 ),
+        .ErrBits         ( NumBusErrBits ),
+        .NumOutstanding  ( 2    ),
+        .NumStoredErrors ( 8    ),
+        .DropOldest      ( 1'b0 ),
+        .reg_req_t      ( reg_req_t ),
+        .reg_rsp_t      ( reg_rsp_t )
+      ) i_data_bus_err (
+        .clk_i,
+        .rst_ni,
+        .testmode_i ( test_enable_i ),
+
+        .obi_req_i   ( split_data_req_o   [i] ),
+        .obi_gnt_i   ( split_data_gnt_i   [i] ),
+        .obi_rvalid_i( split_data_rvalid_i[i] ),
+        .obi_addr_i  ( split_data_addr_o  [i] ),
+        .obi_err_i   ( split_data_err_i   [i] ),
+        .obi_metadata_i ( '0 ),
+
+        .err_irq_o   ( split_data_err_irq[i] ),
+
+        .reg_req_i   ( split_err_req[2*i+1] ),
+        .reg_rsp_o   ( split_err_rsp[2*i+1] )
+      );
+    end
+
+    reg_err_slv #(
+      .DW      ( 32           ),
+      .ERR_VAL ( 32'hBADCAB1E ),
+      .req_t   ( reg_req_t    ),
+      .rsp_t   ( reg_rsp_t    )
+    ) i_reg_err_slv_split_err (
+      .req_i   ( split_err_req[NumSplitErrUnits] ),
+      .rsp_o   ( split_err_rsp[NumSplitErrUnits] )
+    );
+  end else begin : gen_no_split_ctrl
+    assign split_mode      = 1'b0;
+    assign split_setback   = 1'b0;
+    assign split_boot_addr = {(NumSplitHarts+1){boot_addr_i}};
+    assign split_irqs      = '0;
+
+    reg_err_slv #(
+      .DW      ( 32           ),
+      .ERR_VAL ( 32'hBADCAB1E ),
+      .req_t   ( reg_req_t    ),
+      .rsp_t   ( reg_rsp_t    )
+    ) i_reg_err_slv_split_ctrl (
+      .req_i   ( cl_periph_req[RegbusOutSplitCtrl] ),
+      .rsp_o   ( cl_periph_rsp[RegbusOutSplitCtrl] )
+    );
+
+    assign split_instr_err_irq = '0;
+    assign split_data_err_irq  = '0;
+
+    reg_err_slv #(
+      .DW      ( 32           ),
+      .ERR_VAL ( 32'hBADCAB1E ),
+      .req_t   ( reg_req_t    ),
+      .rsp_t   ( reg_rsp_t    )
+    ) i_reg_err_slv_split_err (
+      .req_i   ( cl_periph_req[RegbusOutSplitErr] ),
+      .rsp_o   ( cl_periph_rsp[RegbusOutSplitErr] )
+    );
+  end
+
 endmodule
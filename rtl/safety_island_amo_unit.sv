@@ -0,0 +1,247 @@
+// Copyright 2024 ETH Zurich and University of Bologna.
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License.  You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+// Near-memory AMO unit in front of the ATOP resolver of a memory bank.
+//
+// The ATOP resolver executes an AMO as a read and a dependent write of the bank. This unit keeps
+// a copy of the `NumEntries` most recent AMO target words. An AMO on a held word is computed
+// here when it is accepted and only its result is written to the bank as a plain write, so the
+// bank serves one AMO per cycle, and back-to-back AMOs on the same word see each other's result.
+// The response of that write returns the old value.
+// The copies are written through, so the bank always holds the current value:
+// - an AMO on another word is forwarded to the resolver and its result fills an entry,
+// - accesses to a word whose fill is outstanding wait for the fill,
+// - plain writes to a held word update the copy, LR/SC and partial AMOs invalidate it,
+// - `flush_i` invalidates all entries and disables new ones, for accesses bypassing the unit.
+//   Outstanding fills complete but do not validate their entry.
+// The copies are not covered by the ECC of the bank, and a local AMO writes its result with a
+// fresh codeword. Each copy therefore has a parity bit: an access to a copy with a parity
+// mismatch invalidates it, and an AMO on it is forwarded to the resolver, which reads the word
+// from the bank.
+
+module safety_island_amo_unit #(
+  parameter int unsigned NumEntries = 4,
+  /// Outstanding transactions towards the bank
+  parameter int unsigned MaxTrans   = 2,
+  parameter int unsigned AddrWidth  = 32,
+  parameter type         obi_req_t  = logic,
+  parameter type         obi_rsp_t  = logic
+) (
+  input  logic     clk_i,
+  input  logic     rst_ni,
+  input  logic     testmode_i,
+
+  input  logic     flush_i,
+  /// Valid entries or outstanding fills
+  output logic     pending_o,
+
+  input  obi_req_t sbr_port_req_i,
+  output obi_rsp_t sbr_port_rsp_o,
+
+  output obi_req_t mgr_port_req_o,
+  input  obi_rsp_t mgr_port_rsp_i
+);
+
+  localparam int unsigned IdxWidth = cf_math_pkg::idx_width(NumEntries);
+
+  typedef logic [AddrWidth-1:2] word_addr_t;
+  typedef logic [IdxWidth-1:0]  idx_t;
+
+  // Per outstanding transaction: the old value of a local AMO, or the operand of a fill
+  typedef struct packed {
+    logic        local_amo;
+    logic        fill;
+    idx_t        idx;
+    logic [5:0]  atop;
+    logic [31:0] data;
+  } trans_t;
+
+  function automatic logic [31:0] amo_result(logic [5:0] atop, logic [31:0] mem,
+                                             logic [31:0] op);
+    unique case (atop)
+      obi_pkg::AMOSWAP: return op;
+      obi_pkg::AMOADD:  return mem + op;
+      obi_pkg::AMOXOR:  return mem ^ op;
+      obi_pkg::AMOAND:  return mem & op;
+      obi_pkg::AMOOR:   return mem | op;
+      obi_pkg::AMOMIN:  return $signed(mem) < $signed(op) ? mem : op;
+      obi_pkg::AMOMAX:  return $signed(mem) > $signed(op) ? mem : op;
+      obi_pkg::AMOMINU: return mem < op ? mem : op;
+      obi_pkg::AMOMAXU: return mem > op ? mem : op;
+      default:          return mem;
+    endcase
+  endfunction
+
+  logic [NumEntries-1:0] valid_q, fill_q;
+  word_addr_t            tag_q  [NumEntries];
+  logic [31:0]           data_q [NumEntries];
+  logic [NumEntries-1:0] parity_q;
+  idx_t                  victim_q;
+
+  // -----------------
+  // Request
+  // -----------------
+
+  logic [5:0]  atop;
+  logic        is_amo, full_word, is_write;
+  logic        hit_valid, hit_ok, hit_fill, free_avail;
+  idx_t        hit_idx, free_idx, alloc_idx;
+  logic        local_amo, alloc, stall, accept;
+  logic [31:0] amo_data, write_data;
+  logic        trans_full, trans_empty;
+  trans_t      trans_in, trans_out;
+
+  assign atop      = sbr_port_req_i.a.a_optional.atop;
+  assign is_amo    = atop[5] && atop != obi_pkg::ATOPLR && atop != obi_pkg::ATOPSC;
+  assign full_word = sbr_port_req_i.a.be == 4'hF;
+  assign is_write  = sbr_port_req_i.a.we && atop == '0;
+
+  always_comb begin : proc_lookup
+    hit_valid  = 1'b0;
+    hit_fill   = 1'b0;
+    hit_idx    = '0;
+    free_avail = 1'b0;
+    free_idx   = '0;
+    for (int unsigned e = 0; e < NumEntries; e++) begin
+      if (tag_q[e] == sbr_port_req_i.a.addr[AddrWidth-1:2]) begin
+        if (valid_q[e]) begin
+          hit_valid = 1'b1;
+          hit_idx   = idx_t'(e);
+        end
+        if (fill_q[e]) begin
+          hit_fill = 1'b1;
+        end
+      end
+      if (!valid_q[e] && !fill_q[e] && !free_avail) begin
+        free_avail = 1'b1;
+        free_idx   = idx_t'(e);
+      end
+    end
+  end
+
+  // Prefer a free entry, never replace an outstanding fill
+  assign alloc_idx = free_avail ? free_idx : victim_q;
+
+  assign hit_ok    = hit_valid && ^{data_q[hit_idx], parity_q[hit_idx]} == 1'b0;
+  assign local_amo = is_amo && full_word && hit_ok && !flush_i;
+  assign alloc     = is_amo && full_word && !hit_valid && !fill_q[alloc_idx] && !flush_i;
+  assign stall     = hit_fill || trans_full;
+  assign amo_data  = amo_result(atop, data_q[hit_idx], sbr_port_req_i.a.wdata);
+
+  always_comb begin : proc_write_data
+    write_data = data_q[hit_idx];
+    for (int unsigned b = 0; b < 4; b++) begin
+      if (sbr_port_req_i.a.be[b]) begin
+        write_data[8*b+:8] = sbr_port_req_i.a.wdata[8*b+:8];
+      end
+    end
+  end
+
+  always_comb begin : proc_mgr_req
+    mgr_port_req_o     = sbr_port_req_i;
+    mgr_port_req_o.req = sbr_port_req_i.req && !stall;
+    if (local_amo) begin
+      mgr_port_req_o.a.we              = 1'b1;
+      mgr_port_req_o.a.wdata           = amo_data;
+      mgr_port_req_o.a.a_optional.atop = '0;
+    end
+  end
+
+  assign accept = sbr_port_req_i.req && !stall && mgr_port_rsp_i.gnt;
+
+  // -----------------
+  // Response
+  // -----------------
+
+  assign trans_in = '{
+    local_amo: local_amo,
+    fill:      alloc,
+    idx:       local_amo ? hit_idx : alloc_idx,
+    atop:      atop,
+    data:      local_amo ? data_q[hit_idx] : sbr_port_req_i.a.wdata
+  };
+
+  fifo_v3 #(
+    .FALL_THROUGH ( 1'b0     ),
+    .dtype        ( trans_t  ),
+    .DEPTH        ( MaxTrans )
+  ) i_trans_fifo (
+    .clk_i,
+    .rst_ni,
+    .flush_i    ( 1'b0        ),
+    .testmode_i,
+    .full_o     ( trans_full  ),
+    .empty_o    ( trans_empty ),
+    .usage_o    (),
+    .data_i     ( trans_in    ),
+    .push_i     ( accept      ),
+    .data_o     ( trans_out   ),
+    .pop_i      ( mgr_port_rsp_i.rvalid && !trans_empty )
+  );
+
+  always_comb begin : proc_sbr_rsp
+    sbr_port_rsp_o     = mgr_port_rsp_i;
+    sbr_port_rsp_o.gnt = mgr_port_rsp_i.gnt && !stall;
+    if (trans_out.local_amo) begin
+      sbr_port_rsp_o.r.rdata = trans_out.data;
+    end
+  end
+
+  // -----------------
+  // Entries
+  // -----------------
+
+  assign pending_o = |valid_q || |fill_q;
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_entries
+    if (!rst_ni) begin
+      valid_q  <= '0;
+      fill_q   <= '0;
+      tag_q    <= '{default: '0};
+      data_q   <= '{default: '0};
+      parity_q <= '0;
+      victim_q <= '0;
+    end else begin
+      // Fill from the old value returned by the resolver
+      if (mgr_port_rsp_i.rvalid && !trans_empty && trans_out.fill && fill_q[trans_out.idx]) begin
+        fill_q[trans_out.idx] <= 1'b0;
+        if (!mgr_port_rsp_i.r.err && !mgr_port_rsp_i.r.r_optional.ruser && !flush_i) begin
+          valid_q [trans_out.idx] <= 1'b1;
+          data_q  [trans_out.idx] <= amo_result(trans_out.atop, mgr_port_rsp_i.r.rdata,
+                                                trans_out.data);
+          parity_q[trans_out.idx] <= ^amo_result(trans_out.atop, mgr_port_rsp_i.r.rdata,
+                                                 trans_out.data);
+        end
+      end
+
+      if (accept) begin
+        if (local_amo) begin
+          data_q  [hit_idx] <= amo_data;
+          parity_q[hit_idx] <= ^amo_data;
+        end else if (alloc) begin
+          valid_q [alloc_idx] <= 1'b0;
+          fill_q  [alloc_idx] <= 1'b1;
+          tag_q   [alloc_idx] <= sbr_port_req_i.a.addr[AddrWidth-1:2];
+          victim_q            <= victim_q == idx_t'(NumEntries-1) ? '0 : victim_q + 1;
+        end else if (hit_ok && is_write) begin
+          data_q  [hit_idx] <= write_data;
+          parity_q[hit_idx] <= ^write_data;
+        end else if (hit_valid && (atop != '0 || !hit_ok)) begin
+          valid_q[hit_idx] <= 1'b0;
+        end
+      end
+
+      if (flush_i) begin
+        valid_q <= '0;
+      end
+    end
+  end
+
+endmodule
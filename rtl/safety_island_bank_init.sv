@@ -0,0 +1,91 @@
+// Copyright 2024 ETH Zurich and University of Bologna.
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License.  You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+// Initialization engine in front of a memory bank.
+//
+// While busy, the engine writes zeroes as full words to all `NumWords` words of the bank, one word
+// per grant, so the bank encodes them with a valid ECC codeword. Accesses from the port are not
+// granted until it is done. The engine starts with the reset if `InitOnReset` is set, and on
+// `start_i`. The response to a read granted before still follows in the next cycle.
+
+module safety_island_bank_init #(
+  parameter int unsigned NumWords    = 16384,
+  parameter int unsigned AddrWidth   = 32,
+  parameter bit          InitOnReset = 1'b1
+) (
+  input  logic                 clk_i,
+  input  logic                 rst_ni,
+
+  input  logic                 start_i,
+  output logic                 busy_o,
+
+  // Port
+  input  logic                 req_i,
+  input  logic                 we_i,
+  input  logic [AddrWidth-1:0] addr_i,
+  input  logic [31:0]          wdata_i,
+  input  logic [3:0]           be_i,
+  output logic                 gnt_o,
+  output logic [31:0]          rdata_o,
+
+  // Memory
+  output logic                 req_o,
+  output logic                 we_o,
+  output logic [AddrWidth-1:0] addr_o,
+  output logic [31:0]          wdata_o,
+  output logic [3:0]           be_o,
+  input  logic                 gnt_i,
+  input  logic [31:0]          rdata_i
+);
+
+  localparam int unsigned WordIdxWidth = cf_math_pkg::idx_width(NumWords);
+
+  logic                    busy_q;
+  logic [WordIdxWidth-1:0] word_q;
+
+  assign busy_o = busy_q;
+
+  always_comb begin : proc_mux
+    req_o   = req_i;
+    we_o    = we_i;
+    addr_o  = addr_i;
+    wdata_o = wdata_i;
+    be_o    = be_i;
+    gnt_o   = gnt_i && !busy_q;
+    if (busy_q) begin
+      req_o   = 1'b1;
+      we_o    = 1'b1;
+      addr_o  = AddrWidth'({word_q, 2'b00});
+      wdata_o = '0;
+      be_o    = 4'hF;
+    end
+  end
+
+  assign rdata_o = rdata_i;
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_init
+    if (!rst_ni) begin
+      busy_q <= InitOnReset;
+      word_q <= '0;
+    end else begin
+      if (start_i && !busy_q) begin
+        busy_q <= 1'b1;
+        word_q <= '0;
+      end else if (busy_q && gnt_i) begin
+        if (word_q == WordIdxWidth'(NumWords-1)) begin
+          busy_q <= 1'b0;
+        end else begin
+          word_q <= word_q + 1;
+        end
+      end
+    end
+  end
+
+endmodule
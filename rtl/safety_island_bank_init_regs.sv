@@ -0,0 +1,68 @@
+// Copyright 2024 ETH Zurich and University of Bologna.
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License.  You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+// Control and status of the memory bank initialization engines.
+//
+// Register map (32-bit registers):
+//   0x00  BUSY    [NumBanks-1:0] banks being initialized, a write starts the set banks
+//   0x04  CYCLES  cycles of the last initialization, from its start until no bank is busy
+
+module safety_island_bank_init_regs #(
+  parameter int unsigned NumBanks  = 2,
+  parameter type         reg_req_t = logic,
+  parameter type         reg_rsp_t = logic
+) (
+  input  logic                clk_i,
+  input  logic                rst_ni,
+
+  input  reg_req_t            reg_req_i,
+  output reg_rsp_t            reg_rsp_o,
+
+  output logic [NumBanks-1:0] start_o,
+  input  logic [NumBanks-1:0] busy_i
+);
+
+  logic        reg_write;
+  logic [9:0]  reg_word;
+  logic        busy_q;
+  logic [31:0] count_q, cycles_q;
+
+  assign reg_write = reg_req_i.valid && reg_req_i.write;
+  assign reg_word  = reg_req_i.addr[11:2];
+
+  always_comb begin : proc_reg_read
+    reg_rsp_o.ready = 1'b1;
+    reg_rsp_o.error = 1'b0;
+    reg_rsp_o.rdata = '0;
+    unique case (reg_word)
+      10'h0:   reg_rsp_o.rdata = 32'(busy_i);
+      10'h1:   reg_rsp_o.rdata = cycles_q;
+      default: reg_rsp_o.error = 1'b1;
+    endcase
+  end
+
+  assign start_o = reg_write && reg_word == 10'h0 ? reg_req_i.wdata[NumBanks-1:0] : '0;
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_cycles
+    if (!rst_ni) begin
+      busy_q   <= 1'b0;
+      count_q  <= '0;
+      cycles_q <= '0;
+    end else begin
+      busy_q <= |busy_i;
+      if (|busy_i) begin
+        count_q <= busy_q ? count_q + 1 : 32'd1;
+      end else if (busy_q) begin
+        cycles_q <= count_q;
+      end
+    end
+  end
+
+endmodule
@@ -0,0 +1,182 @@
+// Copyright 2024 ETH Zurich and University of Bologna.
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License.  You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+// ECC event log and interrupt of the memory banks.
+//
+// Each ECC event of a bank (a corrected or uncorrectable error on an access or found by the
+// scrubber) is pushed into a FIFO of `Depth` entries with the bank, the byte offset in the bank of
+// the last access on the bank's port (for access events) and a cycle timestamp. If several banks
+// report an event in the same cycle, the lowest bank is logged; events that are not logged set
+// OVERFLOW. The level interrupt is raised while enabled and CORRECTED has reached THRESHOLD, or an
+// uncorrectable event is pending.
+//
+// Register map (32-bit registers):
+//   0x000  CTRL        [0] corrected threshold interrupt enable,
+//                      [1] uncorrectable interrupt enable
+//   0x004  THRESHOLD   corrected events to raise the interrupt (0: never)
+//   0x008  STATUS      [15:0] entries in the FIFO, [16] OVERFLOW, [17] UNCORRECTABLE pending,
+//                      writing 1 clears [16] and [17]
+//   0x00C  CORRECTED   corrected events, saturating, cleared on write
+//   0x010  ENTRY_INFO  head entry: [31] valid, [30] uncorrectable, [29] from the scrubber,
+//                      [7:0] bank
+//   0x014  ENTRY_ADDR  head entry: byte offset in the bank, 0 for scrubber events
+//   0x018  ENTRY_TIME  head entry: cycle timestamp, a read removes the entry
+// A drain loop reads ENTRY_INFO, ENTRY_ADDR and ENTRY_TIME until ENTRY_INFO[31] is clear.
+
+module safety_island_ecc_log #(
+  parameter int unsigned NumBanks       = 2,
+  parameter int unsigned Depth          = 8,
+  parameter int unsigned BankAddrWidth  = 16,
+  parameter int unsigned AddrWidth      = 32,
+  parameter type         reg_req_t      = logic,
+  parameter type         reg_rsp_t      = logic
+) (
+  input  logic                                     clk_i,
+  input  logic                                     rst_ni,
+  input  logic                                     testmode_i,
+
+  input  reg_req_t                                 reg_req_i,
+  output reg_rsp_t                                 reg_rsp_o,
+
+  input  logic [NumBanks-1:0]                      access_corrected_i,
+  input  logic [NumBanks-1:0]                      access_uncorrectable_i,
+  input  logic [NumBanks-1:0]                      scrub_corrected_i,
+  input  logic [NumBanks-1:0]                      scrub_uncorrectable_i,
+  /// Address of the last access on each bank's port
+  input  logic [NumBanks-1:0][AddrWidth-1:0]       access_addr_i,
+
+  output logic                                     irq_o
+);
+
+  typedef struct packed {
+    logic        uncorrectable;
+    logic        scrub;
+    logic [7:0]  bank;
+    logic [31:0] addr;
+    logic [31:0] time_stamp;
+  } entry_t;
+
+  logic        reg_write, reg_read;
+  logic [9:0]  reg_word;
+  logic [1:0]  ctrl_q;
+  logic [31:0] threshold_q, corrected_q, cycles_q;
+  logic        overflow_q, uncorrectable_q;
+
+  logic [NumBanks-1:0] event_valid, corrected;
+  logic                push, pop, full, empty;
+  entry_t              entry_in, entry_out;
+  logic [cf_math_pkg::idx_width(Depth)-1:0] usage;
+
+  assign reg_write = reg_req_i.valid && reg_req_i.write;
+  assign reg_read  = reg_req_i.valid && !reg_req_i.write;
+  assign reg_word  = reg_req_i.addr[11:2];
+
+  always_comb begin : proc_reg_read
+    reg_rsp_o.ready = 1'b1;
+    reg_rsp_o.error = 1'b0;
+    reg_rsp_o.rdata = '0;
+    unique case (reg_word)
+      10'h0:   reg_rsp_o.rdata = 32'(ctrl_q);
+      10'h1:   reg_rsp_o.rdata = threshold_q;
+      10'h2:   reg_rsp_o.rdata = {14'b0, uncorrectable_q, overflow_q,
+                                  16'(full ? Depth : usage)};
+      10'h3:   reg_rsp_o.rdata = corrected_q;
+      10'h4:   reg_rsp_o.rdata = empty ? '0 : {1'b1, entry_out.uncorrectable, entry_out.scrub,
+                                               21'b0, entry_out.bank};
+      10'h5:   reg_rsp_o.rdata = empty ? '0 : entry_out.addr;
+      10'h6:   reg_rsp_o.rdata = empty ? '0 : entry_out.time_stamp;
+      default: reg_rsp_o.error = 1'b1;
+    endcase
+  end
+
+  // -----------------
+  // Events
+  // -----------------
+
+  assign corrected   = access_corrected_i | scrub_corrected_i;
+  assign event_valid = corrected | access_uncorrectable_i | scrub_uncorrectable_i;
+
+  always_comb begin : proc_entry
+    entry_in = '0;
+    for (int b = NumBanks-1; b >= 0; b--) begin
+      if (event_valid[b]) begin
+        entry_in.uncorrectable = access_uncorrectable_i[b] || scrub_uncorrectable_i[b];
+        entry_in.scrub         = entry_in.uncorrectable ? !access_uncorrectable_i[b] :
+                                                          !access_corrected_i[b];
+        entry_in.bank          = 8'(b);
+        entry_in.addr          = entry_in.scrub ? '0 : 32'(access_addr_i[b][BankAddrWidth-1:0]);
+        entry_in.time_stamp    = cycles_q;
+      end
+    end
+  end
+
+  assign push = |event_valid && !full;
+  assign pop  = reg_read && reg_word == 10'h6 && !empty;
+
+  fifo_v3 #(
+    .FALL_THROUGH ( 1'b0    ),
+    .dtype        ( entry_t ),
+    .DEPTH        ( Depth   )
+  ) i_log_fifo (
+    .clk_i,
+    .rst_ni,
+    .flush_i    ( 1'b0      ),
+    .testmode_i,
+    .full_o     ( full      ),
+    .empty_o    ( empty     ),
+    .usage_o    ( usage     ),
+    .data_i     ( entry_in  ),
+    .push_i     ( push      ),
+    .data_o     ( entry_out ),
+    .pop_i      ( pop       )
+  );
+
+  assign irq_o = (ctrl_q[0] && threshold_q != '0 && corrected_q >= threshold_q) ||
+                 (ctrl_q[1] && uncorrectable_q);
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_regs
+    if (!rst_ni) begin
+      ctrl_q          <= '0;
+      threshold_q     <= '0;
+      corrected_q     <= '0;
+      cycles_q        <= '0;
+      overflow_q      <= 1'b0;
+      uncorrectable_q <= 1'b0;
+    end else begin
+      cycles_q <= cycles_q + 1;
+
+      if (reg_write && reg_word == 10'h0) begin
+        ctrl_q <= reg_req_i.wdata[1:0];
+      end
+      if (reg_write && reg_word == 10'h1) begin
+        threshold_q <= reg_req_i.wdata;
+      end
+
+      if (reg_write && reg_word == 10'h3) begin
+        corrected_q <= '0;
+      end else if (|corrected && corrected_q != '1) begin
+        corrected_q <= corrected_q + 1;
+      end
+
+      if (reg_write && reg_word == 10'h2 && reg_req_i.wdata[16]) begin
+        overflow_q <= 1'b0;
+      end else if ((|event_valid && full) || $countones(event_valid) > 1) begin
+        overflow_q <= 1'b1;
+      end
+
+      if (reg_write && reg_word == 10'h2 && reg_req_i.wdata[17]) begin
+        uncorrectable_q <= 1'b0;
+      end else if (|(access_uncorrectable_i | scrub_uncorrectable_i)) begin
+        uncorrectable_q <= 1'b1;
+      end
+    end
+  end
+
+endmodule
@@ -0,0 +1,157 @@
+// Copyright 2024 ETH Zurich and University of Bologna.
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License.  You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+// Direct path from the core data port to register-bus targets next to the core.
+//
+// Non-atomic accesses of the core to one of the `NumTargets` targets in `addr_map_i` bypass the
+// crossbar and the peripheral tree: they are issued on the target's register bus and granted when
+// it is ready, with the response in the next cycle. All other accesses go to the crossbar.
+// To keep the responses in order, a direct access waits until the crossbar has returned all
+// outstanding responses of the core. A crossbar response always follows its grant by at least a
+// cycle, so crossbar accesses never wait for a direct one.
+// Each target's register bus is shared with the peripheral tree. The direct path has priority,
+// but a transaction that has started is completed before the bus switches.
+
+module safety_island_fast_path #(
+  parameter int unsigned NumTargets = 2,
+  parameter int unsigned NumRules   = NumTargets,
+  /// Outstanding transactions of the core on the crossbar
+  parameter int unsigned MaxTrans   = 2,
+  parameter type         rule_t     = logic,
+  parameter type         obi_req_t  = logic,
+  parameter type         obi_rsp_t  = logic,
+  parameter type         reg_req_t  = logic,
+  parameter type         reg_rsp_t  = logic
+) (
+  input  logic                      clk_i,
+  input  logic                      rst_ni,
+
+  input  rule_t    [NumRules-1:0]   addr_map_i,
+
+  input  obi_req_t                  sbr_port_req_i,
+  output obi_rsp_t                  sbr_port_rsp_o,
+
+  output obi_req_t                  mgr_port_req_o,
+  input  obi_rsp_t                  mgr_port_rsp_i,
+
+  input  reg_req_t [NumTargets-1:0] periph_req_i,
+  output reg_rsp_t [NumTargets-1:0] periph_rsp_o,
+
+  output reg_req_t [NumTargets-1:0] reg_req_o,
+  input  reg_rsp_t [NumTargets-1:0] reg_rsp_i
+);
+
+  localparam int unsigned TargetIdxWidth = cf_math_pkg::idx_width(NumTargets);
+
+  logic [TargetIdxWidth-1:0] target;
+  logic                      dec_valid, direct, xbar_idle, direct_gnt;
+  logic [$clog2(MaxTrans+1)-1:0] outstanding_q;
+  logic                      rvalid_q, err_q;
+  logic [31:0]               rdata_q;
+  reg_req_t                  direct_req;
+  reg_rsp_t                  direct_rsp;
+
+  addr_decode #(
+    .NoIndices ( NumTargets          ),
+    .NoRules   ( NumRules            ),
+    .addr_t    ( logic [31:0]        ),
+    .rule_t    ( rule_t              ),
+    .Napot     ( 1'b0                )
+  ) i_addr_decode (
+    .addr_i           ( sbr_port_req_i.a.addr ),
+    .addr_map_i,
+    .idx_o            ( target    ),
+    .dec_valid_o      ( dec_valid ),
+    .dec_error_o      (),
+    .en_default_idx_i ( 1'b0 ),
+    .default_idx_i    ( '0 )
+  );
+
+  assign direct    = dec_valid && sbr_port_req_i.a.a_optional.atop == '0;
+  assign xbar_idle = outstanding_q == '0 || (outstanding_q == 1 && mgr_port_rsp_i.rvalid);
+
+  assign direct_req = '{
+    addr:  sbr_port_req_i.a.addr,
+    write: sbr_port_req_i.a.we,
+    wdata: sbr_port_req_i.a.wdata,
+    wstrb: sbr_port_req_i.a.be,
+    valid: sbr_port_req_i.req && direct && xbar_idle
+  };
+
+  // -----------------
+  // Target buses
+  // -----------------
+
+  logic [NumTargets-1:0] sel_direct, busy_q, owner_q;
+
+  for (genvar t = 0; t < NumTargets; t++) begin : gen_target
+    assign sel_direct[t] = busy_q[t] ? owner_q[t] : direct_req.valid && target == t;
+
+    always_comb begin : proc_target_mux
+      reg_req_o[t]    = periph_req_i[t];
+      periph_rsp_o[t] = reg_rsp_i[t];
+      if (sel_direct[t]) begin
+        reg_req_o[t]    = direct_req;
+        periph_rsp_o[t] = '0;
+      end
+    end
+
+    always_ff @(posedge clk_i or negedge rst_ni) begin : proc_target_lock
+      if (!rst_ni) begin
+        busy_q[t]  <= 1'b0;
+        owner_q[t] <= 1'b0;
+      end else begin
+        busy_q[t]  <= reg_req_o[t].valid && !reg_rsp_i[t].ready;
+        owner_q[t] <= sel_direct[t];
+      end
+    end
+  end
+
+  assign direct_rsp = reg_rsp_i[target];
+  assign direct_gnt = direct_req.valid && sel_direct[target] && direct_rsp.ready;
+
+  // -----------------
+  // Core port
+  // -----------------
+
+  always_comb begin : proc_mgr_req
+    mgr_port_req_o     = sbr_port_req_i;
+    mgr_port_req_o.req = sbr_port_req_i.req && !direct;
+  end
+
+  always_comb begin : proc_sbr_rsp
+    sbr_port_rsp_o     = mgr_port_rsp_i;
+    sbr_port_rsp_o.gnt = direct ? direct_gnt : mgr_port_rsp_i.gnt;
+    if (rvalid_q) begin
+      sbr_port_rsp_o.rvalid  = 1'b1;
+      sbr_port_rsp_o.r       = '0;
+      sbr_port_rsp_o.r.rdata = rdata_q;
+      sbr_port_rsp_o.r.err   = err_q;
+    end
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_direct_rsp
+    if (!rst_ni) begin
+      outstanding_q <= '0;
+      rvalid_q      <= 1'b0;
+      err_q         <= 1'b0;
+      rdata_q       <= '0;
+    end else begin
+      outstanding_q <= outstanding_q + (mgr_port_req_o.req && mgr_port_rsp_i.gnt) -
+                       mgr_port_rsp_i.rvalid;
+      rvalid_q      <= direct_gnt;
+      if (direct_gnt) begin
+        err_q   <= direct_rsp.error;
+        rdata_q <= direct_rsp.rdata;
+      end
+    end
+  end
+
+endmodule
@@ -0,0 +1,424 @@
+// Copyright 2024 ETH Zurich and University of Bologna.
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License.  You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+// Direct-mapped instruction cache for execution from external AXI memory.
+//
+// Fetches outside of the island address range are served from the cache, misses refill a full
+// line with a single AXI burst and the next sequential line is prefetched afterwards. Fetches to
+// the island itself (SRAM banks, boot ROM, debug) bypass the cache towards the main crossbar.
+// The cache is not coherent with data writes: software has to invalidate it through the
+// register interface after modifying code in external memory. An ECC error flagged in the AXI user
+// of any refill beat is kept with the line and returned in the OBI ruser of every hit on it.
+//
+// Register map (32-bit registers):
+//   0x00 CTRL       [0] enable, [1] sequential prefetch enable (both reset to 1)
+//   0x04 INVALIDATE writing [0]=1 invalidates all lines, reads as 0
+//   0x08 HITS       number of cached fetches served from the cache, cleared on write
+//   0x0C MISSES     number of line refills caused by a fetch, cleared on write
+//   0x10 INFO       [15:0] number of lines, [31:16] bytes per line (read-only)
+
+module safety_island_icache #(
+  /// Number of cache lines
+  parameter int unsigned              NumLines        = 8,
+  /// Bytes per cache line, multiple of the AXI data width
+  parameter int unsigned              LineBytes       = 32,
+  /// Island address range, fetches inside are not cached
+  parameter bit [31:0]                IslandBaseAddr  = 32'h0000_0000,
+  parameter bit [31:0]                IslandAddrRange = 32'h0080_0000,
+  /// AXI refill port
+  parameter int unsigned              AxiAddrWidth    = 32,
+  parameter int unsigned              AxiDataWidth    = 64,
+  parameter int unsigned              AxiUserWidth    = 1,
+  parameter bit [AxiUserWidth-1:0]    AxiUser         = '0,
+  /// Bit of the AXI R user signalling an ECC error
+  parameter bit                       AxiUserEccErr    = 1'b0,
+  parameter int unsigned              AxiUserEccErrBit = 0,
+  /// Outstanding fetches on the bypass port
+  parameter int unsigned              MaxBypassTrans  = 2,
+  parameter type                      axi_req_t       = logic,
+  parameter type                      axi_rsp_t       = logic,
+  /// OBI instruction port
+  parameter type                      obi_req_t       = logic,
+  parameter type                      obi_rsp_t       = logic,
+  /// Register interface
+  parameter type                      reg_req_t       = logic,
+  parameter type                      reg_rsp_t       = logic
+) (
+  input  logic     clk_i,
+  input  logic     rst_ni,
+
+  // Core instruction fetch port
+  input  obi_req_t core_req_i,
+  output obi_rsp_t core_rsp_o,
+
+  // Bypass port towards the main crossbar
+  output obi_req_t bypass_req_o,
+  input  obi_rsp_t bypass_rsp_i,
+
+  // Refill port towards the AXI output
+  output axi_req_t axi_req_o,
+  input  axi_rsp_t axi_rsp_i,
+
+  // Configuration
+  input  reg_req_t reg_req_i,
+  output reg_rsp_t reg_rsp_o
+);
+
+  localparam int unsigned LineWords    = LineBytes/4;
+  localparam int unsigned LineBeats    = LineBytes/(AxiDataWidth/8);
+  localparam int unsigned OffsetWidth  = $clog2(LineBytes);
+  localparam int unsigned IdxWidth     = NumLines > 1 ? $clog2(NumLines) : 1;
+  localparam int unsigned TagWidth     = 32 - OffsetWidth - $clog2(NumLines);
+  localparam int unsigned BeatCntWidth = LineBeats > 1 ? $clog2(LineBeats) : 1;
+  localparam int unsigned BypassCntWidth = $clog2(MaxBypassTrans+1);
+
+  typedef logic [LineBytes*8-1:0]   line_t;
+  typedef logic [TagWidth-1:0]      tag_t;
+  typedef logic [IdxWidth-1:0]      idx_t;
+  typedef logic [31-OffsetWidth:0]  line_addr_t;
+
+  function automatic idx_t addr_idx(line_addr_t line_addr);
+    return NumLines > 1 ? idx_t'(line_addr) : '0;
+  endfunction
+
+  function automatic tag_t addr_tag(line_addr_t line_addr);
+    return tag_t'(line_addr >> $clog2(NumLines));
+  endfunction
+
+  function automatic logic is_cacheable(logic [31:0] addr);
+    return !(addr >= IslandBaseAddr && addr < IslandBaseAddr + IslandAddrRange);
+  endfunction
+
+  // -----------------
+  // Registers
+  // -----------------
+
+  logic        enable_q, prefetch_en_q;
+  logic        invalidate;
+  logic [31:0] hits_q, misses_q;
+  logic        count_hit, count_miss;
+
+  always_comb begin : proc_reg_read
+    reg_rsp_o.ready = 1'b1;
+    reg_rsp_o.error = 1'b0;
+    reg_rsp_o.rdata = '0;
+    case (reg_req_i.addr[4:2])
+      3'h0: reg_rsp_o.rdata = {30'b0, prefetch_en_q, enable_q};
+      3'h1: reg_rsp_o.rdata = '0;
+      3'h2: reg_rsp_o.rdata = hits_q;
+      3'h3: reg_rsp_o.rdata = misses_q;
+      3'h4: reg_rsp_o.rdata = {16'(LineBytes), 16'(NumLines)};
+      default: reg_rsp_o.error = 1'b1;
+    endcase
+  end
+
+  assign invalidate = reg_req_i.valid && reg_req_i.write && reg_req_i.addr[4:2] == 3'h1 &&
+                      reg_req_i.wstrb[0] && reg_req_i.wdata[0];
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_regs
+    if (!rst_ni) begin
+      enable_q      <= 1'b1;
+      prefetch_en_q <= 1'b1;
+      hits_q        <= '0;
+      misses_q      <= '0;
+    end else begin
+      if (reg_req_i.valid && reg_req_i.write && reg_req_i.addr[4:2] == 3'h0 &&
+          reg_req_i.wstrb[0]) begin
+        enable_q      <= reg_req_i.wdata[0];
+        prefetch_en_q <= reg_req_i.wdata[1];
+      end
+      if (reg_req_i.valid && reg_req_i.write && reg_req_i.addr[4:2] == 3'h2) begin
+        hits_q <= '0;
+      end else if (count_hit) begin
+        hits_q <= hits_q + 1;
+      end
+      if (reg_req_i.valid && reg_req_i.write && reg_req_i.addr[4:2] == 3'h3) begin
+        misses_q <= '0;
+      end else if (count_miss) begin
+        misses_q <= misses_q + 1;
+      end
+    end
+  end
+
+  // -----------------
+  // Tag and data arrays
+  // -----------------
+
+  logic  [NumLines-1:0] valid_q;
+  tag_t  [NumLines-1:0] tag_q;
+  line_t [NumLines-1:0] data_q;
+  logic  [NumLines-1:0] ecc_err_q;
+
+  logic       install;
+  line_addr_t refill_line_q;
+  line_t      refill_data_q, install_data;
+  logic       refill_ecc_err_q, refill_ecc_err_d;
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_valid
+    if (!rst_ni) begin
+      valid_q <= '0;
+    end else if (invalidate || !enable_q) begin
+      valid_q <= '0;
+    end else if (install) begin
+      valid_q[addr_idx(refill_line_q)] <= 1'b1;
+    end
+  end
+
+  // No reset needed, gated by valid
+  always_ff @(posedge clk_i) begin : proc_arrays
+    if (install) begin
+      tag_q    [addr_idx(refill_line_q)] <= addr_tag(refill_line_q);
+      data_q   [addr_idx(refill_line_q)] <= install_data;
+      ecc_err_q[addr_idx(refill_line_q)] <= refill_ecc_err_d;
+    end
+  end
+
+  function automatic logic line_present(line_addr_t line_addr);
+    return valid_q[addr_idx(line_addr)] && tag_q[addr_idx(line_addr)] == addr_tag(line_addr);
+  endfunction
+
+  // -----------------
+  // Fetch handling
+  // -----------------
+
+  line_addr_t core_line;
+  logic       core_cacheable, core_hit;
+  logic [BypassCntWidth-1:0] bypass_pending_q;
+  logic                      bypass_full, bypass_idle;
+
+  assign core_line      = core_req_i.a.addr[31:OffsetWidth];
+  assign core_cacheable = enable_q && is_cacheable(core_req_i.a.addr);
+  assign core_hit       = line_present(core_line);
+
+  // Responses are returned in order: cached fetches wait for outstanding bypass fetches. Bypass
+  // fetches never overtake cached ones, as a cached response is always returned the cycle after
+  // the grant. At most `MaxBypassTrans` bypass fetches are outstanding, so the counter never wraps.
+  assign bypass_full = bypass_pending_q == BypassCntWidth'(MaxBypassTrans);
+  assign bypass_idle = bypass_pending_q == '0 ||
+                       (bypass_pending_q == BypassCntWidth'(1) && bypass_rsp_i.rvalid);
+
+  always_comb begin : proc_bypass
+    bypass_req_o     = core_req_i;
+    bypass_req_o.req = core_req_i.req && !core_cacheable && !bypass_full;
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_bypass_pending
+    if (!rst_ni) begin
+      bypass_pending_q <= '0;
+    end else begin
+      bypass_pending_q <= bypass_pending_q + (bypass_req_o.req && bypass_rsp_i.gnt)
+                                           - bypass_rsp_i.rvalid;
+    end
+  end
+
+  // -----------------
+  // Refill
+  // -----------------
+
+  typedef enum logic [1:0] {
+    Idle,
+    RefillAr,
+    RefillR
+  } refill_state_e;
+
+  refill_state_e state_q, state_d;
+  logic          refill_prefetch_q, refill_prefetch_d;
+  logic          refill_drop_q, refill_drop_d;
+  logic          refill_err_q, refill_err_d;
+  line_addr_t    refill_line_d;
+  line_addr_t    err_line_q, err_line_d;
+  logic          err_valid_q, err_valid_d;
+  logic [BeatCntWidth-1:0] beat_q, beat_d;
+
+  logic          cache_gnt, cache_err_gnt;
+  logic          rsp_valid_q, rsp_err_q, rsp_ecc_err_q;
+  logic [31:0]   rsp_rdata_q;
+  logic [$bits(core_req_i.a.aid)-1:0] rsp_rid_q;
+
+  line_addr_t    next_line;
+  assign next_line = refill_line_q + 1;
+
+  always_comb begin : proc_refill
+    state_d           = state_q;
+    refill_line_d     = refill_line_q;
+    refill_prefetch_d = refill_prefetch_q;
+    refill_drop_d     = refill_drop_q | invalidate;
+    refill_err_d      = refill_err_q;
+    refill_ecc_err_d  = refill_ecc_err_q;
+    err_line_d        = err_line_q;
+    err_valid_d       = err_valid_q;
+    beat_d            = beat_q;
+    install           = 1'b0;
+    count_miss        = 1'b0;
+
+    axi_req_o          = '0;
+    axi_req_o.ar.addr  = AxiAddrWidth'({refill_line_q, {OffsetWidth{1'b0}}});
+    axi_req_o.ar.len   = axi_pkg::len_t'(LineBeats-1);
+    axi_req_o.ar.size  = axi_pkg::size_t'($clog2(AxiDataWidth/8));
+    axi_req_o.ar.burst = axi_pkg::BURST_INCR;
+    axi_req_o.ar.cache = 4'b0010;
+    axi_req_o.ar.prot  = 3'b100; // Instruction access
+    axi_req_o.ar.user  = AxiUser;
+    axi_req_o.b_ready  = 1'b1;
+
+    unique case (state_q)
+      Idle: begin
+        // Demand miss
+        if (core_req_i.req && core_cacheable && !core_hit &&
+            !(err_valid_q && err_line_q == core_line)) begin
+          state_d           = RefillAr;
+          refill_line_d     = core_line;
+          refill_prefetch_d = 1'b0;
+          refill_drop_d     = 1'b0;
+          refill_err_d      = 1'b0;
+          refill_ecc_err_d  = 1'b0;
+          count_miss        = 1'b1;
+        end
+      end
+      RefillAr: begin
+        axi_req_o.ar_valid = 1'b1;
+        if (axi_rsp_i.ar_ready) begin
+          state_d = RefillR;
+          beat_d  = '0;
+        end
+      end
+      RefillR: begin
+        axi_req_o.r_ready = 1'b1;
+        if (axi_rsp_i.r_valid) begin
+          beat_d       = beat_q + 1;
+          refill_err_d = refill_err_q |
+                         (axi_rsp_i.r.resp inside {axi_pkg::RESP_SLVERR, axi_pkg::RESP_DECERR});
+          refill_ecc_err_d = refill_ecc_err_q |
+                             (AxiUserEccErr && axi_rsp_i.r.user[AxiUserEccErrBit]);
+          if (axi_rsp_i.r.last) begin
+            state_d = Idle;
+            if (refill_err_d) begin
+              // Report the error to the waiting fetch, prefetch errors are dropped silently
+              if (!refill_prefetch_q) begin
+                err_valid_d = 1'b1;
+                err_line_d  = refill_line_q;
+              end
+            end else if (!refill_drop_d) begin
+              install = 1'b1;
+              // Sequential prefetch of the next line, unless it leaves the cacheable region
+              if (prefetch_en_q && !refill_prefetch_q && enable_q && !line_present(next_line) &&
+                  is_cacheable({next_line, {OffsetWidth{1'b0}}})) begin
+                state_d           = RefillAr;
+                refill_line_d     = next_line;
+                refill_prefetch_d = 1'b1;
+                refill_drop_d     = 1'b0;
+                refill_err_d      = 1'b0;
+                refill_ecc_err_d  = 1'b0;
+              end
+            end
+          end
+        end
+      end
+      default: state_d = Idle;
+    endcase
+
+    if (cache_err_gnt) begin
+      err_valid_d = 1'b0;
+    end
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_refill_state
+    if (!rst_ni) begin
+      state_q           <= Idle;
+      refill_line_q     <= '0;
+      refill_prefetch_q <= 1'b0;
+      refill_drop_q     <= 1'b0;
+      refill_err_q      <= 1'b0;
+      refill_ecc_err_q  <= 1'b0;
+      err_line_q        <= '0;
+      err_valid_q       <= 1'b0;
+      beat_q            <= '0;
+    end else begin
+      state_q           <= state_d;
+      refill_line_q     <= refill_line_d;
+      refill_prefetch_q <= refill_prefetch_d;
+      refill_drop_q     <= refill_drop_d;
+      refill_err_q      <= refill_err_d;
+      refill_ecc_err_q  <= refill_ecc_err_d;
+      err_line_q        <= err_line_d;
+      err_valid_q       <= err_valid_d;
+      beat_q            <= beat_d;
+    end
+  end
+
+  always_ff @(posedge clk_i) begin : proc_refill_data
+    if (state_q == RefillR && axi_rsp_i.r_valid) begin
+      refill_data_q[beat_q*AxiDataWidth +: AxiDataWidth] <= axi_rsp_i.r.data;
+    end
+  end
+
+  // The line is installed with the last beat, which is not yet in `refill_data_q`
+  always_comb begin : proc_install_data
+    install_data                                      = refill_data_q;
+    install_data[beat_q*AxiDataWidth +: AxiDataWidth] = axi_rsp_i.r.data;
+  end
+
+  // -----------------
+  // Cached responses
+  // -----------------
+
+  // Hits are served while a refill or prefetch for another line is in flight
+  assign cache_gnt     = core_req_i.req && core_cacheable && bypass_idle && core_hit;
+  assign cache_err_gnt = core_req_i.req && core_cacheable && bypass_idle && !core_hit &&
+                         err_valid_q && err_line_q == core_line;
+  assign count_hit     = cache_gnt;
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_cache_rsp
+    if (!rst_ni) begin
+      rsp_valid_q <= 1'b0;
+      rsp_err_q     <= 1'b0;
+      rsp_ecc_err_q <= 1'b0;
+      rsp_rdata_q   <= '0;
+      rsp_rid_q     <= '0;
+    end else begin
+      rsp_valid_q   <= cache_gnt || cache_err_gnt;
+      rsp_err_q     <= cache_err_gnt;
+      rsp_ecc_err_q <= cache_gnt && ecc_err_q[addr_idx(core_line)];
+      rsp_rid_q     <= core_req_i.a.aid;
+      if (cache_gnt) begin
+        rsp_rdata_q <= data_q[addr_idx(core_line)][core_req_i.a.addr[OffsetWidth-1:2]*32 +: 32];
+      end
+    end
+  end
+
+  always_comb begin : proc_core_rsp
+    core_rsp_o = bypass_rsp_i;
+    core_rsp_o.gnt = core_cacheable ? (cache_gnt || cache_err_gnt) :
+                                      bypass_rsp_i.gnt && !bypass_full;
+    if (rsp_valid_q) begin
+      core_rsp_o.rvalid       = 1'b1;
+      core_rsp_o.r            = '0;
+      core_rsp_o.r.rdata      = rsp_rdata_q;
+      core_rsp_o.r.err        = rsp_err_q;
+      core_rsp_o.r.r_optional.ruser[0] = rsp_ecc_err_q;
+      core_rsp_o.r.rid        = rsp_rid_q;
+    end
+  end
+
+  // pragma translate_off
+  `ifndef SYNTHESIS
+  `ifndef VERILATOR
+  initial begin : proc_assert
+    assert (LineBytes >= AxiDataWidth/8 && LineBytes % (AxiDataWidth/8) == 0) else
+      $fatal(1, "LineBytes has to be a multiple of the AXI data width!");
+    assert (2**$clog2(LineBytes) == LineBytes && 2**$clog2(NumLines) == NumLines) else
+      $fatal(1, "LineBytes and NumLines have to be powers of two!");
+    assert (LineBeats <= 256) else $fatal(1, "A line has to fit into a single AXI burst!");
+  end
+  `endif
+  `endif
+  // pragma translate_on
+
+endmodule
@@ -0,0 +1,185 @@
+// Copyright 2024 ETH Zurich and University of Bologna.
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License.  You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+// Interrupt latency timestamps on the core-local register bus.
+//
+// Each of the `NumSlots` slots follows one CLIC source and stamps a free-running cycle counter
+// - when the source rises (ASSERT),
+// - on the first `irq_valid`/`irq_ready` handshake of the source (HANDSHAKE), i.e. when the core
+//   takes it through hardware vectoring or claims it,
+// - with CLAIM set, on the next handshake of the source (CLAIM), i.e. when a non-vectored handler
+//   claims it through `mnxti`. Otherwise the sample completes with the first handshake.
+// The last `Depth` completed samples of each slot are kept in a ring. A rise of the source while a
+// sample is open is counted as missed.
+//
+// Register map (32-bit registers), slot s at 0x100*(s+1):
+//   0x000             CYCLES             free-running cycle counter
+//   +0x000            SEL[s]             [IdWidth-1:0] source, [30] CLAIM, [31] enable,
+//                                        a write clears the slot
+//   +0x004            COUNT[s]           completed samples, the last is in SAMPLE[(COUNT-1)%Depth]
+//   +0x008            MISSED[s]          rises of the source while a sample was open
+//   +0x010+0x10*k     SAMPLE[s][k]       +0x0 ASSERT, +0x4 HANDSHAKE, +0x8 CLAIM (0 without CLAIM)
+
+module safety_island_irq_timestamp #(
+  parameter int unsigned NumSources = 96,
+  parameter int unsigned NumSlots   = 2,
+  parameter int unsigned Depth      = 4,
+  parameter int unsigned IdWidth    = $clog2(NumSources),
+  parameter type         reg_req_t  = logic,
+  parameter type         reg_rsp_t  = logic
+) (
+  input  logic                  clk_i,
+  input  logic                  rst_ni,
+
+  input  reg_req_t              reg_req_i,
+  output reg_rsp_t              reg_rsp_o,
+
+  input  logic [NumSources-1:0] intr_src_i,
+  input  logic                  irq_valid_i,
+  input  logic                  irq_ready_i,
+  input  logic [IdWidth-1:0]    irq_id_i
+);
+
+  localparam int unsigned IdxWidth = cf_math_pkg::idx_width(Depth);
+
+  typedef enum logic [1:0] {
+    Idle,
+    Asserted,
+    Taken
+  } slot_state_e;
+
+  logic [31:0]        cycles_q;
+  logic               enable_q  [NumSlots];
+  logic               claim_q   [NumSlots];
+  logic [IdWidth-1:0] src_q     [NumSlots];
+  logic               prev_q    [NumSlots];
+  slot_state_e        state_q   [NumSlots];
+  logic [31:0]        assert_q  [NumSlots];
+  logic [31:0]        hs_q      [NumSlots];
+  logic [31:0]        count_q   [NumSlots];
+  logic [31:0]        missed_q  [NumSlots];
+  logic [IdxWidth-1:0] wr_idx_q [NumSlots];
+  logic [31:0]        sample_q  [NumSlots][Depth][3];
+
+  logic       reg_write;
+  logic [9:0] reg_word;
+  logic       slot_valid, sample_valid;
+  logic [3:0] slot_idx, sample_idx;
+
+  assign reg_write    = reg_req_i.valid && reg_req_i.write;
+  assign reg_word     = reg_req_i.addr[11:2];
+  assign slot_idx     = reg_word[9:6] - 4'h1;
+  assign sample_idx   = reg_word[5:2] - 4'h1;
+  assign slot_valid   = reg_word[9:6] != '0 && slot_idx < NumSlots;
+  assign sample_valid = slot_valid && reg_word[5:2] != '0 && sample_idx < Depth &&
+                        reg_word[1:0] != 2'h3;
+
+  always_comb begin : proc_reg_read
+    reg_rsp_o.ready = 1'b1;
+    reg_rsp_o.error = 1'b0;
+    reg_rsp_o.rdata = '0;
+    if (reg_word == 10'h0) begin
+      reg_rsp_o.rdata = cycles_q;
+    end else if (slot_valid && reg_word[5:2] == '0) begin
+      unique case (reg_word[1:0])
+        2'h0:    reg_rsp_o.rdata = {enable_q[slot_idx], claim_q[slot_idx], (30-IdWidth)'(0),
+                                    src_q[slot_idx]};
+        2'h1:    reg_rsp_o.rdata = count_q[slot_idx];
+        2'h2:    reg_rsp_o.rdata = missed_q[slot_idx];
+        default: reg_rsp_o.error = 1'b1;
+      endcase
+    end else if (sample_valid) begin
+      reg_rsp_o.rdata = sample_q[slot_idx][sample_idx][reg_word[1:0]];
+    end else begin
+      reg_rsp_o.error = 1'b1;
+    end
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_cycles
+    if (!rst_ni) begin
+      cycles_q <= '0;
+    end else begin
+      cycles_q <= cycles_q + 1;
+    end
+  end
+
+  for (genvar s = 0; s < NumSlots; s++) begin : gen_slot
+    logic sel_write, rise, handshake, complete;
+
+    assign sel_write = reg_write && slot_valid && slot_idx == s && reg_word[5:0] == '0;
+    assign rise      = enable_q[s] && intr_src_i[src_q[s]] && !prev_q[s];
+    assign handshake = enable_q[s] && irq_valid_i && irq_ready_i && irq_id_i == src_q[s];
+    assign complete  = handshake && (state_q[s] == Taken ||
+                                     (state_q[s] == Asserted && !claim_q[s]));
+
+    always_ff @(posedge clk_i or negedge rst_ni) begin : proc_slot
+      if (!rst_ni) begin
+        enable_q[s]  <= 1'b0;
+        claim_q[s]   <= 1'b0;
+        src_q[s]     <= '0;
+        prev_q[s]    <= 1'b0;
+        state_q[s]   <= Idle;
+        assert_q[s]  <= '0;
+        hs_q[s]      <= '0;
+        count_q[s]   <= '0;
+        missed_q[s]  <= '0;
+        wr_idx_q[s]  <= '0;
+        sample_q[s]  <= '{default: '0};
+      end else if (sel_write) begin
+        enable_q[s]  <= reg_req_i.wdata[31];
+        claim_q[s]   <= reg_req_i.wdata[30];
+        src_q[s]     <= reg_req_i.wdata[IdWidth-1:0];
+        // No rise for a source that is already asserted
+        prev_q[s]    <= 1'b1;
+        state_q[s]   <= Idle;
+        count_q[s]   <= '0;
+        missed_q[s]  <= '0;
+        wr_idx_q[s]  <= '0;
+        sample_q[s]  <= '{default: '0};
+      end else begin
+        prev_q[s] <= intr_src_i[src_q[s]];
+
+        unique case (state_q[s])
+          Idle: begin
+            // A handshake without a rise belongs to an assertion before the slot was enabled
+            if (rise) begin
+              state_q[s]  <= Asserted;
+              assert_q[s] <= cycles_q;
+            end
+          end
+          Asserted: begin
+            if (handshake) begin
+              state_q[s] <= claim_q[s] ? Taken : Idle;
+              hs_q[s]    <= cycles_q;
+            end
+          end
+          default: begin
+            if (handshake) begin
+              state_q[s] <= Idle;
+            end
+          end
+        endcase
+
+        if (complete) begin
+          sample_q[s][wr_idx_q[s]] <= '{assert_q[s],
+                                        state_q[s] == Taken ? hs_q[s] : cycles_q,
+                                        state_q[s] == Taken ? cycles_q : 32'h0};
+          wr_idx_q[s] <= wr_idx_q[s] == IdxWidth'(Depth-1) ? '0 : wr_idx_q[s] + 1;
+          count_q[s]  <= count_q[s] + 1;
+        end
+
+        if (rise && state_q[s] != Idle && missed_q[s] != '1) begin
+          missed_q[s] <= missed_q[s] + 1;
+        end
+      end
+    end
+  end
+
+endmodule
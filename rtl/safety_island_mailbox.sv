@@ -0,0 +1,95 @@
+// Copyright 2024 ETH Zurich and University of Bologna.
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License.  You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+// SCMI shared-memory mailbox with doorbell and completion interrupts.
+//
+// Each agent has one channel with the layout of `sw/tests/runtime_shared/include/scmi.h`
+// (10 32-bit registers, 0x28 bytes per channel):
+//   0x00 RESERVED_1, 0x04 CHANNEL_STATUS, 0x08 RESERVED_2, 0x0C RESERVED_3, 0x10 CHANNEL_FLAGS,
+//   0x14 LENGTH, 0x18 MESSAGE_HEADER, 0x1C MESSAGE_PAYLOAD_1, 0x20 DOORBELL,
+//   0x24 COMPLETION_INTERRUPT
+// Reserved registers read as zero. CHANNEL_STATUS resets to a free channel. A set bit 0 of a
+// DOORBELL raises `doorbell_irq_o` towards the island until the island clears it. A set bit 0 of
+// COMPLETION_INTERRUPT raises the channel's `completion_irqs_o` towards the agent if the agent
+// enabled interrupts in bit 0 of CHANNEL_FLAGS, until the agent clears it.
+
+module safety_island_mailbox #(
+  parameter int unsigned NumChannels = 2,
+  parameter type         reg_req_t   = logic,
+  parameter type         reg_rsp_t   = logic
+) (
+  input  logic                   clk_i,
+  input  logic                   rst_ni,
+
+  input  reg_req_t               reg_req_i,
+  output reg_rsp_t               reg_rsp_o,
+
+  output logic                   doorbell_irq_o,
+  output logic [NumChannels-1:0] completion_irqs_o
+);
+
+  localparam int unsigned NumChannelRegs = 10;
+
+  localparam int unsigned RegChannelStatus = 1;
+  localparam int unsigned RegChannelFlags  = 4;
+  localparam int unsigned RegDoorbell      = 8;
+  localparam int unsigned RegCompletion    = 9;
+
+  // Reserved registers are not stored
+  function automatic bit is_reserved(int unsigned idx);
+    return idx == 0 || idx == 2 || idx == 3;
+  endfunction
+
+  logic [31:0] regs_q [NumChannels][NumChannelRegs];
+
+  logic [10:0] reg_word;
+  int unsigned channel, channel_reg;
+  logic        reg_valid;
+
+  assign reg_word    = reg_req_i.addr[12:2];
+  assign channel     = reg_word / NumChannelRegs;
+  assign channel_reg = reg_word % NumChannelRegs;
+  assign reg_valid   = channel < NumChannels;
+
+  always_comb begin : proc_reg_read
+    reg_rsp_o.ready = 1'b1;
+    reg_rsp_o.error = !reg_valid;
+    reg_rsp_o.rdata = '0;
+    if (reg_valid && !is_reserved(channel_reg)) begin
+      reg_rsp_o.rdata = regs_q[channel][channel_reg];
+    end
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_regs
+    if (!rst_ni) begin
+      for (int unsigned c = 0; c < NumChannels; c++) begin
+        regs_q[c] <= '{default: '0};
+        // Channel free
+        regs_q[c][RegChannelStatus] <= 32'h1;
+      end
+    end else if (reg_req_i.valid && reg_req_i.write && reg_valid &&
+                 !is_reserved(channel_reg)) begin
+      for (int unsigned b = 0; b < 4; b++) begin
+        if (reg_req_i.wstrb[b]) begin
+          regs_q[channel][channel_reg][8*b+:8] <= reg_req_i.wdata[8*b+:8];
+        end
+      end
+    end
+  end
+
+  always_comb begin : proc_irqs
+    doorbell_irq_o = 1'b0;
+    for (int unsigned c = 0; c < NumChannels; c++) begin
+      doorbell_irq_o       |= regs_q[c][RegDoorbell][0];
+      completion_irqs_o[c]  = regs_q[c][RegCompletion][0] && regs_q[c][RegChannelFlags][0];
+    end
+  end
+
+endmodule
@@ -0,0 +1,221 @@
+// Copyright 2024 ETH Zurich and University of Bologna.
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License.  You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+// Island-level performance monitor on the core-local register bus.
+//
+// The counters run while enabled. A snapshot copies all counters at once, and all counter
+// registers read the last snapshot, so a set of values is consistent.
+//
+// Register map (32-bit registers):
+//   0x000      CTRL          [0] enable (RW), [1] clear counters (W1), [2] snapshot (W1)
+//   0x004      CYCLES        cycles while enabled
+//   0x008      IRQ_ACKS      interrupts taken by the core
+//   0x00C      IRQ_LAT_SUM   cycles from an interrupt request of the CLIC to its acknowledge
+//   0x010      IRQ_LAT_MAX   maximum of the above
+//   0x014      ECC_CORR      corrected ECC errors of all banks (accesses and scrubber)
+//   0x040+8*m  MGR_GNT[m]    granted requests of crossbar manager m
+//   0x044+8*m  MGR_STALL[m]  cycles manager m requests without grant
+//   0x080+4*b  BANK_CONF[b]  cycles with more than one manager requesting bank b
+//   0x100+4*i  AXI_RD_LAT[i] AXI output read latency histogram
+//   0x120+4*i  AXI_WR_LAT[i] AXI output write latency histogram
+// The latency bins are [0,4), [4,8), [8,16), ..., [128,256) and >= 256 cycles from the grant to
+// the response on the crossbar side of the AXI output.
+
+module safety_island_perf_mon #(
+  parameter int unsigned NumManagers = 6,
+  parameter int unsigned NumBanks    = 2,
+  /// Outstanding transactions on the AXI output
+  parameter int unsigned MaxTrans    = 2,
+  parameter type         reg_req_t   = logic,
+  parameter type         reg_rsp_t   = logic
+) (
+  input  logic                   clk_i,
+  input  logic                   rst_ni,
+  input  logic                   testmode_i,
+
+  input  reg_req_t               reg_req_i,
+  output reg_rsp_t               reg_rsp_o,
+
+  // Crossbar managers
+  input  logic [NumManagers-1:0] mgr_req_i,
+  input  logic [NumManagers-1:0] mgr_gnt_i,
+  // Memory banks
+  input  logic [NumBanks-1:0]    bank_conflict_i,
+  input  logic [NumBanks-1:0]    ecc_corr_i,
+  // AXI output (OBI side, in order)
+  input  logic                   axi_out_req_i,
+  input  logic                   axi_out_gnt_i,
+  input  logic                   axi_out_we_i,
+  input  logic                   axi_out_rvalid_i,
+  // CLIC to core handshake
+  input  logic                   irq_valid_i,
+  input  logic                   irq_ready_i
+);
+
+  localparam int unsigned NumLatBins = 8;
+
+  localparam int unsigned CntCycles    = 0;
+  localparam int unsigned CntIrqAcks   = 1;
+  localparam int unsigned CntIrqLatSum = 2;
+  localparam int unsigned CntIrqLatMax = 3;
+  localparam int unsigned CntEccCorr   = 4;
+  localparam int unsigned CntMgr       = 5;
+  localparam int unsigned CntBank      = CntMgr + 2*NumManagers;
+  localparam int unsigned CntRdLat     = CntBank + NumBanks;
+  localparam int unsigned CntWrLat     = CntRdLat + NumLatBins;
+  localparam int unsigned NumCounters  = CntWrLat + NumLatBins;
+
+  logic        enable_q;
+  logic [31:0] cnt_d  [NumCounters];
+  logic [31:0] cnt_q  [NumCounters];
+  logic [31:0] snap_q [NumCounters];
+
+  // -----------------
+  // Register interface
+  // -----------------
+
+  logic       reg_write, ctrl_write, clear, snapshot;
+  logic [9:0] reg_word;
+  logic       cnt_valid;
+  int unsigned cnt_idx;
+
+  assign reg_write  = reg_req_i.valid && reg_req_i.write;
+  assign reg_word   = reg_req_i.addr[11:2];
+  assign ctrl_write = reg_write && reg_word == 10'h0;
+  assign clear      = ctrl_write && reg_req_i.wdata[1];
+  assign snapshot   = ctrl_write && reg_req_i.wdata[2];
+
+  always_comb begin : proc_cnt_idx
+    cnt_valid = 1'b1;
+    cnt_idx   = 0;
+    if (reg_word >= 10'h1 && reg_word <= 10'h5) begin
+      cnt_idx = CntCycles + reg_word - 10'h1;
+    end else if (reg_word >= 10'h10 && reg_word < 10'h10 + 2*NumManagers) begin
+      cnt_idx = CntMgr + reg_word - 10'h10;
+    end else if (reg_word >= 10'h20 && reg_word < 10'h20 + NumBanks) begin
+      cnt_idx = CntBank + reg_word - 10'h20;
+    end else if (reg_word >= 10'h40 && reg_word < 10'h40 + 2*NumLatBins) begin
+      cnt_idx = CntRdLat + reg_word - 10'h40;
+    end else begin
+      cnt_valid = 1'b0;
+    end
+  end
+
+  always_comb begin : proc_reg_read
+    reg_rsp_o.ready = 1'b1;
+    reg_rsp_o.error = 1'b0;
+    reg_rsp_o.rdata = '0;
+    if (reg_word == 10'h0) begin
+      reg_rsp_o.rdata = {31'b0, enable_q};
+    end else if (cnt_valid) begin
+      reg_rsp_o.error = reg_req_i.write;
+      reg_rsp_o.rdata = snap_q[cnt_idx];
+    end else begin
+      reg_rsp_o.error = 1'b1;
+    end
+  end
+
+  // -----------------
+  // Events
+  // -----------------
+
+  // Interrupt latency
+  logic [31:0] irq_lat_q;
+  logic        irq_ack;
+
+  assign irq_ack = irq_valid_i && irq_ready_i;
+
+  // AXI output latency, the OBI responses return in order
+  logic [15:0] now_q, lat_start, lat;
+  logic        lat_we, lat_empty;
+  logic [$clog2(NumLatBins)-1:0] lat_bin;
+
+  fifo_v3 #(
+    .FALL_THROUGH ( 1'b0     ),
+    .DATA_WIDTH   ( 17       ),
+    .DEPTH        ( MaxTrans )
+  ) i_lat_fifo (
+    .clk_i,
+    .rst_ni,
+    .flush_i    ( 1'b0       ),
+    .testmode_i,
+    .full_o     (),
+    .empty_o    ( lat_empty  ),
+    .usage_o    (),
+    .data_i     ( {axi_out_we_i, now_q} ),
+    .push_i     ( axi_out_req_i && axi_out_gnt_i ),
+    .data_o     ( {lat_we, lat_start}   ),
+    .pop_i      ( axi_out_rvalid_i && !lat_empty )
+  );
+
+  assign lat = now_q - lat_start;
+
+  always_comb begin : proc_lat_bin
+    lat_bin = NumLatBins-1;
+    for (int i = NumLatBins-2; i >= 0; i--) begin
+      if (lat < (16'd4 << i)) begin
+        lat_bin = i;
+      end
+    end
+  end
+
+  always_comb begin : proc_cnt
+    cnt_d = cnt_q;
+    if (enable_q) begin
+      cnt_d[CntCycles] = cnt_q[CntCycles] + 1;
+      if (irq_ack) begin
+        cnt_d[CntIrqAcks]   = cnt_q[CntIrqAcks] + 1;
+        cnt_d[CntIrqLatSum] = cnt_q[CntIrqLatSum] + irq_lat_q;
+        if (irq_lat_q > cnt_q[CntIrqLatMax]) begin
+          cnt_d[CntIrqLatMax] = irq_lat_q;
+        end
+      end
+      cnt_d[CntEccCorr] = cnt_q[CntEccCorr] + $countones(ecc_corr_i);
+      for (int unsigned m = 0; m < NumManagers; m++) begin
+        cnt_d[CntMgr+2*m]   = cnt_q[CntMgr+2*m]   + (mgr_req_i[m] &&  mgr_gnt_i[m]);
+        cnt_d[CntMgr+2*m+1] = cnt_q[CntMgr+2*m+1] + (mgr_req_i[m] && !mgr_gnt_i[m]);
+      end
+      for (int unsigned b = 0; b < NumBanks; b++) begin
+        cnt_d[CntBank+b] = cnt_q[CntBank+b] + bank_conflict_i[b];
+      end
+      if (axi_out_rvalid_i && !lat_empty) begin
+        if (lat_we) begin
+          cnt_d[CntWrLat+lat_bin] = cnt_q[CntWrLat+lat_bin] + 1;
+        end else begin
+          cnt_d[CntRdLat+lat_bin] = cnt_q[CntRdLat+lat_bin] + 1;
+        end
+      end
+    end
+    if (clear) begin
+      cnt_d = '{default: '0};
+    end
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_perf_mon
+    if (!rst_ni) begin
+      enable_q  <= 1'b0;
+      cnt_q     <= '{default: '0};
+      snap_q    <= '{default: '0};
+      irq_lat_q <= '0;
+      now_q     <= '0;
+    end else begin
+      if (ctrl_write) begin
+        enable_q <= reg_req_i.wdata[0];
+      end
+      cnt_q <= cnt_d;
+      if (snapshot) begin
+        snap_q <= cnt_q;
+      end
+      irq_lat_q <= irq_valid_i && !irq_ready_i ? irq_lat_q + 1 : '0;
+      now_q     <= now_q + 1;
+    end
+  end
+
+endmodule
@@ -23,7 +23,16 @@ package safety_island_pkg;
     PeriphDebug,
     PeriphEccManager,
     PeriphTimer,
-    PeriphCoreLocal
+    PeriphCoreLocal,
+    PeriphICache,
+    PeriphSensorDma,
+    PeriphStoreMerge,
+    PeriphMailbox,
+    PeriphXbarQos,
+    PeriphBankInit,
+    PeriphScrubCtrl,
+    PeriphEccLog,
+    PeriphSchedTable
 `ifdef TARGET_SIMULATION
     ,
     PeriphTBPrintf
@@ -35,9 +44,28 @@ package safety_island_pkg;
     RegbusOutCLIC,
     RegbusOutInstrErr,
     RegbusOutDataErr,
-    RegbusOutShadowErr
+    RegbusOutShadowErr,
+    RegbusOutPerfMon,
+    RegbusOutTclsResync,
+    RegbusOutSplitCtrl,
+    RegbusOutIrqTimestamp,
+    RegbusOutTrace,
+    RegbusOutSplitErr
   } cl_regbus_outputs_e;
 
+  // Harts in addition to hart 0 in split mode, each with its own crossbar instruction and data
+  // manager
+  localparam int unsigned NumSplitHarts = 2;
+
+  // Island-internal interrupts, connected to CLIC lines 22 and up
+  localparam int unsigned NumPeriphInterrupts = 10;
+  typedef enum int {
+    PeriphIrqSensorDma,
+    PeriphIrqMailbox,
+    PeriphIrqEccLog,
+    PeriphIrqSchedTable // First of SchedTableNumIrqs lines
+  } periph_irqs_e;
+
   // Address map of safety_island
   typedef struct packed {
       logic [31:0] idx;
@@ -55,13 +83,38 @@ package safety_island_pkg;
   localparam bit [31:0] DebugAddrOffset         = 32'h0000_3000;
   localparam bit [31:0] DebugAddrRange         = 32'h0000_1000;
   localparam bit [31:0] EccManagerAddrOffset    = 32'h0000_4000;
-  localparam bit [31:0] EccManagerAddrRange    = 32'h0000_0040; // Temporary for 2 banks
+  localparam bit [31:0] EccManagerAddrRange    = 32'h0000_2000; // Max. 256 banks
   localparam bit [31:0] TBPrintfAddrOffset      = 32'h0000_6000;
   localparam bit [31:0] TBPrintfAddrRange      = 32'h0000_1000;
+  localparam bit [31:0] ICacheAddrOffset        = 32'h0000_7000;
+  localparam bit [31:0] ICacheAddrRange        = 32'h0000_1000;
   localparam bit [31:0] TimerAddrOffset         = 32'h0000_8000;
-  localparam bit [31:0] TimerAddrRange         = 32'h0000_5000;
+  localparam bit [31:0] TimerAddrRange         = 32'h0000_5000; // Max. 5 timers
   localparam bit [31:0] CoreLocalAddrOffset     = 32'h0000_D000;
   localparam bit [31:0] CoreLocalAddrRange     = 32'h0002_3000;
+  localparam bit [31:0] SensorDmaAddrOffset     = 32'h0003_0000;
+  localparam bit [31:0] SensorDmaAddrRange     = 32'h0000_1000;
+  localparam bit [31:0] StoreMergeAddrOffset    = 32'h0003_1000;
+  localparam bit [31:0] StoreMergeAddrRange    = 32'h0000_1000;
+  localparam bit [31:0] MailboxAddrOffset       = 32'h0003_2000;
+  localparam bit [31:0] MailboxAddrRange       = 32'h0000_2000; // Max. 204 channels
+  localparam bit [31:0] XbarQosAddrOffset       = 32'h0003_4000;
+  localparam bit [31:0] XbarQosAddrRange       = 32'h0000_1000;
+  localparam bit [31:0] BankInitAddrOffset      = 32'h0003_5000;
+  localparam bit [31:0] BankInitAddrRange      = 32'h0000_1000;
+  localparam bit [31:0] ScrubCtrlAddrOffset     = 32'h0003_6000;
+  localparam bit [31:0] ScrubCtrlAddrRange     = 32'h0000_1000; // Max. 120 banks
+  localparam bit [31:0] EccLogAddrOffset        = 32'h0003_7000;
+  localparam bit [31:0] EccLogAddrRange        = 32'h0000_1000;
+  localparam bit [31:0] SchedTableAddrOffset    = 32'h0003_8000;
+  localparam bit [31:0] SchedTableAddrRange    = 32'h0000_1000;
+
+  // Each memory bank has its own ECC manager register window, only
+  // `NumBanks * EccManagerBankAddrRange` of the ECC manager range is decoded
+  localparam bit [31:0] EccManagerBankAddrRange = 32'h0000_0020;
+
+  // Each timer occupies one window of the timer range
+  localparam bit [31:0] TimerUnitAddrRange = 32'h0000_1000;
 
   // Core-Local offsets and ranges
   localparam bit [31:0] TCLSAddrOffset  = CoreLocalAddrOffset;
@@ -74,16 +127,31 @@ package safety_island_pkg;
   localparam bit [31:0] DataErrRange   = 32'h0000_0020;
   localparam bit [31:0] ShadowErrOffset = 32'h0002_0020;
   localparam bit [31:0] ShadowErrRange = 32'h0000_0030;
+  localparam bit [31:0] PerfMonOffset   = 32'h0002_1000;
+  localparam bit [31:0] PerfMonRange   = 32'h0000_1000;
+  localparam bit [31:0] TclsResyncOffset = 32'h0002_2000;
+  localparam bit [31:0] TclsResyncRange = 32'h0000_1000;
+  localparam bit [31:0] SplitCtrlOffset = 32'h0002_3000;
+  localparam bit [31:0] SplitCtrlRange  = 32'h0000_1000;
+  localparam bit [31:0] IrqTimestampOffset = 32'h0002_4000;
+  localparam bit [31:0] IrqTimestampRange  = 32'h0000_1000;
+  localparam bit [31:0] TraceOffset        = 32'h0002_5000;
+  localparam bit [31:0] TraceRange         = 32'h0000_1000;
+  // Instruction and data bus error registers of harts 1 and 2 in split mode, 0x20 per hart
+  localparam bit [31:0] SplitErrOffset     = 32'h0002_6000;
+  localparam bit [31:0] SplitErrRange      = 32'h0000_1000;
 
   typedef struct packed {
     int unsigned              HartId;
     int unsigned              BankNumBytes;
     int unsigned              NumBanks;
     int unsigned              PulpJtagIdCode;
-    int unsigned              NumTimers;         // Number of Timers. Warning:
-                                                 // currently, we only support
-                                                 // one. TODO: Make the timer
-                                                 // instantiation configurable.
+    int unsigned              NumTimers;         // Number of timers (max. 5),
+                                                 // each with its own
+                                                 // `TimerUnitAddrRange` window
+    int unsigned              UseRegTimer;       // Timers on the register interface
+                                                 // with 64-bit snapshot reads
+    int unsigned              NumTimerEvents;    // Dedicated timer event inputs
                                                  // CV32RT configuration
     int unsigned              UseClic;           // use CLIC or legacy CLINT
     int unsigned              ClicIntCtlBits;    // Number of bits for
@@ -105,10 +173,66 @@ package safety_island_pkg;
                                                  // FPU instead of a dedicated
                                                  // FP RF
     int unsigned              UseTCLS;           // Use Triple-core Lockstep
+    int unsigned              UseTclsResync;     // TCLS resynchronization assist
+    int unsigned              UseSplitMode;      // Runtime switch of the TCLS cores
+                                                 // to independent harts
     int unsigned              NumInterrupts;     // Number of input interrupts
                                                  // to the safety island
     int unsigned              NumMhpmCounters;   // Number of performance
                                                  // counters implemented in CV32
+    int unsigned              UseICache;         // Instruction cache for fetches
+                                                 // outside of the island
+    int unsigned              ICacheNumLines;    // Number of instruction cache lines
+    int unsigned              ICacheLineBytes;   // Bytes per instruction cache line
+    int unsigned              AxiInMaxTrans;     // Outstanding transactions on the
+                                                 // AXI input
+    int unsigned              AxiOutMaxTrans;    // Outstanding transactions on the
+                                                 // AXI output
+    int unsigned              XbarMaxTrans;      // Outstanding transactions per
+                                                 // crossbar manager port
+    int unsigned              UseDataFastPath;   // Direct path of the core data port
+                                                 // to core-local periphs and timers
+    int unsigned              PeriphMaxTrans;    // Outstanding transactions to the
+                                                 // peripherals
+    int unsigned              UseSensorDma;      // Timer-triggered sensor readout DMA
+    int unsigned              SensorDmaNumDesc;  // Number of sensor DMA descriptors
+    int unsigned              UseWriteBuffer;    // Posted-write buffer on the AXI
+                                                 // output
+    int unsigned              WriteBufferEntries;    // Buffered write bursts
+    int unsigned              WriteBufferBurstWords; // Maximum words per buffered
+                                                     // write burst
+    int unsigned              UseWideAxiIn;      // Full-width AXI input path into
+                                                 // word-interleaved sub-banks
+    int unsigned              UseStoreMerge;     // Store-merge buffer in front of
+                                                 // each memory bank
+    int unsigned              UseBankInit;       // Zero-initialization engine per
+                                                 // memory bank
+    int unsigned              BankInitOnReset;   // Initialize the banks after reset
+    int unsigned              UseScrubCtrl;      // Adaptive scrubbing in idle bank
+                                                 // cycles
+    int unsigned              UseEccLog;         // ECC event log and interrupt
+    int unsigned              EccLogDepth;       // ECC events kept in the log
+    int unsigned              UseSchedTable;     // Time-triggered activation table
+    int unsigned              SchedTableNumIrqs; // Interrupt lines of the table
+                                                 // (max. 7)
+    int unsigned              SchedTableEntries; // Activations per table (max. 32)
+    int unsigned              UseAmoUnit;        // Near-memory AMO unit per memory
+                                                 // bank
+    int unsigned              AmoUnitEntries;    // Words held by each AMO unit
+    int unsigned              UsePerfMon;        // Island-level performance monitor
+    int unsigned              UseIrqTimestamp;   // Interrupt latency timestamps
+    int unsigned              IrqTimestampSlots; // Interrupt sources followed at a time
+    int unsigned              IrqTimestampDepth; // Samples kept per source
+    int unsigned              UseTrace;          // Branch trace encoder of the
+                                                 // core fetches
+    int unsigned              TraceFifoDepth;    // Trace packets buffered before
+                                                 // stalling the core
+    int unsigned              UseXbarQos;        // Priority and bandwidth-budget
+                                                 // arbitration of the crossbar
+    int unsigned              UseMailbox;        // SCMI shared-memory mailbox
+    int unsigned              MailboxNumChannels; // Mailbox channels, one per agent
+    int unsigned              NumHostIrqs;       // Interrupt lines to the host
+                                                 // (max. 32)
   } safety_island_cfg_t;
 
   localparam safety_island_cfg_t SafetyIslandDefaultConfig = '{
@@ -122,6 +246,8 @@ package safety_island_pkg;
     // Version                    [31:28]: 4'h1
     PulpJtagIdCode:     32'h1_0000_db3,
     NumTimers:          1,
+    UseRegTimer:        0,
+    NumTimerEvents:     4,
     UseClic:            1,
     ClicIntCtlBits:     8,
     UseSSClic:          0,
@@ -135,16 +261,57 @@ package safety_island_pkg;
     UseXPulp:           1,
     UseZfinx:           1,
     UseTCLS:            1,
+    UseTclsResync:      0,
+    UseSplitMode:       0,
     NumInterrupts:      64,
-    NumMhpmCounters:    1
+    NumMhpmCounters:    6,
+    UseICache:          0,
+    ICacheNumLines:     8,
+    ICacheLineBytes:    32,
+    AxiInMaxTrans:      2,
+    AxiOutMaxTrans:     2,
+    XbarMaxTrans:       2,
+    UseDataFastPath:    0,
+    PeriphMaxTrans:     2,
+    UseSensorDma:       0,
+    SensorDmaNumDesc:   8,
+    UseWriteBuffer:     0,
+    WriteBufferEntries: 4,
+    WriteBufferBurstWords: 8,
+    UseWideAxiIn:       0,
+    UseStoreMerge:      0,
+    UseBankInit:        0,
+    BankInitOnReset:    1,
+    UseScrubCtrl:       0,
+    UseEccLog:          0,
+    EccLogDepth:        8,
+    UseSchedTable:      0,
+    SchedTableNumIrqs:  4,
+    SchedTableEntries:  16,
+    UseAmoUnit:         0,
+    AmoUnitEntries:     4,
+    UsePerfMon:         0,
+    UseIrqTimestamp:    0,
+    IrqTimestampSlots:  2,
+    IrqTimestampDepth:  4,
+    UseTrace:           0,
+    TraceFifoDepth:     4,
+    UseXbarQos:         0,
+    UseMailbox:         0,
+    MailboxNumChannels: 2,
+    NumHostIrqs:        4
   };
 
-  localparam int unsigned NumTimerInterrupts = 2*SafetyIslandDefaultConfig.NumTimers;
-  // localparam int unsigned NumLocalInterrupts = SafetyIslandDefaultConfig.NumInterrupts - NumTimerInterrupts;
+  // Outstanding transactions on the AXI output, including instruction cache refills and
+  // buffered write bursts
+  function automatic int unsigned axi_out_max_trans(safety_island_cfg_t cfg);
+    return cfg.AxiOutMaxTrans + cfg.UseICache + cfg.UseWriteBuffer * cfg.WriteBufferEntries;
+  endfunction
 
-  // 1 AXI cut, 1-cycle response
-  localparam int unsigned AxiMaxInTrans = 3;
-  // Cores do not support more than 2 outstanding transactions
-  localparam int unsigned AxiMaxOutTrans = 2;
+  // Managers of the AXI output: the crossbar, the instruction cache and the posted-write buffer,
+  // told apart by the MSBs of the AXI ID
+  function automatic int unsigned axi_out_num_ports(safety_island_cfg_t cfg);
+    return 1 + cfg.UseICache + cfg.UseWriteBuffer;
+  endfunction
 
 endpackage
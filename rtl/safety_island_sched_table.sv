@@ -0,0 +1,231 @@
+// Copyright 2024 ETH Zurich and University of Bologna.
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License.  You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+// Time-triggered activation table.
+//
+// While enabled, the frame time counts ticks of the clock or of the synchronized ref_clk, divided
+// by PRESCALER+1, and restarts at zero after FRAME_LEN ticks (the major frame). The active table
+// holds up to `NumEntries` activations sorted by ascending offset; when the frame time reaches the
+// offset of the next activation, the interrupt lines of its mask pulse for one cycle. Activations
+// with the same offset are issued in one pulse with the OR of their masks, offsets at or above
+// FRAME_LEN never.
+// There are two tables: software fills the inactive one and writes SWITCH, and the tables swap at
+// the next frame boundary. Writes to the active table respond with an error while enabled.
+//
+// Register map (32-bit registers), table t at 0x400+0x400*t, at most 32 entries:
+//   0x000          CTRL         [0] enable, starting from frame time 0 with the table of [2],
+//                               [1] count ref_clk instead of clk_i, [2] active table (read-only
+//                               while enabled)
+//   0x004          STATUS       [0] switch pending, [1] active table
+//   0x008          SWITCH       writing 1 swaps the tables at the next frame boundary
+//   0x00C          PRESCALER    ticks per time unit minus 1
+//   0x010          TIME         frame time
+//   0x014          FRAMES       completed frames, saturating, cleared on write
+//   +0x000         FRAME_LEN[t] frame length in time units
+//   +0x004         COUNT[t]     activations in the table
+//   +0x100+8*e     OFFSET[t][e] frame time of activation e
+//   +0x104+8*e     MASK[t][e]   interrupt lines of activation e
+
+module safety_island_sched_table #(
+  parameter int unsigned NumIrqs    = 4,
+  parameter int unsigned NumEntries = 16,
+  parameter type         reg_req_t  = logic,
+  parameter type         reg_rsp_t  = logic
+) (
+  input  logic               clk_i,
+  input  logic               rst_ni,
+  input  logic               ref_clk_i,
+
+  input  reg_req_t           reg_req_i,
+  output reg_rsp_t           reg_rsp_o,
+
+  output logic [NumIrqs-1:0] irq_o
+);
+
+  localparam int unsigned EntryIdxWidth = cf_math_pkg::idx_width(NumEntries+1);
+
+  logic                     enable_q, ref_en_q, table_q, pending_q;
+  logic [31:0]              presc_q, presc_cnt_q, time_q, frames_q;
+  logic [31:0]              len_q    [2];
+  logic [EntryIdxWidth-1:0] count_q  [2];
+  logic [31:0]              offset_q [2][NumEntries];
+  logic [NumIrqs-1:0]       mask_q   [2][NumEntries];
+  logic [EntryIdxWidth-1:0] next_q, next_d;
+  logic [NumIrqs-1:0]       fire_mask;
+
+  logic       reg_write;
+  logic [9:0] reg_word;
+  logic       tbl_sel, tbl_access, tbl_valid, entry_access;
+  logic [7:0] entry_idx;
+  logic       ref_clk_sync, ref_clk_q, tick, frame_end;
+
+  assign reg_write    = reg_req_i.valid && reg_req_i.write;
+  assign reg_word     = reg_req_i.addr[11:2];
+  assign tbl_sel      = reg_word[9];
+  assign tbl_access   = reg_word[9] ^ reg_word[8];
+  assign entry_access = reg_word[7:6] == 2'b01;
+  assign entry_idx    = 8'(reg_word[5:1]);
+  assign tbl_valid    = tbl_access &&
+                        (entry_access ? entry_idx < NumEntries : reg_word[7:0] <= 8'h1);
+
+  always_comb begin : proc_reg_read
+    reg_rsp_o.ready = 1'b1;
+    reg_rsp_o.error = 1'b0;
+    reg_rsp_o.rdata = '0;
+    if (reg_word[9:8] == 2'b00) begin
+      unique case (reg_word)
+        10'h0:   reg_rsp_o.rdata = {29'b0, table_q, ref_en_q, enable_q};
+        10'h1:   reg_rsp_o.rdata = {30'b0, table_q, pending_q};
+        10'h2:   reg_rsp_o.rdata = {31'b0, pending_q};
+        10'h3:   reg_rsp_o.rdata = presc_q;
+        10'h4:   reg_rsp_o.rdata = time_q;
+        10'h5:   reg_rsp_o.rdata = frames_q;
+        default: reg_rsp_o.error = 1'b1;
+      endcase
+    end else if (tbl_valid) begin
+      if (!entry_access) begin
+        reg_rsp_o.rdata = reg_word[0] ? 32'(count_q[tbl_sel]) : len_q[tbl_sel];
+      end else begin
+        reg_rsp_o.rdata = reg_word[0] ? 32'(mask_q[tbl_sel][entry_idx]) :
+                                        offset_q[tbl_sel][entry_idx];
+      end
+      // The active table is read-only while enabled
+      reg_rsp_o.error = reg_req_i.write && enable_q && tbl_sel == table_q;
+    end else begin
+      reg_rsp_o.error = 1'b1;
+    end
+  end
+
+  // -----------------
+  // Frame time
+  // -----------------
+
+  sync #(
+    .STAGES ( 2 )
+  ) i_ref_clk_sync (
+    .clk_i,
+    .rst_ni,
+    .serial_i ( ref_clk_i    ),
+    .serial_o ( ref_clk_sync )
+  );
+
+  assign tick      = enable_q && (ref_en_q ? ref_clk_sync && !ref_clk_q : 1'b1) &&
+                     presc_cnt_q >= presc_q;
+  assign frame_end = tick && time_q + 1 >= len_q[table_q];
+
+  // All activations due at the frame time, from the next one on, are issued together
+  always_comb begin : proc_fire
+    next_d    = next_q;
+    fire_mask = '0;
+    for (int unsigned e = 0; e < NumEntries; e++) begin
+      if (enable_q && e >= next_q && e < count_q[table_q] &&
+          offset_q[table_q][e] <= time_q && offset_q[table_q][e] < len_q[table_q]) begin
+        next_d    = EntryIdxWidth'(e + 1);
+        fire_mask = fire_mask | mask_q[table_q][e];
+      end
+    end
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_frame
+    if (!rst_ni) begin
+      enable_q    <= 1'b0;
+      ref_en_q    <= 1'b0;
+      table_q     <= 1'b0;
+      pending_q   <= 1'b0;
+      presc_q     <= '0;
+      presc_cnt_q <= '0;
+      time_q      <= '0;
+      frames_q    <= '0;
+      next_q      <= '0;
+      ref_clk_q   <= 1'b0;
+      irq_o       <= '0;
+    end else begin
+      ref_clk_q <= ref_clk_sync;
+      irq_o     <= fire_mask;
+
+      if (reg_write && reg_word == 10'h3) begin
+        presc_q <= reg_req_i.wdata;
+      end
+      if (reg_write && reg_word == 10'h5) begin
+        frames_q <= '0;
+      end else if (frame_end && frames_q != '1) begin
+        frames_q <= frames_q + 1;
+      end
+
+      if (reg_write && reg_word == 10'h0) begin
+        enable_q <= reg_req_i.wdata[0];
+        ref_en_q <= reg_req_i.wdata[1];
+        if (!enable_q) begin
+          table_q <= reg_req_i.wdata[2];
+        end
+        if (reg_req_i.wdata[0] && !enable_q) begin
+          // A new frame
+          presc_cnt_q <= '0;
+          time_q      <= '0;
+          next_q      <= '0;
+          pending_q   <= 1'b0;
+        end
+      end else begin
+        if (enable_q && (ref_en_q ? ref_clk_sync && !ref_clk_q : 1'b1)) begin
+          presc_cnt_q <= tick ? '0 : presc_cnt_q + 1;
+        end
+        if (frame_end) begin
+          time_q <= '0;
+          next_q <= '0;
+          if (pending_q) begin
+            table_q   <= !table_q;
+            pending_q <= 1'b0;
+          end
+        end else begin
+          if (tick) begin
+            time_q <= time_q + 1;
+          end
+          next_q <= next_d;
+        end
+        if (reg_write && reg_word == 10'h2 && reg_req_i.wdata[0]) begin
+          pending_q <= 1'b1;
+        end
+      end
+    end
+  end
+
+  // -----------------
+  // Tables
+  // -----------------
+
+  for (genvar t = 0; t < 2; t++) begin : gen_table
+    logic tbl_write;
+
+    assign tbl_write = reg_write && tbl_valid && tbl_sel == t && !(enable_q && table_q == t);
+
+    always_ff @(posedge clk_i or negedge rst_ni) begin : proc_table
+      if (!rst_ni) begin
+        len_q   [t] <= '0;
+        count_q [t] <= '0;
+        offset_q[t] <= '{default: '0};
+        mask_q  [t] <= '{default: '0};
+      end else if (tbl_write) begin
+        if (!entry_access) begin
+          if (reg_word[0]) begin
+            count_q[t] <= reg_req_i.wdata > NumEntries ? EntryIdxWidth'(NumEntries) :
+                                                         EntryIdxWidth'(reg_req_i.wdata);
+          end else begin
+            len_q[t] <= reg_req_i.wdata;
+          end
+        end else if (reg_word[0]) begin
+          mask_q[t][entry_idx] <= reg_req_i.wdata[NumIrqs-1:0];
+        end else begin
+          offset_q[t][entry_idx] <= reg_req_i.wdata;
+        end
+      end
+    end
+  end
+
+endmodule
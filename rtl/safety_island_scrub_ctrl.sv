@@ -0,0 +1,190 @@
+// Copyright 2024 ETH Zurich and University of Bologna.
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License.  You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+// Adaptive scrub policy of the memory banks.
+//
+// While enabled, the scrub triggers of the banks are generated here instead of by the ECC manager.
+// A bank is only triggered in a cycle without a request to it, at least `ScrubCycles` cycles plus
+// the bank's current interval after its last trigger. The interval starts at MAX_INTERVAL, drops
+// to MIN_INTERVAL on any corrected error of the bank (scrub fix or single error on access) and
+// doubles after each sweep without one. A sweep covers all `NumWords` words of the bank.
+// The scrubber then holds the bank for `ScrubCycles` cycles and cannot be preempted, so a request
+// arriving in the cycles after the trigger still stalls. The policy avoids stalls in the trigger
+// cycle and scrubs less often while the bank is busy, but does not remove them.
+// Stall cycles of the bank port within `ScrubCycles` of a trigger are counted, also while
+// disabled, to compare with the fixed interval of the ECC manager.
+//
+// Register map (32-bit registers), bank b at 0x100+0x20*b:
+//   0x000          CTRL             [0] enable
+//   0x004          MIN_INTERVAL     reset 0
+//   0x008          MAX_INTERVAL     reset 1023
+//   +0x00          INTERVAL[b]      current interval in cycles
+//   +0x04          SWEEPS[b]        completed sweeps
+//   +0x08          SWEEP_CYCLES[b]  cycles of the last sweep
+//   +0x0C          SWEEP_FIXES[b]   corrected errors during the last sweep
+//   +0x10          STALLS[b]        stall cycles of the bank port next to a scrub, cleared on write
+// The counters saturate.
+
+module safety_island_scrub_ctrl #(
+  parameter int unsigned NumBanks    = 2,
+  parameter int unsigned NumWords    = 16384,
+  /// Cycles the scrubber occupies after a trigger (read, check, write back)
+  parameter int unsigned ScrubCycles = 3,
+  parameter type         reg_req_t   = logic,
+  parameter type         reg_rsp_t   = logic
+) (
+  input  logic                clk_i,
+  input  logic                rst_ni,
+
+  input  reg_req_t            reg_req_i,
+  output reg_rsp_t            reg_rsp_o,
+
+  input  logic [NumBanks-1:0] bank_req_i,
+  input  logic [NumBanks-1:0] bank_stall_i,
+  input  logic [NumBanks-1:0] fix_i,
+
+  input  logic [NumBanks-1:0] trigger_i,
+  output logic [NumBanks-1:0] trigger_o
+);
+
+  localparam int unsigned WordIdxWidth = cf_math_pkg::idx_width(NumWords);
+
+  logic        enable_q;
+  logic [31:0] min_q, max_q;
+
+  logic [31:0]             interval_q     [NumBanks];
+  logic [31:0]             wait_q         [NumBanks];
+  logic [WordIdxWidth-1:0] word_q         [NumBanks];
+  logic [31:0]             cycles_q       [NumBanks];
+  logic [31:0]             fixes_q        [NumBanks];
+  logic [31:0]             sweeps_q       [NumBanks];
+  logic [31:0]             last_cycles_q  [NumBanks];
+  logic [31:0]             last_fixes_q   [NumBanks];
+  logic [31:0]             stalls_q       [NumBanks];
+  logic [ScrubCycles-2:0]  active_q       [NumBanks];
+
+  logic       reg_write;
+  logic [9:0] reg_word;
+  logic       bank_valid, enable_write;
+  logic [7:0] bank_idx;
+
+  assign reg_write    = reg_req_i.valid && reg_req_i.write;
+  assign reg_word     = reg_req_i.addr[11:2];
+  assign bank_idx     = 8'((reg_word - 10'h40) >> 3);
+  assign bank_valid   = reg_word >= 10'h40 && bank_idx < NumBanks && reg_word[2:0] <= 3'h4;
+  assign enable_write = reg_write && reg_word == 10'h0 && reg_req_i.wdata[0] && !enable_q;
+
+  always_comb begin : proc_reg_read
+    reg_rsp_o.ready = 1'b1;
+    reg_rsp_o.error = 1'b0;
+    reg_rsp_o.rdata = '0;
+    if (reg_word == 10'h0) begin
+      reg_rsp_o.rdata = {31'b0, enable_q};
+    end else if (reg_word == 10'h1) begin
+      reg_rsp_o.rdata = min_q;
+    end else if (reg_word == 10'h2) begin
+      reg_rsp_o.rdata = max_q;
+    end else if (bank_valid) begin
+      unique case (reg_word[2:0])
+        3'h0:    reg_rsp_o.rdata = interval_q   [bank_idx];
+        3'h1:    reg_rsp_o.rdata = sweeps_q     [bank_idx];
+        3'h2:    reg_rsp_o.rdata = last_cycles_q[bank_idx];
+        3'h3:    reg_rsp_o.rdata = last_fixes_q [bank_idx];
+        default: reg_rsp_o.rdata = stalls_q     [bank_idx];
+      endcase
+    end else begin
+      reg_rsp_o.error = 1'b1;
+    end
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_ctrl
+    if (!rst_ni) begin
+      enable_q <= 1'b0;
+      min_q    <= '0;
+      max_q    <= 32'd1023;
+    end else if (reg_write) begin
+      unique case (reg_word)
+        10'h0:   enable_q <= reg_req_i.wdata[0];
+        10'h1:   min_q    <= reg_req_i.wdata;
+        10'h2:   max_q    <= reg_req_i.wdata;
+        default: ;
+      endcase
+    end
+  end
+
+  for (genvar b = 0; b < NumBanks; b++) begin : gen_bank
+    logic trigger, sweep_done, stalls_write;
+
+    assign trigger      = enable_q && !bank_req_i[b] &&
+                          wait_q[b] >= interval_q[b] + ScrubCycles;
+    assign sweep_done   = trigger && word_q[b] == WordIdxWidth'(NumWords-1);
+    assign stalls_write = reg_write && bank_valid && bank_idx == b && reg_word[2:0] == 3'h4;
+
+    assign trigger_o[b] = enable_q ? trigger : trigger_i[b];
+
+    always_ff @(posedge clk_i or negedge rst_ni) begin : proc_bank
+      if (!rst_ni) begin
+        interval_q   [b] <= '0;
+        wait_q       [b] <= '0;
+        word_q       [b] <= '0;
+        cycles_q     [b] <= '0;
+        fixes_q      [b] <= '0;
+        sweeps_q     [b] <= '0;
+        last_cycles_q[b] <= '0;
+        last_fixes_q [b] <= '0;
+        stalls_q     [b] <= '0;
+        active_q     [b] <= '0;
+      end else begin
+        active_q[b] <= {active_q[b], trigger_o[b]};
+
+        if (stalls_write) begin
+          stalls_q[b] <= '0;
+        end else if (bank_stall_i[b] && (|active_q[b] || trigger_o[b]) && stalls_q[b] != '1) begin
+          stalls_q[b] <= stalls_q[b] + 1;
+        end
+
+        if (enable_write) begin
+          // A new sweep from the start of the bank at the slowest rate
+          interval_q[b] <= max_q;
+          wait_q    [b] <= '0;
+          word_q    [b] <= '0;
+          cycles_q  [b] <= '0;
+          fixes_q   [b] <= '0;
+        end else if (enable_q) begin
+          wait_q  [b] <= trigger ? '0 : wait_q[b] + (wait_q[b] != '1);
+          cycles_q[b] <= cycles_q[b] + (cycles_q[b] != '1);
+          if (fix_i[b] && fixes_q[b] != '1) begin
+            fixes_q[b] <= fixes_q[b] + 1;
+          end
+
+          if (fix_i[b]) begin
+            interval_q[b] <= min_q;
+          end else if (sweep_done && fixes_q[b] == '0) begin
+            interval_q[b] <= interval_q[b] >= max_q >> 1 ? max_q : 2*interval_q[b] + 1;
+          end
+
+          if (trigger) begin
+            word_q[b] <= sweep_done ? '0 : word_q[b] + 1;
+          end
+          if (sweep_done) begin
+            cycles_q     [b] <= '0;
+            fixes_q      [b] <= '0;
+            last_cycles_q[b] <= cycles_q[b] + 1;
+            last_fixes_q [b] <= fixes_q[b] + (fix_i[b] && fixes_q[b] != '1);
+            if (sweeps_q[b] != '1) begin
+              sweeps_q[b] <= sweeps_q[b] + 1;
+            end
+          end
+        end
+      end
+    end
+  end
+
+endmodule
@@ -0,0 +1,295 @@
+// Copyright 2024 ETH Zurich and University of Bologna.
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License.  You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+// Timer-triggered sensor readout DMA.
+//
+// On a trigger, the descriptor list is executed in order: each descriptor copies `LEN` 32-bit
+// words starting at `SRC` (typically sensor registers behind the AXI output) into a ring buffer
+// in the island memory. The engine is a manager on the main crossbar and issues one word at a
+// time. The interrupt pulses once the whole list is done or a bus error aborted it, so it
+// should be configured as edge-triggered in the CLIC.
+//
+// Register map (32-bit registers):
+//   0x00 CTRL       [0] enable, [1] irq enable, [2] timer trigger enable,
+//                   [3] timer select (0: timer lo, 1: timer hi)
+//   0x04 TRIGGER    writing [0]=1 starts the descriptor list, reads as 0
+//   0x08 STATUS     [0] busy (read-only), [1] bus error, [2] trigger dropped while busy,
+//                   error bits are cleared by writing 1
+//   0x0C RING_BASE  ring buffer base address (word aligned)
+//   0x10 RING_SIZE  ring buffer size in bytes (multiple of 4)
+//   0x14 RING_WPTR  byte offset of the next ring buffer write, writable to reset
+//   0x18 NUM_DESC   number of valid descriptors
+//   0x1C DONE_COUNT number of completed descriptor lists, cleared on write
+//   0x40+8*i        DESC_SRC[i] source address of descriptor i
+//   0x44+8*i        DESC_LEN[i] number of words of descriptor i
+
+module safety_island_sensor_dma #(
+  /// Number of descriptors
+  parameter int unsigned NumDesc   = 8,
+  parameter type         obi_req_t = logic,
+  parameter type         obi_rsp_t = logic,
+  parameter type         reg_req_t = logic,
+  parameter type         reg_rsp_t = logic
+) (
+  input  logic     clk_i,
+  input  logic     rst_ni,
+
+  // Timer compare events
+  input  logic     timer_lo_i,
+  input  logic     timer_hi_i,
+
+  // Manager port on the main crossbar
+  output obi_req_t obi_req_o,
+  input  obi_rsp_t obi_rsp_i,
+
+  // Configuration
+  input  reg_req_t reg_req_i,
+  output reg_rsp_t reg_rsp_o,
+
+  output logic     irq_o
+);
+
+  localparam int unsigned DescIdxWidth = NumDesc > 1 ? $clog2(NumDesc) : 1;
+
+  typedef enum logic [2:0] {
+    Idle,
+    ReadReq,
+    ReadRsp,
+    WriteReq,
+    WriteRsp
+  } dma_state_e;
+
+  // -----------------
+  // Registers
+  // -----------------
+
+  logic        enable_q, irq_en_q, timer_en_q, timer_sel_q;
+  logic        bus_err_q, overrun_q;
+  logic [31:0] ring_base_q, ring_size_q, ring_wptr_q, num_desc_q, done_count_q;
+  logic [31:0] desc_src_q [NumDesc];
+  logic [31:0] desc_len_q [NumDesc];
+
+  logic        reg_write;
+  logic [9:0]  reg_word;
+  logic        busy, trigger, done, bus_err;
+  logic        ring_wptr_advance;
+  logic [31:0] ring_wptr_next;
+
+  assign reg_write = reg_req_i.valid && reg_req_i.write;
+  assign reg_word  = reg_req_i.addr[11:2];
+
+  always_comb begin : proc_reg_read
+    reg_rsp_o.ready = 1'b1;
+    reg_rsp_o.error = 1'b0;
+    reg_rsp_o.rdata = '0;
+    case (reg_word)
+      10'h0: reg_rsp_o.rdata = {28'b0, timer_sel_q, timer_en_q, irq_en_q, enable_q};
+      10'h1: reg_rsp_o.rdata = '0;
+      10'h2: reg_rsp_o.rdata = {29'b0, overrun_q, bus_err_q, busy};
+      10'h3: reg_rsp_o.rdata = ring_base_q;
+      10'h4: reg_rsp_o.rdata = ring_size_q;
+      10'h5: reg_rsp_o.rdata = ring_wptr_q;
+      10'h6: reg_rsp_o.rdata = num_desc_q;
+      10'h7: reg_rsp_o.rdata = done_count_q;
+      default: begin
+        if (reg_word >= 10'h10 && reg_word < 10'h10 + 2*NumDesc) begin
+          reg_rsp_o.rdata = reg_word[0] ? desc_len_q[(reg_word-10'h10)>>1] :
+                                          desc_src_q[(reg_word-10'h10)>>1];
+        end else begin
+          reg_rsp_o.error = 1'b1;
+        end
+      end
+    endcase
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_regs
+    if (!rst_ni) begin
+      enable_q     <= 1'b0;
+      irq_en_q     <= 1'b0;
+      timer_en_q   <= 1'b0;
+      timer_sel_q  <= 1'b0;
+      bus_err_q    <= 1'b0;
+      overrun_q    <= 1'b0;
+      ring_base_q  <= '0;
+      ring_size_q  <= '0;
+      ring_wptr_q  <= '0;
+      num_desc_q   <= '0;
+      done_count_q <= '0;
+      desc_src_q   <= '{default: '0};
+      desc_len_q   <= '{default: '0};
+    end else begin
+      if (reg_write) begin
+        case (reg_word)
+          10'h0: begin
+            enable_q    <= reg_req_i.wdata[0];
+            irq_en_q    <= reg_req_i.wdata[1];
+            timer_en_q  <= reg_req_i.wdata[2];
+            timer_sel_q <= reg_req_i.wdata[3];
+          end
+          10'h3: ring_base_q <= {reg_req_i.wdata[31:2], 2'b0};
+          10'h4: ring_size_q <= {reg_req_i.wdata[31:2], 2'b0};
+          10'h6: num_desc_q  <= reg_req_i.wdata;
+          default: begin
+            if (reg_word >= 10'h10 && reg_word < 10'h10 + 2*NumDesc) begin
+              if (reg_word[0]) desc_len_q[(reg_word-10'h10)>>1] <= reg_req_i.wdata;
+              else             desc_src_q[(reg_word-10'h10)>>1] <= {reg_req_i.wdata[31:2], 2'b0};
+            end
+          end
+        endcase
+      end
+
+      if (reg_write && reg_word == 10'h5) begin
+        ring_wptr_q <= {reg_req_i.wdata[31:2], 2'b0};
+      end else if (ring_wptr_advance) begin
+        ring_wptr_q <= ring_wptr_next;
+      end
+
+      if (reg_write && reg_word == 10'h7) begin
+        done_count_q <= '0;
+      end else if (done && !bus_err) begin
+        done_count_q <= done_count_q + 1;
+      end
+
+      if (reg_write && reg_word == 10'h2 && reg_req_i.wdata[1]) begin
+        bus_err_q <= 1'b0;
+      end else if (bus_err) begin
+        bus_err_q <= 1'b1;
+      end
+
+      if (reg_write && reg_word == 10'h2 && reg_req_i.wdata[2]) begin
+        overrun_q <= 1'b0;
+      end else if (trigger && busy) begin
+        overrun_q <= 1'b1;
+      end
+    end
+  end
+
+  // -----------------
+  // Trigger
+  // -----------------
+
+  logic timer_event;
+
+  assign timer_event = timer_en_q && (timer_sel_q ? timer_hi_i : timer_lo_i);
+  assign trigger     = enable_q && (timer_event ||
+                                    (reg_write && reg_word == 10'h1 && reg_req_i.wdata[0]));
+
+  // -----------------
+  // Transfer engine
+  // -----------------
+
+  dma_state_e        state_d, state_q;
+  logic [DescIdxWidth-1:0] desc_d, desc_q;
+  logic [31:0]       word_d, word_q;
+  logic [31:0]       data_d, data_q;
+
+  assign busy = state_q != Idle;
+
+  assign ring_wptr_next = ring_wptr_q + 32'd4 >= ring_size_q ? '0 : ring_wptr_q + 32'd4;
+
+  always_comb begin : proc_dma
+    state_d           = state_q;
+    desc_d            = desc_q;
+    word_d            = word_q;
+    data_d            = data_q;
+    done              = 1'b0;
+    bus_err           = 1'b0;
+    ring_wptr_advance = 1'b0;
+
+    obi_req_o              = '0;
+    obi_req_o.a.be         = '1;
+    obi_req_o.a.a_optional = '0;
+
+    case (state_q)
+      Idle: begin
+        if (trigger) begin
+          desc_d = '0;
+          word_d = '0;
+          if (num_desc_q == '0) begin
+            done = 1'b1;
+          end else begin
+            state_d = ReadReq;
+          end
+        end
+      end
+      ReadReq: begin
+        if (word_q >= desc_len_q[desc_q]) begin
+          // Descriptor done (or empty)
+          word_d = '0;
+          if (32'(desc_q) + 1 >= num_desc_q || 32'(desc_q) + 1 >= NumDesc) begin
+            done    = 1'b1;
+            state_d = Idle;
+          end else begin
+            desc_d = desc_q + 1;
+          end
+        end else begin
+          obi_req_o.req    = 1'b1;
+          obi_req_o.a.addr = desc_src_q[desc_q] + (word_q << 2);
+          obi_req_o.a.we   = 1'b0;
+          if (obi_rsp_i.gnt) begin
+            state_d = ReadRsp;
+          end
+        end
+      end
+      ReadRsp: begin
+        if (obi_rsp_i.rvalid) begin
+          data_d = obi_rsp_i.r.rdata;
+          if (obi_rsp_i.r.err) begin
+            bus_err = 1'b1;
+            done    = 1'b1;
+            state_d = Idle;
+          end else begin
+            state_d = WriteReq;
+          end
+        end
+      end
+      WriteReq: begin
+        obi_req_o.req     = 1'b1;
+        obi_req_o.a.addr  = ring_base_q + ring_wptr_q;
+        obi_req_o.a.we    = 1'b1;
+        obi_req_o.a.wdata = data_q;
+        if (obi_rsp_i.gnt) begin
+          state_d = WriteRsp;
+        end
+      end
+      WriteRsp: begin
+        if (obi_rsp_i.rvalid) begin
+          ring_wptr_advance = 1'b1;
+          word_d            = word_q + 1;
+          if (obi_rsp_i.r.err) begin
+            bus_err = 1'b1;
+            done    = 1'b1;
+            state_d = Idle;
+          end else begin
+            state_d = ReadReq;
+          end
+        end
+      end
+      default: state_d = Idle;
+    endcase
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_dma_state
+    if (!rst_ni) begin
+      state_q <= Idle;
+      desc_q  <= '0;
+      word_q  <= '0;
+      data_q  <= '0;
+    end else begin
+      state_q <= state_d;
+      desc_q  <= desc_d;
+      word_q  <= word_d;
+      data_q  <= data_d;
+    end
+  end
+
+  assign irq_o = irq_en_q && done;
+
+endmodule
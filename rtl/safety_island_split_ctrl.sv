@@ -0,0 +1,136 @@
+// Copyright 2024 ETH Zurich and University of Bologna.
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License.  You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+// Switch between TCLS and split mode on the core-local register bus.
+//
+// In split mode, the three cores run as independent harts. A write to MODE restarts all cores in
+// the written mode: the cores are held in setback until none of their bus ports has an outstanding
+// transaction, then the mode changes and the cores start at their BOOT_ADDR. Until the first
+// restart, the cores start at the island's boot address.
+//
+// Register map (32-bit registers):
+//   0x000      MODE          [0] split mode (RW), a write restarts the cores
+//   0x010+4*i  BOOT_ADDR[i]  boot address of hart i after a restart, hart 0 also for TCLS mode
+//   0x020      IRQ           software interrupt of each hart, reads pending, write 1 sets
+//   0x024      IRQ_CLR       write 1 clears the software interrupt of a hart
+// The software interrupts are level-sensitive; hart 0 receives its interrupt on CLIC line 3
+// (msip), harts 1 and 2 directly at the core.
+
+module safety_island_split_ctrl #(
+  parameter int unsigned NumHarts  = 3,
+  /// Core bus ports that must be idle before a restart
+  parameter int unsigned NumPorts  = 9,
+  parameter type         reg_req_t = logic,
+  parameter type         reg_rsp_t = logic
+) (
+  input  logic                           clk_i,
+  input  logic                           rst_ni,
+
+  input  reg_req_t                       reg_req_i,
+  output reg_rsp_t                       reg_rsp_o,
+
+  input  logic [31:0]                    boot_addr_i,
+
+  output logic                           split_o,
+  output logic                           setback_o,
+  output logic [NumHarts-1:0][31:0]      boot_addr_o,
+  output logic [NumHarts-1:0]            sw_irqs_o,
+
+  input  logic [NumPorts-1:0]            port_req_i,
+  input  logic [NumPorts-1:0]            port_gnt_i,
+  input  logic [NumPorts-1:0]            port_rvalid_i
+);
+
+  logic [31:0]              boot_addr_q [NumHarts];
+  logic                     restarted_q, drain_q, split_next_q;
+  logic [NumPorts-1:0][3:0] outstanding_q;
+
+  logic                     reg_write;
+  logic [9:0]               reg_word;
+  logic                     boot_addr_valid, ports_idle;
+
+  assign reg_write       = reg_req_i.valid && reg_req_i.write;
+  assign reg_word        = reg_req_i.addr[11:2];
+  assign boot_addr_valid = reg_word >= 10'h4 && reg_word < 10'h4 + NumHarts;
+
+  always_comb begin : proc_reg_read
+    reg_rsp_o.ready = 1'b1;
+    reg_rsp_o.error = 1'b0;
+    reg_rsp_o.rdata = '0;
+    if (reg_word == 10'h0) begin
+      reg_rsp_o.rdata = {31'b0, split_o};
+    end else if (boot_addr_valid) begin
+      reg_rsp_o.rdata = boot_addr_q[reg_word-10'h4];
+    end else if (reg_word == 10'h8) begin
+      reg_rsp_o.rdata = 32'(sw_irqs_o);
+    end else if (reg_word == 10'h9) begin
+      reg_rsp_o.error = !reg_req_i.write;
+    end else begin
+      reg_rsp_o.error = 1'b1;
+    end
+  end
+
+  always_comb begin : proc_ports_idle
+    ports_idle = 1'b1;
+    for (int unsigned p = 0; p < NumPorts; p++) begin
+      if (port_req_i[p] || outstanding_q[p] != '0) begin
+        ports_idle = 1'b0;
+      end
+    end
+  end
+
+  for (genvar i = 0; i < NumHarts; i++) begin : gen_boot_addr
+    assign boot_addr_o[i] = restarted_q ? boot_addr_q[i] : boot_addr_i;
+  end
+
+  assign setback_o = drain_q;
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_outstanding
+    if (!rst_ni) begin
+      outstanding_q <= '0;
+    end else begin
+      for (int unsigned p = 0; p < NumPorts; p++) begin
+        outstanding_q[p] <= outstanding_q[p] + (port_req_i[p] && port_gnt_i[p]) - port_rvalid_i[p];
+      end
+    end
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_regs
+    if (!rst_ni) begin
+      boot_addr_q  <= '{default: '0};
+      sw_irqs_o    <= '0;
+      split_o      <= 1'b0;
+      split_next_q <= 1'b0;
+      drain_q      <= 1'b0;
+      restarted_q  <= 1'b0;
+    end else begin
+      if (reg_write && boot_addr_valid) begin
+        boot_addr_q[reg_word-10'h4] <= reg_req_i.wdata;
+      end
+      if (reg_write && reg_word == 10'h8) begin
+        sw_irqs_o <= sw_irqs_o | reg_req_i.wdata[NumHarts-1:0];
+      end else if (reg_write && reg_word == 10'h9) begin
+        sw_irqs_o <= sw_irqs_o & ~reg_req_i.wdata[NumHarts-1:0];
+      end
+
+      // The cores stay in setback until the responses of all granted requests have returned, so
+      // no response reaches a restarted core.
+      if (reg_write && reg_word == 10'h0 && !drain_q) begin
+        split_next_q <= reg_req_i.wdata[0];
+        drain_q      <= 1'b1;
+      end else if (drain_q && ports_idle) begin
+        split_o     <= split_next_q;
+        drain_q     <= 1'b0;
+        restarted_q <= 1'b1;
+      end
+    end
+  end
+
+endmodule
@@ -0,0 +1,167 @@
+// Copyright 2024 ETH Zurich and University of Bologna.
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License.  You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+// Store-merge buffer in front of an ECC memory bank.
+//
+// The ECC protects full 32-bit words, so a partial (byte or halfword) write costs the bank a
+// read-modify-write. This buffer holds one partial word and merges further partial writes to the
+// same word into it. Once all bytes are present, it is written as a full word without the
+// read-modify-write. The word is written back as a partial write (a miss) when:
+// - a partial write to another word arrives,
+// - a read of the same word arrives,
+// - the bank has been idle for `FlushTimeout` cycles,
+// - or `flush_i` is set, which also stops buffering new words.
+// Requests and responses keep the timing of the bank: the read data is expected one cycle after
+// the grant.
+
+module safety_island_store_merge #(
+  parameter int unsigned AddrWidth    = 32,
+  /// Idle cycles until a buffered word is written back
+  parameter int unsigned FlushTimeout = 4
+) (
+  input  logic                 clk_i,
+  input  logic                 rst_ni,
+
+  input  logic                 enable_i,
+  input  logic                 flush_i,
+  output logic                 pending_o,
+  /// A partial write merged into the buffered word
+  output logic                 hit_o,
+  /// A buffered partial word written back with a read-modify-write
+  output logic                 miss_o,
+
+  // From the bank port
+  input  logic                 req_i,
+  input  logic                 we_i,
+  input  logic [AddrWidth-1:0] addr_i,
+  input  logic [31:0]          wdata_i,
+  input  logic [3:0]           be_i,
+  output logic                 gnt_o,
+  output logic [31:0]          rdata_o,
+
+  // To the memory
+  output logic                 req_o,
+  output logic                 we_o,
+  output logic [AddrWidth-1:0] addr_o,
+  output logic [31:0]          wdata_o,
+  output logic [3:0]           be_o,
+  input  logic                 gnt_i,
+  input  logic [31:0]          rdata_i
+);
+
+  localparam int unsigned TimeoutWidth = $clog2(FlushTimeout+1);
+
+  logic                   buf_valid_q;
+  logic [AddrWidth-1:2]   buf_addr_q;
+  logic [31:0]            buf_data_q;
+  logic [3:0]             buf_be_q;
+  logic [TimeoutWidth-1:0] idle_q;
+
+  logic        word_match, partial;
+  logic [31:0] merged_data;
+  logic [3:0]  merged_be;
+
+  // Buffer updates
+  logic        flush, capture, merge, clear;
+
+  assign word_match = buf_valid_q && addr_i[AddrWidth-1:2] == buf_addr_q;
+  assign partial    = we_i && be_i != 4'hF && be_i != 4'h0;
+  assign merged_be  = buf_be_q | be_i;
+  for (genvar i = 0; i < 4; i++) begin : gen_merge
+    assign merged_data[8*i+:8] = be_i[i] ? wdata_i[8*i+:8] : buf_data_q[8*i+:8];
+  end
+
+  assign pending_o = buf_valid_q;
+  assign rdata_o   = rdata_i;
+
+  always_comb begin : proc_merge
+    req_o   = req_i;
+    we_o    = we_i;
+    addr_o  = addr_i;
+    wdata_o = wdata_i;
+    be_o    = be_i;
+    gnt_o   = gnt_i;
+
+    flush   = 1'b0;
+    capture = 1'b0;
+    merge   = 1'b0;
+    clear   = 1'b0;
+    hit_o   = 1'b0;
+
+    if (buf_valid_q && (!enable_i || flush_i || (!req_i && idle_q == FlushTimeout) ||
+                        (req_i && !we_i && word_match) ||
+                        (req_i && partial && !word_match))) begin
+      // Write back the buffered word, the request waits
+      flush = 1'b1;
+    end else if (enable_i && !flush_i && req_i && partial) begin
+      if (!word_match) begin
+        // Buffer the word, no memory access
+        req_o   = 1'b0;
+        gnt_o   = 1'b1;
+        capture = 1'b1;
+      end else if (merged_be == 4'hF) begin
+        // Complete word, written without read-modify-write
+        wdata_o = merged_data;
+        be_o    = 4'hF;
+        clear   = gnt_i;
+        hit_o   = gnt_i;
+      end else begin
+        req_o = 1'b0;
+        gnt_o = 1'b1;
+        merge = 1'b1;
+        hit_o = 1'b1;
+      end
+    end else if (req_i && we_i && be_i == 4'hF && word_match) begin
+      // Full write supersedes the buffered bytes
+      clear = gnt_i;
+      hit_o = gnt_i;
+    end
+
+    if (flush) begin
+      req_o   = 1'b1;
+      we_o    = 1'b1;
+      addr_o  = {buf_addr_q, 2'b00};
+      wdata_o = buf_data_q;
+      be_o    = buf_be_q;
+      gnt_o   = 1'b0;
+    end
+  end
+
+  assign miss_o = flush && gnt_i;
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_buffer
+    if (!rst_ni) begin
+      buf_valid_q <= 1'b0;
+      buf_addr_q  <= '0;
+      buf_data_q  <= '0;
+      buf_be_q    <= '0;
+      idle_q      <= '0;
+    end else begin
+      if ((flush && gnt_i) || clear) begin
+        buf_valid_q <= 1'b0;
+      end else if (capture) begin
+        buf_valid_q <= 1'b1;
+        buf_addr_q  <= addr_i[AddrWidth-1:2];
+        buf_data_q  <= wdata_i;
+        buf_be_q    <= be_i;
+      end else if (merge) begin
+        buf_data_q  <= merged_data;
+        buf_be_q    <= merged_be;
+      end
+
+      if (req_i || !buf_valid_q) begin
+        idle_q <= '0;
+      end else if (idle_q != FlushTimeout) begin
+        idle_q <= idle_q + 1;
+      end
+    end
+  end
+
+endmodule
@@ -0,0 +1,81 @@
+// Copyright 2024 ETH Zurich and University of Bologna.
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License.  You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+// Control and hit/miss counters of the store-merge buffers.
+//
+// Register map (32-bit registers):
+//   0x00       CTRL      [0] enable
+//   0x10+8*i   HITS[i]   partial writes to bank i merged without read-modify-write
+//   0x14+8*i   MISSES[i] buffered partial words of bank i written with read-modify-write
+// The counters saturate and are cleared on write.
+
+module safety_island_store_merge_regs #(
+  parameter int unsigned NumBanks  = 2,
+  parameter type         reg_req_t = logic,
+  parameter type         reg_rsp_t = logic
+) (
+  input  logic                clk_i,
+  input  logic                rst_ni,
+
+  input  reg_req_t            reg_req_i,
+  output reg_rsp_t            reg_rsp_o,
+
+  output logic                enable_o,
+  input  logic [NumBanks-1:0] hit_i,
+  input  logic [NumBanks-1:0] miss_i
+);
+
+  logic        reg_write;
+  logic [9:0]  reg_word;
+  logic [31:0] hits_q   [NumBanks];
+  logic [31:0] misses_q [NumBanks];
+
+  assign reg_write = reg_req_i.valid && reg_req_i.write;
+  assign reg_word  = reg_req_i.addr[11:2];
+
+  always_comb begin : proc_reg_read
+    reg_rsp_o.ready = 1'b1;
+    reg_rsp_o.error = 1'b0;
+    reg_rsp_o.rdata = '0;
+    if (reg_word == 10'h0) begin
+      reg_rsp_o.rdata = {31'b0, enable_o};
+    end else if (reg_word >= 10'h4 && reg_word < 10'h4 + 2*NumBanks) begin
+      reg_rsp_o.rdata = reg_word[0] ? misses_q[(reg_word-10'h4)>>1] :
+                                      hits_q  [(reg_word-10'h4)>>1];
+    end else begin
+      reg_rsp_o.error = 1'b1;
+    end
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_regs
+    if (!rst_ni) begin
+      enable_o <= 1'b1;
+      hits_q   <= '{default: '0};
+      misses_q <= '{default: '0};
+    end else begin
+      if (reg_write && reg_word == 10'h0) begin
+        enable_o <= reg_req_i.wdata[0];
+      end
+      for (int unsigned i = 0; i < NumBanks; i++) begin
+        if (reg_write && reg_word == 10'h4 + 2*i) begin
+          hits_q[i] <= '0;
+        end else if (hit_i[i] && hits_q[i] != '1) begin
+          hits_q[i] <= hits_q[i] + 1;
+        end
+        if (reg_write && reg_word == 10'h5 + 2*i) begin
+          misses_q[i] <= '0;
+        end else if (miss_i[i] && misses_q[i] != '1) begin
+          misses_q[i] <= misses_q[i] + 1;
+        end
+      end
+    end
+  end
+
+endmodule
@@ -0,0 +1,166 @@
+// Copyright 2024 ETH Zurich and University of Bologna.
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License.  You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+// TCLS resynchronization assist on the core-local register bus.
+//
+// On a TCLS mismatch, the resynchronization handler stores the architectural state into the state
+// buffer and loads it back. The stores leave the lockstep through the voters of the HMR unit, so
+// the buffer holds the majority value of each register, and the loads return it to all three
+// cores alike. The buffer is a flip-flop array next to the cores, so the state neither crosses the
+// crossbar nor takes the read-modify-write path of the ECC banks. As a fault in the buffer would be
+// loaded into all three cores, each word is protected with a Hsiao SEC-DED code like the banks:
+// single-bit errors are corrected on read and counted, reads of words with double-bit errors
+// respond with an error.
+// The unit also measures the cycles from the resynchronization request to the write of RESUMED.
+//
+// Register map (32-bit registers):
+//   0x000      STATUS       [0] resynchronization pending (request seen, RESUMED not written)
+//   0x004      RESUMED      write to mark the resumed execution
+//   0x008      COUNT        completed resynchronizations
+//   0x00C      LAST_CYCLES  cycles from the request to RESUMED of the last resynchronization
+//   0x010      MAX_CYCLES   maximum of the above, cleared on write
+//   0x014      CORRECTED    state words read with a corrected error, saturating, cleared on write
+//   0x100+4*i  STATE[i]     state buffer
+
+module safety_island_tcls_resync #(
+  parameter int unsigned NumStateWords = 64,
+  parameter type         reg_req_t     = logic,
+  parameter type         reg_rsp_t     = logic
+) (
+  input  logic     clk_i,
+  input  logic     rst_ni,
+
+  input  reg_req_t reg_req_i,
+  output reg_rsp_t reg_rsp_o,
+
+  input  logic     resynch_req_i
+);
+
+  // Hsiao SEC-DED codeword of a state word
+  localparam int unsigned EccWidth = 32 + $clog2(32) + 2;
+  localparam int unsigned IdxWidth = cf_math_pkg::idx_width(NumStateWords);
+
+  logic [EccWidth-1:0] state_q [NumStateWords];
+  logic                pending_q, resynch_req_q;
+  logic [31:0]         count_q, cycles_q, last_cycles_q, max_cycles_q, corrected_q;
+
+  logic                reg_write, resumed;
+  logic [9:0]          reg_word;
+  logic                state_valid;
+  logic [IdxWidth-1:0] state_idx;
+  logic [31:0]         state_rdata, state_wdata;
+  logic [EccWidth-1:0] state_enc;
+  logic [1:0]          state_err;
+
+  assign reg_write   = reg_req_i.valid && reg_req_i.write;
+  assign reg_word    = reg_req_i.addr[11:2];
+  assign state_valid = reg_word >= 10'h40 && reg_word < 10'h40 + NumStateWords;
+  assign state_idx   = IdxWidth'(reg_word - 10'h40);
+  assign resumed     = reg_write && reg_word == 10'h1 && pending_q;
+
+  always_comb begin : proc_reg_read
+    reg_rsp_o.ready = 1'b1;
+    reg_rsp_o.error = 1'b0;
+    reg_rsp_o.rdata = '0;
+    unique case (reg_word)
+      10'h0:   reg_rsp_o.rdata = {31'b0, pending_q};
+      10'h1:   reg_rsp_o.error = !reg_req_i.write;
+      10'h2:   reg_rsp_o.rdata = count_q;
+      10'h3:   reg_rsp_o.rdata = last_cycles_q;
+      10'h4:   reg_rsp_o.rdata = max_cycles_q;
+      10'h5:   reg_rsp_o.rdata = corrected_q;
+      default: begin
+        if (state_valid) begin
+          reg_rsp_o.rdata = state_rdata;
+          // Partial writes merge with the stored word, so they fail on a double-bit error as well
+          reg_rsp_o.error = state_err[1] && !(reg_req_i.write && reg_req_i.wstrb == 4'hF);
+        end else begin
+          reg_rsp_o.error = 1'b1;
+        end
+      end
+    endcase
+  end
+
+  // -----------------
+  // State buffer
+  // -----------------
+
+  hsiao_ecc_dec #(
+    .DataWidth ( 32 )
+  ) i_state_dec (
+    .in         ( state_q[state_idx] ),
+    .out        ( state_rdata        ),
+    .syndrome_o (                    ),
+    .err_o      ( state_err          )
+  );
+
+  always_comb begin : proc_state_wdata
+    state_wdata = state_rdata;
+    for (int unsigned b = 0; b < 4; b++) begin
+      if (reg_req_i.wstrb[b]) begin
+        state_wdata[8*b+:8] = reg_req_i.wdata[8*b+:8];
+      end
+    end
+  end
+
+  hsiao_ecc_enc #(
+    .DataWidth ( 32 )
+  ) i_state_enc (
+    .in  ( state_wdata ),
+    .out ( state_enc   )
+  );
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_state
+    if (!rst_ni) begin
+      // The all-zero word is a valid codeword
+      state_q     <= '{default: '0};
+      corrected_q <= '0;
+    end else begin
+      if (reg_write && state_valid) begin
+        state_q[state_idx] <= state_enc;
+      end
+      if (reg_write && reg_word == 10'h5) begin
+        corrected_q <= '0;
+      end else if (reg_req_i.valid && state_valid && state_err[0] && corrected_q != '1) begin
+        corrected_q <= corrected_q + 1;
+      end
+    end
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_latency
+    if (!rst_ni) begin
+      resynch_req_q <= 1'b0;
+      pending_q     <= 1'b0;
+      count_q       <= '0;
+      cycles_q      <= '0;
+      last_cycles_q <= '0;
+      max_cycles_q  <= '0;
+    end else begin
+      resynch_req_q <= resynch_req_i;
+      if (resynch_req_i && !resynch_req_q && !pending_q) begin
+        pending_q <= 1'b1;
+        cycles_q  <= '0;
+      end else if (resumed) begin
+        pending_q     <= 1'b0;
+        count_q       <= count_q + 1;
+        last_cycles_q <= cycles_q;
+        if (cycles_q > max_cycles_q) begin
+          max_cycles_q <= cycles_q;
+        end
+      end else if (pending_q && cycles_q != '1) begin
+        cycles_q <= cycles_q + 1;
+      end
+      if (reg_write && reg_word == 10'h4) begin
+        max_cycles_q <= '0;
+      end
+    end
+  end
+
+endmodule
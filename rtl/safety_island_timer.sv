@@ -0,0 +1,280 @@
+// Copyright 2024 ETH Zurich and University of Bologna.
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License.  You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+// Timer with the register map of `apb_timer_unit` on the register interface.
+//
+// The timer has a lo and a hi channel, each a 32-bit counter with a compare register and its own
+// interrupt. With CFG_LO[31] set, both form a 64-bit counter controlled by CFG_LO, compared with
+// {CMP_HI, CMP_LO} and interrupting on the lo line. A read of SNAP_LO returns the lo counter and
+// latches the hi counter into SNAP_HI, so a 64-bit timestamp takes two reads without a retry.
+//
+// Each channel captures its counter on the selected edges of one of the `NumEvents` synchronous
+// event inputs, chosen by CAP_CFG[15:8]; sources without an input never capture. The count at the
+// last edge is kept in CAP and the one before in CAP_PREV, so firmware gets the exact time and
+// period of an external event without an interrupt per edge. In 64-bit mode, an edge selected by
+// CAP_CFG_LO latches both counters into the lo and hi registers, and CAP_CFG_HI is unused.
+//
+// Register map (32-bit registers):
+//   0x000  CFG_LO    [0] enable, [1] reset (self-clearing), [2] irq enable, [4] clear on compare,
+//                    [5] one shot, [6] prescaler enable, [7] count ref_clk, [15:8] prescaler,
+//                    [31] 64-bit mode
+//   0x004  CFG_HI    as CFG_LO, without [31]
+//   0x008  CNT_LO    counter, writable
+//   0x00C  CNT_HI
+//   0x010  CMP_LO    compare value
+//   0x014  CMP_HI
+//   0x018  START_LO  write to set the enable bit
+//   0x01C  START_HI
+//   0x020  RESET_LO  write to clear the counter (both in 64-bit mode)
+//   0x024  RESET_HI
+//   0x028  SNAP_LO   lo counter, a read latches the hi counter into SNAP_HI
+//   0x02C  SNAP_HI
+//   0x030  CAP_CFG_LO   [0] capture on rising edges, [1] on falling edges, [15:8] event source
+//   0x034  CAP_CFG_HI
+//   0x038  CAP_LO       counter at the last captured edge
+//   0x03C  CAP_HI
+//   0x040  CAP_PREV_LO  counter at the edge before
+//   0x044  CAP_PREV_HI
+//   0x048  CAP_COUNT_LO captured edges, saturating, cleared on write
+//   0x04C  CAP_COUNT_HI
+
+module safety_island_timer #(
+  parameter int unsigned NumEvents = 1,
+  parameter type         reg_req_t = logic,
+  parameter type         reg_rsp_t = logic
+) (
+  input  logic                 clk_i,
+  input  logic                 rst_ni,
+  input  logic                 ref_clk_i,
+
+  input  reg_req_t             reg_req_i,
+  output reg_rsp_t             reg_rsp_o,
+
+  /// Capture event inputs, synchronous to `clk_i`
+  input  logic [NumEvents-1:0] event_i,
+
+  output logic                 irq_lo_o,
+  output logic                 irq_hi_o
+);
+
+  localparam int unsigned CfgEnable   = 0;
+  localparam int unsigned CfgReset    = 1;
+  localparam int unsigned CfgIrqEn    = 2;
+  localparam int unsigned CfgCmpClr   = 4;
+  localparam int unsigned CfgOneShot  = 5;
+  localparam int unsigned CfgPrescEn  = 6;
+  localparam int unsigned CfgRefClkEn = 7;
+  localparam int unsigned Cfg64Bit    = 31;
+
+  localparam int unsigned CapRise     = 0;
+  localparam int unsigned CapFall     = 1;
+
+  logic [1:0][31:0] cfg_q, cfg_d, cnt_q, cnt_d, cmp_q, cmp_d;
+  logic [1:0][7:0]  presc_q, presc_d;
+  logic [1:0]       irq_q, irq_d;
+  logic [31:0]      snap_hi_q;
+  logic [1:0][15:0] cap_cfg_q, cap_cfg_d;
+  logic [1:0][31:0] cap_q, cap_d, cap_prev_q, cap_prev_d, cap_cnt_q, cap_cnt_d;
+  logic [1:0]       event_q, event_armed_q;
+
+  logic       reg_write, reg_read;
+  logic [9:0] reg_word;
+  logic       mode64, ref_clk_sync, ref_clk_q, ref_tick;
+  logic [1:0][31:0] ctrl;
+  logic [1:0] tick, hit, event_sel, capture;
+
+  assign reg_write = reg_req_i.valid && reg_req_i.write;
+  assign reg_read  = reg_req_i.valid && !reg_req_i.write;
+  assign reg_word  = reg_req_i.addr[11:2];
+
+  always_comb begin : proc_reg_read
+    reg_rsp_o.ready = 1'b1;
+    reg_rsp_o.error = 1'b0;
+    reg_rsp_o.rdata = '0;
+    unique case (reg_word)
+      10'h0, 10'h1: reg_rsp_o.rdata = cfg_q[reg_word[0]];
+      10'h2, 10'h3: reg_rsp_o.rdata = cnt_q[reg_word[0]];
+      10'h4, 10'h5: reg_rsp_o.rdata = cmp_q[reg_word[0]];
+      10'h6, 10'h7,
+      10'h8, 10'h9: reg_rsp_o.rdata = '0;
+      10'hA:        reg_rsp_o.rdata = cnt_q[0];
+      10'hB:        reg_rsp_o.rdata = snap_hi_q;
+      10'hC, 10'hD: reg_rsp_o.rdata = 32'(cap_cfg_q[reg_word[0]]);
+      10'hE, 10'hF: reg_rsp_o.rdata = cap_q[reg_word[0]];
+      10'h10,
+      10'h11:       reg_rsp_o.rdata = cap_prev_q[reg_word[0]];
+      10'h12,
+      10'h13:       reg_rsp_o.rdata = cap_cnt_q[reg_word[0]];
+      default:      reg_rsp_o.error = 1'b1;
+    endcase
+  end
+
+  // Counting on the rising edges of the reference clock
+  sync #(
+    .STAGES ( 2 )
+  ) i_ref_clk_sync (
+    .clk_i,
+    .rst_ni,
+    .serial_i ( ref_clk_i    ),
+    .serial_o ( ref_clk_sync )
+  );
+
+  assign ref_tick = ref_clk_sync && !ref_clk_q;
+
+  // In 64-bit mode, CFG_LO controls both channels
+  assign mode64  = cfg_q[0][Cfg64Bit];
+  assign ctrl[0] = cfg_q[0];
+  assign ctrl[1] = mode64 ? cfg_q[0] : cfg_q[1];
+
+  for (genvar c = 0; c < 2; c++) begin : gen_tick
+    logic src_tick;
+    assign src_tick = ctrl[c][CfgRefClkEn] ? ref_tick : 1'b1;
+    assign tick[c]  = ctrl[c][CfgEnable] && src_tick &&
+                      (!ctrl[c][CfgPrescEn] || presc_q[c] == ctrl[c][15:8]);
+
+    always_comb begin : proc_presc
+      presc_d[c] = presc_q[c];
+      if (ctrl[c][CfgEnable] && ctrl[c][CfgPrescEn] && src_tick) begin
+        presc_d[c] = presc_q[c] == ctrl[c][15:8] ? '0 : presc_q[c] + 1;
+      end
+    end
+  end
+
+  // Input capture. The edge detection is re-armed after a write of CAP_CFG, so changing the
+  // source does not capture.
+  for (genvar c = 0; c < 2; c++) begin : gen_capture
+    logic [7:0] src;
+    assign src          = cap_cfg_q[c][15:8];
+    assign event_sel[c] = src < NumEvents ? event_i[src] : 1'b0;
+    assign capture[c]   = event_armed_q[c] && !(c == 1 && mode64) &&
+                          (cap_cfg_q[c][CapRise] &&  event_sel[c] && !event_q[c] ||
+                           cap_cfg_q[c][CapFall] && !event_sel[c] &&  event_q[c]);
+  end
+
+  assign hit[0] = tick[0] && (mode64 ? cnt_q == cmp_q : cnt_q[0] == cmp_q[0]);
+  assign hit[1] = tick[1] && !mode64 && cnt_q[1] == cmp_q[1];
+
+  always_comb begin : proc_next
+    cfg_d      = cfg_q;
+    cnt_d      = cnt_q;
+    cmp_d      = cmp_q;
+    irq_d      = '0;
+    cap_cfg_d  = cap_cfg_q;
+    cap_d      = cap_q;
+    cap_prev_d = cap_prev_q;
+    cap_cnt_d  = cap_cnt_q;
+
+    for (int unsigned c = 0; c < 2; c++) begin
+      if (capture[c]) begin
+        cap_cnt_d[c] = cap_cnt_q[c] == '1 ? cap_cnt_q[c] : cap_cnt_q[c] + 1;
+        if (mode64) begin
+          cap_prev_d = cap_q;
+          cap_d      = cnt_q;
+        end else begin
+          cap_prev_d[c] = cap_q[c];
+          cap_d[c]      = cnt_q[c];
+        end
+      end
+    end
+
+    if (mode64) begin
+      if (tick[0]) begin
+        cnt_d = hit[0] && ctrl[0][CfgCmpClr] ? '0 : cnt_q + 1;
+      end
+    end else begin
+      for (int unsigned c = 0; c < 2; c++) begin
+        if (tick[c]) begin
+          cnt_d[c] = hit[c] && ctrl[c][CfgCmpClr] ? '0 : cnt_q[c] + 1;
+        end
+      end
+    end
+
+    for (int unsigned c = 0; c < 2; c++) begin
+      if (hit[c]) begin
+        irq_d[c] = ctrl[c][CfgIrqEn];
+        if (ctrl[c][CfgOneShot]) begin
+          cfg_d[c][CfgEnable] = 1'b0;
+        end
+      end
+    end
+
+    if (reg_write) begin
+      unique case (reg_word)
+        10'h0, 10'h1: begin
+          cfg_d[reg_word[0]]           = reg_req_i.wdata;
+          cfg_d[reg_word[0]][CfgReset] = 1'b0;
+          if (reg_word[0]) begin
+            cfg_d[1][Cfg64Bit] = 1'b0;
+          end
+          if (reg_req_i.wdata[CfgReset]) begin
+            cnt_d[reg_word[0]] = '0;
+            if (!reg_word[0] && reg_req_i.wdata[Cfg64Bit]) begin
+              cnt_d[1] = '0;
+            end
+          end
+        end
+        10'h2, 10'h3: cnt_d[reg_word[0]] = reg_req_i.wdata;
+        10'h4, 10'h5: cmp_d[reg_word[0]] = reg_req_i.wdata;
+        10'h6, 10'h7: cfg_d[reg_word[0]][CfgEnable] = 1'b1;
+        10'h8, 10'h9: begin
+          cnt_d[reg_word[0]] = '0;
+          if (!reg_word[0] && mode64) begin
+            cnt_d[1] = '0;
+          end
+        end
+        10'hC, 10'hD: cap_cfg_d[reg_word[0]] = reg_req_i.wdata[15:0];
+        10'h12,
+        10'h13:       cap_cnt_d[reg_word[0]] = '0;
+        default: ;
+      endcase
+    end
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_regs
+    if (!rst_ni) begin
+      cfg_q         <= '0;
+      cnt_q         <= '0;
+      cmp_q         <= '0;
+      presc_q       <= '0;
+      irq_q         <= '0;
+      snap_hi_q     <= '0;
+      ref_clk_q     <= 1'b0;
+      cap_cfg_q     <= '0;
+      cap_q         <= '0;
+      cap_prev_q    <= '0;
+      cap_cnt_q     <= '0;
+      event_q       <= '0;
+      event_armed_q <= '0;
+    end else begin
+      cfg_q         <= cfg_d;
+      cnt_q         <= cnt_d;
+      cmp_q         <= cmp_d;
+      presc_q       <= presc_d;
+      irq_q         <= irq_d;
+      ref_clk_q     <= ref_clk_sync;
+      cap_cfg_q     <= cap_cfg_d;
+      cap_q         <= cap_d;
+      cap_prev_q    <= cap_prev_d;
+      cap_cnt_q     <= cap_cnt_d;
+      event_q       <= event_sel;
+      event_armed_q <= 2'b11;
+      if (reg_write && reg_word[9:1] == 9'h6) begin
+        event_armed_q[reg_word[0]] <= 1'b0;
+      end
+      if (reg_read && reg_word == 10'hA) begin
+        snap_hi_q <= cnt_q[1];
+      end
+    end
+  end
+
+  assign irq_lo_o = irq_q[0];
+  assign irq_hi_o = irq_q[1];
+
+endmodule
@@ -65,9 +65,16 @@ module safety_island_top import safety_island_pkg::*; #(
   input  logic            fetch_enable_i,
 
   input  logic [SafetyIslandCfg.NumInterrupts-1:0] irqs_i,
+  /// Timer capture events, synchronous to `clk_i`
+  input  logic [SafetyIslandCfg.NumTimerEvents-1:0] timer_events_i,
 
   output logic [NumDebug-1:0]   debug_req_o,
 
+  /// SCMI mailbox completion interrupts, one per channel
+  output logic [SafetyIslandCfg.MailboxNumChannels-1:0] mailbox_irqs_o,
+  /// Interrupts to the host, driven by the SoC control registers
+  output logic [SafetyIslandCfg.NumHostIrqs-1:0]        host_irqs_o,
+
   /// AXI input
   input  axi_input_req_t  axi_input_req_i,
   output axi_input_resp_t axi_input_resp_o,
@@ -81,11 +88,22 @@ module safety_island_top import safety_island_pkg::*; #(
   localparam int unsigned DataWidth = 32;
   localparam int unsigned BankNumWords = SafetyIslandCfg.BankNumBytes/4;
 
+  // ECC manager window decoded for the configured number of banks
+  localparam bit [31:0] EccManagerNumBanksRange = SafetyIslandCfg.NumBanks*EccManagerBankAddrRange;
+
   // Base addresses
   localparam bit [31:0] BaseAddr32     = BaseAddr[31:0];
   localparam bit [31:0] PeriphBaseAddr = BaseAddr32+PeriphOffset;
 
-  localparam int unsigned NumManagers = 5; // AXI, DBG, Core Instr, Core Data, Core Shadow
+  // DBG, Core Shadow, Core Data, Core Instr, AXI
+  localparam int unsigned NumFixedManagers = 5;
+  // Sensor DMA and trace buffer when enabled
+  localparam int unsigned SensorDmaMgrIdx  = NumFixedManagers;
+  localparam int unsigned TraceMgrIdx      = SensorDmaMgrIdx + SafetyIslandCfg.UseSensorDma;
+  localparam int unsigned NumBaseManagers  = TraceMgrIdx + SafetyIslandCfg.UseTrace;
+  // Instruction and data manager of each additional hart in split mode
+  localparam int unsigned NumManagers = NumBaseManagers +
+                                        2*NumSplitHarts*SafetyIslandCfg.UseSplitMode;
 
   // typedef obi for default config
   localparam obi_pkg::obi_optional_cfg_t MgrObiOptionalCfg= '{
@@ -169,11 +187,11 @@ module safety_island_top import safety_island_pkg::*; #(
                        logic[(DataWidth/8)-1:0]);
 
 `ifdef TARGET_SIMULATION
-  localparam int unsigned NumPeriphs     = 9;
-  localparam int unsigned NumPeriphRules = 8;
+  localparam int unsigned NumPeriphs     = 18;
+  localparam int unsigned NumPeriphRules = 17;
 `else
-  localparam int unsigned NumPeriphs     = 8;
-  localparam int unsigned NumPeriphRules = 7;
+  localparam int unsigned NumPeriphs     = 17;
+  localparam int unsigned NumPeriphRules = 16;
 `endif
 
   localparam int unsigned NumSubordinates = 2 + SafetyIslandCfg.NumBanks;
@@ -217,40 +235,161 @@ module safety_island_top import safety_island_pkg::*; #(
        end_addr: PeriphBaseAddr+DebugAddrOffset+        DebugAddrRange},         // 4: Debug
     '{ idx: PeriphEccManager,
        start_addr: PeriphBaseAddr+EccManagerAddrOffset,
-       end_addr: PeriphBaseAddr+EccManagerAddrOffset+   EccManagerAddrRange},    // 5: ECC Manager
+       end_addr: PeriphBaseAddr+EccManagerAddrOffset+   EccManagerNumBanksRange},// 5: ECC Manager
     '{ idx: PeriphTimer,
        start_addr: PeriphBaseAddr+TimerAddrOffset,
        end_addr: PeriphBaseAddr+TimerAddrOffset+        TimerAddrRange},         // 6: Timer
     '{ idx: PeriphCoreLocal,
        start_addr: PeriphBaseAddr+CoreLocalAddrOffset,
-       end_addr: PeriphBaseAddr+CoreLocalAddrOffset+    CoreLocalAddrRange}      // 7: Core-Local
+       end_addr: PeriphBaseAddr+CoreLocalAddrOffset+    CoreLocalAddrRange},     // 7: Core-Local
+    '{ idx: PeriphICache,
+       start_addr: PeriphBaseAddr+ICacheAddrOffset,
+       end_addr: PeriphBaseAddr+ICacheAddrOffset+       ICacheAddrRange},        // 8: ICache
+    '{ idx: PeriphSensorDma,
+       start_addr: PeriphBaseAddr+SensorDmaAddrOffset,
+       end_addr: PeriphBaseAddr+SensorDmaAddrOffset+    SensorDmaAddrRange},     // 9: Sensor DMA
+    '{ idx: PeriphStoreMerge,
+       start_addr: PeriphBaseAddr+StoreMergeAddrOffset,
+       end_addr: PeriphBaseAddr+StoreMergeAddrOffset+   StoreMergeAddrRange},    // 10: Store merge
+    '{ idx: PeriphMailbox,
+       start_addr: PeriphBaseAddr+MailboxAddrOffset,
+       end_addr: PeriphBaseAddr+MailboxAddrOffset+      MailboxAddrRange},       // 11: Mailbox
+    '{ idx: PeriphXbarQos,
+       start_addr: PeriphBaseAddr+XbarQosAddrOffset,
+       end_addr: PeriphBaseAddr+XbarQosAddrOffset+      XbarQosAddrRange},       // 12: Xbar QoS
+    '{ idx: PeriphBankInit,
+       start_addr: PeriphBaseAddr+BankInitAddrOffset,
+       end_addr: PeriphBaseAddr+BankInitAddrOffset+     BankInitAddrRange},      // 13: Bank init
+    '{ idx: PeriphScrubCtrl,
+       start_addr: PeriphBaseAddr+ScrubCtrlAddrOffset,
+       end_addr: PeriphBaseAddr+ScrubCtrlAddrOffset+    ScrubCtrlAddrRange},     // 14: Scrub control
+    '{ idx: PeriphEccLog,
+       start_addr: PeriphBaseAddr+EccLogAddrOffset,
+       end_addr: PeriphBaseAddr+EccLogAddrOffset+       EccLogAddrRange},        // 15: ECC log
+    '{ idx: PeriphSchedTable,
+       start_addr: PeriphBaseAddr+SchedTableAddrOffset,
+       end_addr: PeriphBaseAddr+SchedTableAddrOffset+   SchedTableAddrRange}     // 16: Sched table
 `ifdef TARGET_SIMULATION
     ,
     '{ idx: PeriphTBPrintf,
        start_addr: PeriphBaseAddr+TBPrintfAddrOffset,
-       end_addr: PeriphBaseAddr+TBPrintfAddrOffset+     TBPrintfAddrRange}       // 8: TBPrintf
+       end_addr: PeriphBaseAddr+TBPrintfAddrOffset+     TBPrintfAddrRange}       // 17: TBPrintf
 `endif
   };
 
+  // The memory banks and their ECC manager windows have to fit into the address map
+  if (EccManagerNumBanksRange > EccManagerAddrRange) begin : gen_ecc_manager_range_check
+    $fatal(1, "NumBanks=%0d exceeds the ECC manager address range", SafetyIslandCfg.NumBanks);
+  end
+  if (SafetyIslandCfg.UseScrubCtrl && SafetyIslandCfg.NumBanks > 120) begin : gen_scrub_ctrl_check
+    $fatal(1, "NumBanks=%0d exceeds the scrub control address range", SafetyIslandCfg.NumBanks);
+  end
+  if (PeriphOffset > MemOffset &&
+      SafetyIslandCfg.NumBanks*SafetyIslandCfg.BankNumBytes > PeriphOffset-MemOffset)
+  begin : gen_mem_range_check
+    $fatal(1, "NumBanks=%0d overlaps the peripheral address range", SafetyIslandCfg.NumBanks);
+  end
+
+  if (SafetyIslandCfg.NumTimers == 0 ||
+      SafetyIslandCfg.NumTimers*TimerUnitAddrRange > TimerAddrRange) begin : gen_num_timers_check
+    $fatal(1, "NumTimers=%0d exceeds the timer address range", SafetyIslandCfg.NumTimers);
+  end
+
+  if (SafetyIslandCfg.NumTimerEvents == 0 ||
+      SafetyIslandCfg.NumTimerEvents + SafetyIslandCfg.NumInterrupts > 256)
+  begin : gen_num_timer_events_check
+    $fatal(1, "NumTimerEvents=%0d must be at least 1 and leave room for NumInterrupts in the "
+              "256 capture sources", SafetyIslandCfg.NumTimerEvents);
+  end
+
+  if (SafetyIslandCfg.NumHostIrqs == 0 || SafetyIslandCfg.NumHostIrqs > 32)
+  begin : gen_num_host_irqs_check
+    $fatal(1, "NumHostIrqs=%0d must be between 1 and 32", SafetyIslandCfg.NumHostIrqs);
+  end
+
+  if (SafetyIslandCfg.MailboxNumChannels == 0 ||
+      SafetyIslandCfg.MailboxNumChannels*32'h28 > MailboxAddrRange) begin : gen_mailbox_check
+    $fatal(1, "MailboxNumChannels=%0d exceeds the mailbox address range",
+           SafetyIslandCfg.MailboxNumChannels);
+  end
+
+  if (SafetyIslandCfg.AxiInMaxTrans  == 0 || SafetyIslandCfg.AxiOutMaxTrans == 0 ||
+      SafetyIslandCfg.XbarMaxTrans   == 0 || SafetyIslandCfg.PeriphMaxTrans == 0)
+  begin : gen_max_trans_check
+    $fatal(1, "The number of outstanding transactions must be at least 1");
+  end
+
+  // The QoS registers hold up to 16 managers
+  if (SafetyIslandCfg.UseXbarQos && NumManagers > 16) begin : gen_xbar_qos_check
+    $fatal(1, "UseXbarQos supports at most 16 crossbar managers");
+  end
+
+  if (SafetyIslandCfg.UseAmoUnit && SafetyIslandCfg.AmoUnitEntries == 0) begin : gen_amo_unit_check
+    $fatal(1, "UseAmoUnit requires at least one entry");
+  end
+
+  // The timestamp registers hold up to 15 slots of 15 samples
+  if (SafetyIslandCfg.UseIrqTimestamp &&
+      (SafetyIslandCfg.IrqTimestampSlots inside {0, [16:$]} ||
+       SafetyIslandCfg.IrqTimestampDepth inside {0, [16:$]})) begin : gen_irq_timestamp_check
+    $fatal(1, "UseIrqTimestamp requires 1 to 15 slots and samples per slot");
+  end
+
+  // The table lines follow the other island interrupts up to CLIC line 31
+  if (SafetyIslandCfg.UseSchedTable &&
+      (SafetyIslandCfg.SchedTableNumIrqs inside {0, [NumPeriphInterrupts-PeriphIrqSchedTable+1:$]} ||
+       SafetyIslandCfg.SchedTableEntries inside {0, [33:$]})) begin : gen_sched_table_check
+    $fatal(1, "UseSchedTable requires 1 to %0d interrupt lines and 1 to 32 entries",
+           NumPeriphInterrupts-PeriphIrqSchedTable);
+  end
+
+  if (SafetyIslandCfg.UseSplitMode && !SafetyIslandCfg.UseTCLS) begin : gen_split_mode_check
+    $fatal(1, "UseSplitMode requires UseTCLS");
+  end
+
+  if (SafetyIslandCfg.UseSplitMode &&
+      MgrObiCfg.IdWidth < $clog2(NumSplitHarts+1)) begin : gen_split_id_check
+    $fatal(1, "UseSplitMode requires an OBI ID of at least %0d bits", $clog2(NumSplitHarts+1));
+  end
+
   // -----------------
   // Control Signals
   // -----------------
   logic fetch_enable;
   logic [31:0] boot_addr;
-  logic [NumTimerInterrupts-1:0] s_timer_irqs;
+  // Low and high interrupt of each timer
+  logic [2*SafetyIslandCfg.NumTimers-1:0] s_timer_irqs;
+  logic [NumPeriphInterrupts-1:0] s_periph_irqs;
 
   // -----------------
   // Manager buses
   // -----------------
 
+  // Core fetch bus (before the instruction cache)
+  mgr_obi_req_t core_fetch_obi_req;
+  mgr_obi_rsp_t core_fetch_obi_rsp;
+  assign core_fetch_obi_req.a.aid = '0;
+  assign core_fetch_obi_req.a.a_optional = '0;
+  assign core_fetch_obi_req.a.we = '0;
+  assign core_fetch_obi_req.a.be = '1;
+  assign core_fetch_obi_req.a.wdata = '0;
+
+  // The trace holds back new fetches while it has no room for their packets. A fetch already
+  // presented stays on the bus until granted.
+  logic core_fetch_req, core_fetch_pending_q, trace_stall;
+  assign core_fetch_obi_req.req = core_fetch_req && (core_fetch_pending_q || !trace_stall);
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_fetch_pending
+    if (!rst_ni) begin
+      core_fetch_pending_q <= 1'b0;
+    end else begin
+      core_fetch_pending_q <= core_fetch_obi_req.req && !core_fetch_obi_rsp.gnt;
+    end
+  end
+
   // Core instr bus
   mgr_obi_req_t core_instr_obi_req;
   mgr_obi_rsp_t core_instr_obi_rsp;
-  assign core_instr_obi_req.a.aid = '0;
-  assign core_instr_obi_req.a.a_optional = '0;
-  assign core_instr_obi_req.a.we = '0;
-  assign core_instr_obi_req.a.be = '1;
-  assign core_instr_obi_req.a.wdata = '0;
 
   // Core data bus
   mgr_obi_req_t core_data_obi_req;
@@ -258,6 +397,10 @@ module safety_island_top import safety_island_pkg::*; #(
   assign core_data_obi_req.a.aid = '0;
   // assign core_data_obi_req.a.a_optional = '0;
 
+  // Core data bus towards the crossbar, without direct accesses
+  mgr_obi_req_t core_data_xbar_obi_req;
+  mgr_obi_rsp_t core_data_xbar_obi_rsp;
+
   // Core shadow bus
   mgr_obi_req_t core_shadow_obi_req;
   mgr_obi_rsp_t core_shadow_obi_rsp;
@@ -274,6 +417,102 @@ module safety_island_top import safety_island_pkg::*; #(
   mgr_obi_req_t axi_input_obi_req;
   mgr_obi_rsp_t axi_input_obi_rsp;
 
+  // sensor DMA bus
+  mgr_obi_req_t sensor_dma_obi_req;
+  mgr_obi_rsp_t sensor_dma_obi_rsp;
+
+  // trace buffer write bus
+  mgr_obi_req_t trace_obi_req;
+  mgr_obi_rsp_t trace_obi_rsp;
+  assign trace_obi_req.a.we         = 1'b1;
+  assign trace_obi_req.a.be         = '1;
+  assign trace_obi_req.a.aid        = '0;
+  assign trace_obi_req.a.a_optional = '0;
+
+  // Instr and data buses of harts 1 and 2 in split mode
+  mgr_obi_req_t [NumSplitHarts-1:0] split_instr_obi_req, split_data_obi_req;
+  mgr_obi_rsp_t [NumSplitHarts-1:0] split_instr_obi_rsp, split_data_obi_rsp;
+
+  logic [NumSplitHarts-1:0]       split_instr_req, split_data_req, split_data_we;
+  logic [NumSplitHarts-1:0][31:0] split_instr_addr, split_data_addr, split_data_wdata;
+  logic [NumSplitHarts-1:0][3:0]  split_data_be;
+  logic [NumSplitHarts-1:0][5:0]  split_data_atop;
+
+  logic [NumSplitHarts-1:0]       split_instr_gnt, split_instr_rvalid;
+  logic [NumSplitHarts-1:0]       split_data_gnt, split_data_rvalid;
+  logic [NumSplitHarts-1:0][31:0] split_instr_rdata, split_data_rdata;
+  logic [NumSplitHarts-1:0][1:0]  split_instr_err, split_data_err;
+
+  // Each hart issues its data accesses with its index as OBI ID, so that LR/SC reservations of the
+  // harts do not alias in the ATOP resolvers and on the AXI output
+  for (genvar i = 0; i < NumSplitHarts; i++) begin : gen_split_obi
+    assign split_instr_obi_req[i].req          = split_instr_req[i];
+    assign split_instr_obi_req[i].a.addr       = split_instr_addr[i];
+    assign split_instr_obi_req[i].a.aid        = '0;
+    assign split_instr_obi_req[i].a.a_optional = '0;
+    assign split_instr_obi_req[i].a.we         = '0;
+    assign split_instr_obi_req[i].a.be         = '1;
+    assign split_instr_obi_req[i].a.wdata      = '0;
+    assign split_instr_gnt[i]    = split_instr_obi_rsp[i].gnt;
+    assign split_instr_rvalid[i] = split_instr_obi_rsp[i].rvalid;
+    assign split_instr_rdata[i]  = split_instr_obi_rsp[i].r.rdata;
+    assign split_instr_err[i]    = {split_instr_obi_rsp[i].r.r_optional.ruser[0],
+                                    split_instr_obi_rsp[i].r.err};
+
+    assign split_data_obi_req[i].req               = split_data_req[i];
+    assign split_data_obi_req[i].a.addr            = split_data_addr[i];
+    assign split_data_obi_req[i].a.aid             = MgrObiCfg.IdWidth'(i+1);
+    assign split_data_obi_req[i].a.a_optional.atop = split_data_atop[i];
+    assign split_data_obi_req[i].a.we              = split_data_we[i];
+    assign split_data_obi_req[i].a.be              = split_data_be[i];
+    assign split_data_obi_req[i].a.wdata           = split_data_wdata[i];
+    assign split_data_gnt[i]    = split_data_obi_rsp[i].gnt;
+    assign split_data_rvalid[i] = split_data_obi_rsp[i].rvalid;
+    assign split_data_rdata[i]  = split_data_obi_rsp[i].r.rdata;
+    assign split_data_err[i]    = {split_data_obi_rsp[i].r.r_optional.ruser[0],
+                                   split_data_obi_rsp[i].r.err};
+  end
+
+  // Main xbar manager buses
+  mgr_obi_req_t [NumManagers-1:0] all_mgr_obi_req, xbar_mgr_obi_req;
+  mgr_obi_rsp_t [NumManagers-1:0] all_mgr_obi_rsp;
+  assign all_mgr_obi_req[NumFixedManagers-1:0] = {axi_input_obi_req,
+                                                  core_instr_obi_req,
+                                                  core_data_xbar_obi_req,
+                                                  core_shadow_obi_req,
+                                                  dbg_req_obi_req};
+  assign {axi_input_obi_rsp,
+          core_instr_obi_rsp,
+          core_data_xbar_obi_rsp,
+          core_shadow_obi_rsp,
+          dbg_req_obi_rsp} = all_mgr_obi_rsp[NumFixedManagers-1:0];
+
+  if (SafetyIslandCfg.UseSensorDma) begin : gen_sensor_dma_mgr
+    assign all_mgr_obi_req[SensorDmaMgrIdx] = sensor_dma_obi_req;
+    assign sensor_dma_obi_rsp = all_mgr_obi_rsp[SensorDmaMgrIdx];
+  end else begin : gen_no_sensor_dma_mgr
+    assign sensor_dma_obi_rsp = '0;
+  end
+
+  if (SafetyIslandCfg.UseTrace) begin : gen_trace_mgr
+    assign all_mgr_obi_req[TraceMgrIdx] = trace_obi_req;
+    assign trace_obi_rsp = all_mgr_obi_rsp[TraceMgrIdx];
+  end else begin : gen_no_trace_mgr
+    assign trace_obi_rsp = '0;
+  end
+
+  if (SafetyIslandCfg.UseSplitMode) begin : gen_split_mgr
+    for (genvar i = 0; i < NumSplitHarts; i++) begin : gen_split_hart_mgr
+      assign all_mgr_obi_req[NumBaseManagers+2*i]   = split_instr_obi_req[i];
+      assign all_mgr_obi_req[NumBaseManagers+2*i+1] = split_data_obi_req[i];
+      assign split_instr_obi_rsp[i] = all_mgr_obi_rsp[NumBaseManagers+2*i];
+      assign split_data_obi_rsp[i]  = all_mgr_obi_rsp[NumBaseManagers+2*i+1];
+    end
+  end else begin : gen_no_split_mgr
+    assign split_instr_obi_rsp = '0;
+    assign split_data_obi_rsp  = '0;
+  end
+
   // -----------------
   // Subordinate buses
   // -----------------
@@ -350,6 +589,64 @@ module safety_island_top import safety_island_pkg::*; #(
   safety_reg_req_t cl_periph_reg_req;
   safety_reg_rsp_t cl_periph_reg_rsp;
 
+  // Core-local and timer buses shared with the direct path of the core
+  safety_reg_req_t cl_target_reg_req, timer_target_reg_req;
+  safety_reg_rsp_t cl_target_reg_rsp, timer_target_reg_rsp;
+
+  // Instruction cache config bus
+  sbr_obi_req_t icache_obi_req;
+  sbr_obi_rsp_t icache_obi_rsp;
+  safety_reg_req_t icache_reg_req;
+  safety_reg_rsp_t icache_reg_rsp;
+
+  // Sensor DMA config bus
+  sbr_obi_req_t sensor_dma_cfg_obi_req;
+  sbr_obi_rsp_t sensor_dma_cfg_obi_rsp;
+  safety_reg_req_t sensor_dma_reg_req;
+  safety_reg_rsp_t sensor_dma_reg_rsp;
+
+  // Store-merge buffer config bus
+  sbr_obi_req_t store_merge_obi_req;
+  sbr_obi_rsp_t store_merge_obi_rsp;
+  safety_reg_req_t store_merge_reg_req;
+  safety_reg_rsp_t store_merge_reg_rsp;
+
+  // SCMI mailbox bus
+  sbr_obi_req_t mailbox_obi_req;
+  sbr_obi_rsp_t mailbox_obi_rsp;
+  safety_reg_req_t mailbox_reg_req;
+  safety_reg_rsp_t mailbox_reg_rsp;
+
+  // Crossbar QoS config bus
+  sbr_obi_req_t xbar_qos_obi_req;
+  sbr_obi_rsp_t xbar_qos_obi_rsp;
+  safety_reg_req_t xbar_qos_reg_req;
+  safety_reg_rsp_t xbar_qos_reg_rsp;
+
+  // Bank initialization config bus
+  sbr_obi_req_t bank_init_obi_req;
+  sbr_obi_rsp_t bank_init_obi_rsp;
+  safety_reg_req_t bank_init_reg_req;
+  safety_reg_rsp_t bank_init_reg_rsp;
+
+  // Scrub control bus
+  sbr_obi_req_t scrub_ctrl_obi_req;
+  sbr_obi_rsp_t scrub_ctrl_obi_rsp;
+  safety_reg_req_t scrub_ctrl_reg_req;
+  safety_reg_rsp_t scrub_ctrl_reg_rsp;
+
+  // ECC log bus
+  sbr_obi_req_t ecc_log_obi_req;
+  sbr_obi_rsp_t ecc_log_obi_rsp;
+  safety_reg_req_t ecc_log_reg_req;
+  safety_reg_rsp_t ecc_log_reg_rsp;
+
+  // Schedule table bus
+  sbr_obi_req_t sched_table_obi_req;
+  sbr_obi_rsp_t sched_table_obi_rsp;
+  safety_reg_req_t sched_table_reg_req;
+  safety_reg_rsp_t sched_table_reg_rsp;
+
 `ifdef TARGET_SIMULATION
   // TBPrintf bus
   sbr_obi_req_t tbprintf_obi_req;
@@ -374,6 +671,24 @@ module safety_island_top import safety_island_pkg::*; #(
   assign all_periph_obi_rsp[PeriphCoreLocal]  = cl_periph_obi_rsp;
   assign timer_obi_req                        = all_periph_obi_req[PeriphTimer];
   assign all_periph_obi_rsp[PeriphTimer]      = timer_obi_rsp;
+  assign icache_obi_req                       = all_periph_obi_req[PeriphICache];
+  assign all_periph_obi_rsp[PeriphICache]     = icache_obi_rsp;
+  assign sensor_dma_cfg_obi_req               = all_periph_obi_req[PeriphSensorDma];
+  assign all_periph_obi_rsp[PeriphSensorDma]  = sensor_dma_cfg_obi_rsp;
+  assign store_merge_obi_req                  = all_periph_obi_req[PeriphStoreMerge];
+  assign all_periph_obi_rsp[PeriphStoreMerge] = store_merge_obi_rsp;
+  assign mailbox_obi_req                      = all_periph_obi_req[PeriphMailbox];
+  assign all_periph_obi_rsp[PeriphMailbox]    = mailbox_obi_rsp;
+  assign xbar_qos_obi_req                     = all_periph_obi_req[PeriphXbarQos];
+  assign all_periph_obi_rsp[PeriphXbarQos]    = xbar_qos_obi_rsp;
+  assign bank_init_obi_req                    = all_periph_obi_req[PeriphBankInit];
+  assign all_periph_obi_rsp[PeriphBankInit]   = bank_init_obi_rsp;
+  assign scrub_ctrl_obi_req                   = all_periph_obi_req[PeriphScrubCtrl];
+  assign all_periph_obi_rsp[PeriphScrubCtrl]  = scrub_ctrl_obi_rsp;
+  assign ecc_log_obi_req                      = all_periph_obi_req[PeriphEccLog];
+  assign all_periph_obi_rsp[PeriphEccLog]     = ecc_log_obi_rsp;
+  assign sched_table_obi_req                  = all_periph_obi_req[PeriphSchedTable];
+  assign all_periph_obi_rsp[PeriphSchedTable] = sched_table_obi_rsp;
 `ifdef TARGET_SIMULATION
   assign tbprintf_obi_req                     = all_periph_obi_req[PeriphTBPrintf];
   assign all_periph_obi_rsp[PeriphTBPrintf]   = tbprintf_obi_rsp;
@@ -394,12 +709,23 @@ module safety_island_top import safety_island_pkg::*; #(
     debug_req_o[SafetyIslandCfg.HartId] = '0;
   end
 
+  // Errors of posted writes from the write buffer
+  logic        posted_err_valid, posted_err_ready;
+  logic [31:0] posted_err_addr;
+  logic [1:0]  posted_err;
+
+  // Events of the performance monitor
+  logic [NumManagers-1:0]              perf_mgr_req, perf_mgr_gnt;
+  logic [SafetyIslandCfg.NumBanks-1:0] perf_bank_conflict, perf_ecc_corr;
+  logic perf_axi_out_req, perf_axi_out_gnt, perf_axi_out_we, perf_axi_out_rvalid;
+
   safety_core_wrap #(
     .SafetyIslandCfg ( SafetyIslandCfg           ),
     .PeriphBaseAddr  ( BaseAddr32 + PeriphOffset ),
     .reg_req_t       ( safety_reg_req_t          ),
     .reg_rsp_t       ( safety_reg_rsp_t          ),
-    .NumBusErrBits   ( 2 )
+    .NumBusErrBits   ( 2 ),
+    .NumManagers     ( NumManagers )
   ) i_core_wrap (
     .clk_i,
     .ref_clk_i,
@@ -408,19 +734,34 @@ module safety_island_top import safety_island_pkg::*; #(
 
     .irqs_i,
     .timer_irqs_i     ( s_timer_irqs                      ),
+    .periph_irqs_i    ( s_periph_irqs                     ),
+
+    .posted_err_valid_i ( posted_err_valid                ),
+    .posted_err_addr_i  ( posted_err_addr                 ),
+    .posted_err_i       ( posted_err                      ),
+    .posted_err_ready_o ( posted_err_ready                ),
+
+    .perf_mgr_req_i        ( perf_mgr_req        ),
+    .perf_mgr_gnt_i        ( perf_mgr_gnt        ),
+    .perf_bank_conflict_i  ( perf_bank_conflict  ),
+    .perf_ecc_corr_i       ( perf_ecc_corr       ),
+    .perf_axi_out_req_i    ( perf_axi_out_req    ),
+    .perf_axi_out_gnt_i    ( perf_axi_out_gnt    ),
+    .perf_axi_out_we_i     ( perf_axi_out_we     ),
+    .perf_axi_out_rvalid_i ( perf_axi_out_rvalid ),
 
-    .cl_periph_req_i  ( cl_periph_reg_req                 ),
-    .cl_periph_rsp_o  ( cl_periph_reg_rsp                 ),
+    .cl_periph_req_i  ( cl_target_reg_req                 ),
+    .cl_periph_rsp_o  ( cl_target_reg_rsp                 ),
 
     .hart_id_i        ( SafetyIslandCfg.HartId            ),
     .boot_addr_i      ( boot_addr                         ),
 
-    .instr_req_o      ( core_instr_obi_req.req            ),
-    .instr_gnt_i      ( core_instr_obi_rsp.gnt            ),
-    .instr_rvalid_i   ( core_instr_obi_rsp.rvalid         ),
-    .instr_addr_o     ( core_instr_obi_req.a.addr         ),
-    .instr_rdata_i    ( core_instr_obi_rsp.r.rdata        ),
-    .instr_err_i      ( {core_instr_obi_rsp.r.r_optional.ruser[0] ,core_instr_obi_rsp.r.err} ),
+    .instr_req_o      ( core_fetch_req                    ),
+    .instr_gnt_i      ( core_fetch_obi_rsp.gnt            ),
+    .instr_rvalid_i   ( core_fetch_obi_rsp.rvalid         ),
+    .instr_addr_o     ( core_fetch_obi_req.a.addr         ),
+    .instr_rdata_i    ( core_fetch_obi_rsp.r.rdata        ),
+    .instr_err_i      ( {core_fetch_obi_rsp.r.r_optional.ruser[0] ,core_fetch_obi_rsp.r.err} ),
 
     .data_req_o       ( core_data_obi_req.req             ),
     .data_gnt_i       ( core_data_obi_rsp.gnt             ),
@@ -443,10 +784,77 @@ module safety_island_top import safety_island_pkg::*; #(
     .shadow_rdata_i   ( core_shadow_obi_rsp.r.rdata       ),
     .shadow_err_i     ( {core_shadow_obi_rsp.r.r_optional.ruser[0], core_shadow_obi_rsp.r.err} ),
 
+    .split_instr_req_o    ( split_instr_req    ),
+    .split_instr_gnt_i    ( split_instr_gnt    ),
+    .split_instr_rvalid_i ( split_instr_rvalid ),
+    .split_instr_addr_o   ( split_instr_addr   ),
+    .split_instr_rdata_i  ( split_instr_rdata  ),
+    .split_instr_err_i    ( split_instr_err    ),
+
+    .split_data_req_o     ( split_data_req     ),
+    .split_data_gnt_i     ( split_data_gnt     ),
+    .split_data_rvalid_i  ( split_data_rvalid  ),
+    .split_data_we_o      ( split_data_we      ),
+    .split_data_be_o      ( split_data_be      ),
+    .split_data_addr_o    ( split_data_addr    ),
+    .split_data_wdata_o   ( split_data_wdata   ),
+    .split_data_atop_o    ( split_data_atop    ),
+    .split_data_rdata_i   ( split_data_rdata   ),
+    .split_data_err_i     ( split_data_err     ),
+
+    .trace_req_o      ( trace_obi_req.req                 ),
+    .trace_gnt_i      ( trace_obi_rsp.gnt                 ),
+    .trace_rvalid_i   ( trace_obi_rsp.rvalid              ),
+    .trace_addr_o     ( trace_obi_req.a.addr              ),
+    .trace_wdata_o    ( trace_obi_req.a.wdata             ),
+    .trace_err_i      ( trace_obi_rsp.r.err               ),
+    .trace_stall_o    ( trace_stall                       ),
+
     .debug_req_i      ( debug_req[SafetyIslandCfg.HartId] ),
     .fetch_enable_i   ( fetch_enable                      )
   );
 
+  // Direct path of the core data port to the core-local peripherals and the timers
+  if (SafetyIslandCfg.UseDataFastPath) begin : gen_fast_path
+    localparam addr_map_rule_t [1:0] FastPathAddrMap = '{
+      '{ idx: 0,
+         start_addr: PeriphBaseAddr+CoreLocalAddrOffset,
+         end_addr: PeriphBaseAddr+CoreLocalAddrOffset+CoreLocalAddrRange },
+      '{ idx: 1,
+         start_addr: PeriphBaseAddr+TimerAddrOffset,
+         end_addr: PeriphBaseAddr+TimerAddrOffset+TimerAddrRange }
+    };
+
+    safety_island_fast_path #(
+      .NumTargets ( 2                            ),
+      .MaxTrans   ( SafetyIslandCfg.XbarMaxTrans ),
+      .rule_t     ( addr_map_rule_t              ),
+      .obi_req_t  ( mgr_obi_req_t                ),
+      .obi_rsp_t  ( mgr_obi_rsp_t                ),
+      .reg_req_t  ( safety_reg_req_t             ),
+      .reg_rsp_t  ( safety_reg_rsp_t             )
+    ) i_fast_path (
+      .clk_i,
+      .rst_ni,
+      .addr_map_i     ( FastPathAddrMap                           ),
+      .sbr_port_req_i ( core_data_obi_req                         ),
+      .sbr_port_rsp_o ( core_data_obi_rsp                         ),
+      .mgr_port_req_o ( core_data_xbar_obi_req                    ),
+      .mgr_port_rsp_i ( core_data_xbar_obi_rsp                    ),
+      .periph_req_i   ( {timer_reg_req,        cl_periph_reg_req} ),
+      .periph_rsp_o   ( {timer_reg_rsp,        cl_periph_reg_rsp} ),
+      .reg_req_o      ( {timer_target_reg_req, cl_target_reg_req} ),
+      .reg_rsp_i      ( {timer_target_reg_rsp, cl_target_reg_rsp} )
+    );
+  end else begin : gen_no_fast_path
+    assign core_data_xbar_obi_req = core_data_obi_req;
+    assign core_data_obi_rsp      = core_data_xbar_obi_rsp;
+    assign cl_target_reg_req      = cl_periph_reg_req;
+    assign cl_periph_reg_rsp      = cl_target_reg_rsp;
+    assign timer_target_reg_req   = timer_reg_req;
+    assign timer_reg_rsp          = timer_target_reg_rsp;
+  end
+
   // -----------------
   // Debug
   // -----------------
@@ -569,6 +977,66 @@ module safety_island_top import safety_island_pkg::*; #(
   // Main Interconnect
   // -----------------
 
+  // QoS stage in front of the crossbar, holds back requests of lower-ranked managers to the same
+  // subordinate
+  mgr_obi_req_t [NumManagers-1:0] qos_mgr_obi_req;
+
+  if (SafetyIslandCfg.UseXbarQos) begin : gen_xbar_qos
+    localparam int unsigned SbrIdxWidth = cf_math_pkg::idx_width(NumSubordinates);
+
+    logic [NumManagers-1:0]                  mgr_req, qos_req, qos_gnt;
+    logic [NumManagers-1:0][SbrIdxWidth-1:0] qos_sbr_idx;
+
+    always_comb begin : proc_qos_sbr_idx
+      for (int unsigned m = 0; m < NumManagers; m++) begin
+        qos_sbr_idx[m] = '0;
+        for (int unsigned r = 0; r < NumRules; r++) begin
+          if (xbar_mgr_obi_req[m].a.addr >= MainAddrMap[r].start_addr &&
+              xbar_mgr_obi_req[m].a.addr <  MainAddrMap[r].end_addr) begin
+            qos_sbr_idx[m] = MainAddrMap[r].idx[SbrIdxWidth-1:0];
+          end
+        end
+      end
+    end
+
+    for (genvar m = 0; m < NumManagers; m++) begin : gen_qos_mgr
+      always_comb begin : proc_qos_mgr_req
+        qos_mgr_obi_req[m]     = xbar_mgr_obi_req[m];
+        qos_mgr_obi_req[m].req = qos_req[m];
+      end
+      assign mgr_req[m] = xbar_mgr_obi_req[m].req;
+      assign qos_gnt[m] = all_mgr_obi_rsp[m].gnt;
+    end
+
+    safety_island_xbar_qos #(
+      .NumManagers     ( NumManagers      ),
+      .NumSubordinates ( NumSubordinates  ),
+      .reg_req_t       ( safety_reg_req_t ),
+      .reg_rsp_t       ( safety_reg_rsp_t )
+    ) i_xbar_qos (
+      .clk_i,
+      .rst_ni,
+      .reg_req_i ( xbar_qos_reg_req ),
+      .reg_rsp_o ( xbar_qos_reg_rsp ),
+      .req_i     ( mgr_req          ),
+      .sbr_idx_i ( qos_sbr_idx      ),
+      .req_o     ( qos_req          ),
+      .gnt_i     ( qos_gnt          )
+    );
+  end else begin : gen_no_xbar_qos
+    assign qos_mgr_obi_req = xbar_mgr_obi_req;
+
+    reg_err_slv #(
+      .DW      ( 32               ),
+      .ERR_VAL ( 32'hBADCAB1E     ),
+      .req_t   ( safety_reg_req_t ),
+      .rsp_t   ( safety_reg_rsp_t )
+    ) i_xbar_qos_err_slv (
+      .req_i   ( xbar_qos_reg_req ),
+      .rsp_o   ( xbar_qos_reg_rsp )
+    );
+  end
+
   obi_xbar #(
     .SbrPortObiCfg      ( MgrObiCfg        ),
     .MgrPortObiCfg      ( XbarSbrObiCfg    ),
@@ -580,7 +1048,7 @@ module safety_island_top import safety_island_pkg::*; #(
     .mgr_port_obi_rsp_t ( xbar_sbr_obi_rsp_t ),
     .NumSbrPorts        ( NumManagers      ),
     .NumMgrPorts        ( NumSubordinates  ),
-    .NumMaxTrans        ( 2                ),
+    .NumMaxTrans        ( SafetyIslandCfg.XbarMaxTrans ),
     .NumAddrRules       ( NumRules         ),
     .addr_map_rule_t    ( addr_map_rule_t  ),
     .UseIdForRouting    ( 1'b0             ),
@@ -590,16 +1058,8 @@ module safety_island_top import safety_island_pkg::*; #(
     .rst_ni,
     .testmode_i       ( test_enable_i ),
 
-    .sbr_ports_req_i  ( {axi_input_obi_req,
-                         core_instr_obi_req,
-                         core_data_obi_req,
-                         core_shadow_obi_req,
-                         dbg_req_obi_req} ),
-    .sbr_ports_rsp_o  ( {axi_input_obi_rsp,
-                         core_instr_obi_rsp,
-                         core_data_obi_rsp,
-                         core_shadow_obi_rsp,
-                         dbg_req_obi_rsp} ),
+    .sbr_ports_req_i  ( qos_mgr_obi_req  ),
+    .sbr_ports_rsp_o  ( all_mgr_obi_rsp  ),
     .mgr_ports_req_o  ( all_sbr_obi_req ),
     .mgr_ports_rsp_i  ( all_sbr_obi_rsp ),
 
@@ -608,6 +1068,26 @@ module safety_island_top import safety_island_pkg::*; #(
     .default_idx_i    ( '0 )
   );
 
+  // Crossbar events of the performance monitor, a bank conflict is a cycle with more than one
+  // manager requesting the bank
+  for (genvar i = 0; i < NumManagers; i++) begin : gen_perf_mgr
+    assign perf_mgr_req[i] = all_mgr_obi_req[i].req;
+    assign perf_mgr_gnt[i] = all_mgr_obi_rsp[i].gnt;
+  end
+
+  always_comb begin : proc_perf_bank_conflict
+    for (int unsigned b = 0; b < SafetyIslandCfg.NumBanks; b++) begin
+      automatic int unsigned num_req = 0;
+      for (int unsigned m = 0; m < NumManagers; m++) begin
+        if (all_mgr_obi_req[m].req && all_mgr_obi_req[m].a.addr >= MainAddrMap[b].start_addr &&
+                                      all_mgr_obi_req[m].a.addr <  MainAddrMap[b].end_addr) begin
+          num_req++;
+        end
+      end
+      perf_bank_conflict[b] = num_req > 1;
+    end
+  end
+
   // -----------------
   // Memories
   // -----------------
@@ -615,9 +1095,61 @@ module safety_island_top import safety_island_pkg::*; #(
   logic [SafetyIslandCfg.NumBanks-1:0] bank_faults;
   logic [SafetyIslandCfg.NumBanks-1:0] scrub_fix;
   logic [SafetyIslandCfg.NumBanks-1:0] scrub_uncorrectable;
-  logic [SafetyIslandCfg.NumBanks-1:0] scrub_trigger;
+  logic [SafetyIslandCfg.NumBanks-1:0] scrub_trigger, ecc_mgr_scrub_trigger;
+  // Requests and stalls of the banks for the scrub policy
+  logic [SafetyIslandCfg.NumBanks-1:0] scrub_bank_req, scrub_bank_stall;
+  // Uncorrectable errors on access and the address of the last access of the banks for the ECC log
+  logic [SafetyIslandCfg.NumBanks-1:0] bank_uncorrectable;
+  logic [SafetyIslandCfg.NumBanks-1:0][AddrWidth-1:0] bank_access_addr;
+
+  // Store-merge buffers
+  logic store_merge_enable;
+  logic [SafetyIslandCfg.NumBanks-1:0] store_merge_pending, store_merge_hit, store_merge_miss;
+
+  // Near-memory AMO units
+  logic [SafetyIslandCfg.NumBanks-1:0] amo_pending;
+
+  // Bank initialization engines
+  logic [SafetyIslandCfg.NumBanks-1:0] bank_init_start, bank_init_busy;
+
+  // Lane ports of the wide AXI input into the banks
+  localparam int unsigned NumWideLanes = AxiDataWidth/DataWidth;
+  logic [SafetyIslandCfg.NumBanks-1:0][NumWideLanes-1:0] wide_bank_req, wide_bank_we;
+  logic [SafetyIslandCfg.NumBanks-1:0][NumWideLanes-1:0] wide_bank_gnt, wide_bank_rvalid;
+  logic [SafetyIslandCfg.NumBanks-1:0][NumWideLanes-1:0] wide_bank_multi_err;
+  logic [SafetyIslandCfg.NumBanks-1:0][NumWideLanes-1:0][AddrWidth-1:0]   wide_bank_addr;
+  logic [SafetyIslandCfg.NumBanks-1:0][NumWideLanes-1:0][DataWidth-1:0]   wide_bank_wdata;
+  logic [SafetyIslandCfg.NumBanks-1:0][NumWideLanes-1:0][DataWidth-1:0]   wide_bank_rdata;
+  logic [SafetyIslandCfg.NumBanks-1:0][NumWideLanes-1:0][DataWidth/8-1:0] wide_bank_be;
 
   for (genvar i = 0; i < SafetyIslandCfg.NumBanks; i++) begin : gen_sram_bank
+    xbar_sbr_obi_req_t amo_bank_obi_req;
+    xbar_sbr_obi_rsp_t amo_bank_obi_rsp;
+
+    if (SafetyIslandCfg.UseAmoUnit) begin : gen_amo_unit
+      safety_island_amo_unit #(
+        .NumEntries ( SafetyIslandCfg.AmoUnitEntries ),
+        .MaxTrans   ( SafetyIslandCfg.XbarMaxTrans   ),
+        .AddrWidth  ( AddrWidth          ),
+        .obi_req_t  ( xbar_sbr_obi_req_t ),
+        .obi_rsp_t  ( xbar_sbr_obi_rsp_t )
+      ) i_amo_unit (
+        .clk_i,
+        .rst_ni,
+        .testmode_i     ( test_enable_i            ),
+        .flush_i        ( |wide_bank_req[i] || bank_init_busy[i] ),
+        .pending_o      ( amo_pending[i]           ),
+        .sbr_port_req_i ( xbar_mem_bank_obi_req[i] ),
+        .sbr_port_rsp_o ( xbar_mem_bank_obi_rsp[i] ),
+        .mgr_port_req_o ( amo_bank_obi_req         ),
+        .mgr_port_rsp_i ( amo_bank_obi_rsp         )
+      );
+    end else begin : gen_no_amo_unit
+      assign amo_bank_obi_req         = xbar_mem_bank_obi_req[i];
+      assign xbar_mem_bank_obi_rsp[i] = amo_bank_obi_rsp;
+      assign amo_pending[i]           = 1'b0;
+    end
+
     obi_atop_resolver #(
       .SbrPortObiCfg             ( XbarSbrObiCfg        ),
       .MgrPortObiCfg             ( SbrObiCfg            ),
@@ -633,8 +1165,8 @@ module safety_island_top import safety_island_pkg::*; #(
       .clk_i,
       .rst_ni,
       .testmode_i     ( test_enable_i            ),
-      .sbr_port_req_i ( xbar_mem_bank_obi_req[i] ),
-      .sbr_port_rsp_o ( xbar_mem_bank_obi_rsp[i] ),
+      .sbr_port_req_i ( amo_bank_obi_req         ),
+      .sbr_port_rsp_o ( amo_bank_obi_rsp         ),
       .mgr_port_req_o ( mem_bank_obi_req[i]      ),
       .mgr_port_rsp_i ( mem_bank_obi_rsp[i]      )
     );
@@ -671,31 +1203,202 @@ module safety_island_top import safety_island_pkg::*; #(
       .rdata_i ( bank_rdata )
     );
 
-    ecc_sram_wrap #(
-      .BankSize        (BankNumWords),
-      .InputECC        (0),
-      .EnableTestMask  (0)
-    ) i_mem_bank (
-      .clk_i,
-      .rst_ni,
-      .test_enable_i         ( test_enable_i ),
-
-      .scrub_trigger_i       ( scrub_trigger      [i] ),
-      .scrubber_fix_o        ( scrub_fix          [i] ),
-      .scrub_uncorrectable_o ( scrub_uncorrectable[i] ),
-
-      .tcdm_wdata_i          ( bank_wdata ),
-      .tcdm_add_i            ( bank_addr  ),
-      .tcdm_req_i            ( bank_req   ),
-      .tcdm_wen_i            ( ~bank_we   ),
-      .tcdm_be_i             ( bank_be    ),
-      .tcdm_rdata_o          ( bank_rdata ),
-      .tcdm_gnt_o            ( bank_gnt   ),
-      .single_error_o        ( bank_faults[i] ),
-      .multi_error_o         ( bank_single_err ),
-
-      .test_write_mask_ni    ( '0 )
-    );
+    // Store-merge buffer between the shim and the memory
+    logic mem_req, mem_we, mem_gnt;
+    logic [AddrWidth-1:0] mem_addr;
+    logic [DataWidth-1:0] mem_wdata, mem_rdata;
+    logic [DataWidth/8-1:0] mem_be;
+    logic [NumWideLanes-1:0] wide_lane_req;
+
+    if (SafetyIslandCfg.UseStoreMerge) begin : gen_store_merge
+      safety_island_store_merge #(
+        .AddrWidth    ( AddrWidth ),
+        .FlushTimeout ( 4         )
+      ) i_store_merge (
+        .clk_i,
+        .rst_ni,
+
+        .enable_i  ( store_merge_enable      ),
+        .flush_i   ( |wide_bank_req[i]       ),
+        .pending_o ( store_merge_pending [i] ),
+        .hit_o     ( store_merge_hit     [i] ),
+        .miss_o    ( store_merge_miss    [i] ),
+
+        .req_i     ( bank_req   ),
+        .we_i      ( bank_we    ),
+        .addr_i    ( bank_addr  ),
+        .wdata_i   ( bank_wdata ),
+        .be_i      ( bank_be    ),
+        .gnt_o     ( bank_gnt   ),
+        .rdata_o   ( bank_rdata ),
+
+        .req_o     ( mem_req    ),
+        .we_o      ( mem_we     ),
+        .addr_o    ( mem_addr   ),
+        .wdata_o   ( mem_wdata  ),
+        .be_o      ( mem_be     ),
+        .gnt_i     ( mem_gnt    ),
+        .rdata_i   ( mem_rdata  )
+      );
+    end else begin : gen_no_store_merge
+      assign mem_req    = bank_req;
+      assign mem_we     = bank_we;
+      assign mem_addr   = bank_addr;
+      assign mem_wdata  = bank_wdata;
+      assign mem_be     = bank_be;
+      assign bank_gnt   = mem_gnt;
+      assign bank_rdata = mem_rdata;
+
+      assign store_merge_pending[i] = 1'b0;
+      assign store_merge_hit    [i] = 1'b0;
+      assign store_merge_miss   [i] = 1'b0;
+    end
+
+    // Zero-initialization of the bank, accesses wait until it is done
+    logic sram_req, sram_we, sram_gnt;
+    logic [AddrWidth-1:0] sram_addr;
+    logic [DataWidth-1:0] sram_wdata, sram_rdata;
+    logic [DataWidth/8-1:0] sram_be;
+
+    if (SafetyIslandCfg.UseBankInit) begin : gen_bank_init
+      safety_island_bank_init #(
+        .NumWords    ( BankNumWords                    ),
+        .AddrWidth   ( AddrWidth                       ),
+        .InitOnReset ( SafetyIslandCfg.BankInitOnReset )
+      ) i_bank_init (
+        .clk_i,
+        .rst_ni,
+
+        .start_i ( bank_init_start[i] ),
+        .busy_o  ( bank_init_busy [i] ),
+
+        .req_i   ( mem_req    ),
+        .we_i    ( mem_we     ),
+        .addr_i  ( mem_addr   ),
+        .wdata_i ( mem_wdata  ),
+        .be_i    ( mem_be     ),
+        .gnt_o   ( mem_gnt    ),
+        .rdata_o ( mem_rdata  ),
+
+        .req_o   ( sram_req   ),
+        .we_o    ( sram_we    ),
+        .addr_o  ( sram_addr  ),
+        .wdata_o ( sram_wdata ),
+        .be_o    ( sram_be    ),
+        .gnt_i   ( sram_gnt   ),
+        .rdata_i ( sram_rdata )
+      );
+    end else begin : gen_no_bank_init
+      assign sram_req   = mem_req;
+      assign sram_we    = mem_we;
+      assign sram_addr  = mem_addr;
+      assign sram_wdata = mem_wdata;
+      assign sram_be    = mem_be;
+      assign mem_gnt    = sram_gnt;
+      assign mem_rdata  = sram_rdata;
+
+      assign bank_init_busy[i] = 1'b0;
+    end
+
+    // The error outputs of the bank follow the access by one cycle. Wide lanes granted next to a
+    // narrow access share the error output, so the narrow address, else that of the lowest
+    // granted lane, is kept.
+    logic [AddrWidth-1:0] access_addr_q, lane_access_addr;
+    logic                 lane_access;
+    always_comb begin : proc_lane_access_addr
+      lane_access      = 1'b0;
+      lane_access_addr = '0;
+      for (int l = NumWideLanes-1; l >= 0; l--) begin
+        if (wide_lane_req[l] && wide_bank_gnt[i][l]) begin
+          lane_access      = 1'b1;
+          lane_access_addr = wide_bank_addr[i][l];
+        end
+      end
+    end
+    always_ff @(posedge clk_i or negedge rst_ni) begin : proc_access_addr
+      if (!rst_ni) begin
+        access_addr_q <= '0;
+      end else if (sram_req && sram_gnt) begin
+        access_addr_q <= sram_addr;
+      end else if (lane_access) begin
+        access_addr_q <= lane_access_addr;
+      end
+    end
+    assign bank_access_addr  [i] = access_addr_q;
+    assign bank_uncorrectable[i] = bank_single_err;
+
+    // Wide accesses wait for buffered partial words of the bank to be written back, for the
+    // AMO unit to drop its copies and for the initialization of the bank
+    assign wide_lane_req = store_merge_pending[i] || amo_pending[i] || bank_init_busy[i] ? '0 :
+                           wide_bank_req[i];
+
+    if (SafetyIslandCfg.UseWideAxiIn) begin : gen_wide_bank
+      safety_island_wide_bank #(
+        .NumWords  ( BankNumWords ),
+        .NumLanes  ( NumWideLanes ),
+        .AddrWidth ( AddrWidth    )
+      ) i_mem_bank (
+        .clk_i,
+        .rst_ni,
+        .test_enable_i,
+
+        .req_i                 ( sram_req        ),
+        .we_i                  ( sram_we         ),
+        .addr_i                ( sram_addr       ),
+        .wdata_i               ( sram_wdata      ),
+        .be_i                  ( sram_be         ),
+        .gnt_o                 ( sram_gnt        ),
+        .rdata_o               ( sram_rdata      ),
+        .multi_err_o           ( bank_single_err ),
+
+        .lane_req_i            ( wide_lane_req          ),
+        .lane_we_i             ( wide_bank_we       [i] ),
+        .lane_addr_i           ( wide_bank_addr     [i] ),
+        .lane_wdata_i          ( wide_bank_wdata    [i] ),
+        .lane_be_i             ( wide_bank_be       [i] ),
+        .lane_gnt_o            ( wide_bank_gnt      [i] ),
+        .lane_rvalid_o         ( wide_bank_rvalid   [i] ),
+        .lane_rdata_o          ( wide_bank_rdata    [i] ),
+        .lane_multi_err_o      ( wide_bank_multi_err[i] ),
+
+        .scrub_trigger_i       ( scrub_trigger      [i] ),
+        .scrub_fix_o           ( scrub_fix          [i] ),
+        .scrub_uncorrectable_o ( scrub_uncorrectable[i] ),
+        .single_err_o          ( bank_faults        [i] )
+      );
+
+      assign scrub_bank_req  [i] = sram_req || |wide_lane_req;
+      assign scrub_bank_stall[i] = (sram_req && !sram_gnt) || |(wide_lane_req & ~wide_bank_gnt[i]);
+    end else begin : gen_bank
+      ecc_sram_wrap #(
+        .BankSize        (BankNumWords),
+        .InputECC        (0),
+        .EnableTestMask  (0)
+      ) i_mem_bank (
+        .clk_i,
+        .rst_ni,
+        .test_enable_i         ( test_enable_i ),
+
+        .scrub_trigger_i       ( scrub_trigger      [i] ),
+        .scrubber_fix_o        ( scrub_fix          [i] ),
+        .scrub_uncorrectable_o ( scrub_uncorrectable[i] ),
+
+        .tcdm_wdata_i          ( sram_wdata ),
+        .tcdm_add_i            ( sram_addr  ),
+        .tcdm_req_i            ( sram_req   ),
+        .tcdm_wen_i            ( ~sram_we   ),
+        .tcdm_be_i             ( sram_be    ),
+        .tcdm_rdata_o          ( sram_rdata ),
+        .tcdm_gnt_o            ( sram_gnt   ),
+        .single_error_o        ( bank_faults[i] ),
+        .multi_error_o         ( bank_single_err ),
+
+        .test_write_mask_ni    ( '0 )
+      );
+
+      assign scrub_bank_req  [i] = sram_req;
+      assign scrub_bank_stall[i] = sram_req && !sram_gnt;
+    end
   end
 
   // ECC Manager
@@ -740,10 +1443,138 @@ module safety_island_top import safety_island_pkg::*; #(
     .bank_faults_i        ( bank_faults         ),
     .scrub_fix_i          ( scrub_fix           ),
     .scrub_uncorrectable_i( scrub_uncorrectable ),
-    .scrub_trigger_o      ( scrub_trigger       ),
+    .scrub_trigger_o      ( ecc_mgr_scrub_trigger ),
     .test_write_mask_no   ()
   );
 
+  // Adaptive scrub policy, triggers the scrubbers in idle bank cycles instead of the ECC manager
+  periph_to_reg #(
+    .AW    ( AddrWidth         ),
+    .DW    ( DataWidth         ),
+    .BW    ( 8                 ),
+    .IW    ( SbrObiCfg.IdWidth ),
+    .req_t ( safety_reg_req_t  ),
+    .rsp_t ( safety_reg_rsp_t  )
+  ) i_scrub_ctrl_translate (
+    .clk_i,
+    .rst_ni,
+
+    .req_i     ( scrub_ctrl_obi_req.req     ),
+    .add_i     ( scrub_ctrl_obi_req.a.addr  ),
+    .wen_i     ( ~scrub_ctrl_obi_req.a.we   ),
+    .wdata_i   ( scrub_ctrl_obi_req.a.wdata ),
+    .be_i      ( scrub_ctrl_obi_req.a.be    ),
+    .id_i      ( scrub_ctrl_obi_req.a.aid   ),
+
+    .gnt_o     ( scrub_ctrl_obi_rsp.gnt     ),
+    .r_rdata_o ( scrub_ctrl_obi_rsp.r.rdata ),
+    .r_opc_o   ( scrub_ctrl_obi_rsp.r.err   ),
+    .r_id_o    ( scrub_ctrl_obi_rsp.r.rid   ),
+    .r_valid_o ( scrub_ctrl_obi_rsp.rvalid  ),
+
+    .reg_req_o ( scrub_ctrl_reg_req ),
+    .reg_rsp_i ( scrub_ctrl_reg_rsp )
+  );
+  assign scrub_ctrl_obi_rsp.r.r_optional = '0;
+
+  if (SafetyIslandCfg.UseScrubCtrl) begin : gen_scrub_ctrl
+    safety_island_scrub_ctrl #(
+      .NumBanks  ( SafetyIslandCfg.NumBanks ),
+      .NumWords  ( BankNumWords     ),
+      .reg_req_t ( safety_reg_req_t ),
+      .reg_rsp_t ( safety_reg_rsp_t )
+    ) i_scrub_ctrl (
+      .clk_i,
+      .rst_ni,
+      .reg_req_i    ( scrub_ctrl_reg_req    ),
+      .reg_rsp_o    ( scrub_ctrl_reg_rsp    ),
+      .bank_req_i   ( scrub_bank_req        ),
+      .bank_stall_i ( scrub_bank_stall      ),
+      .fix_i        ( bank_faults | scrub_fix ),
+      .trigger_i    ( ecc_mgr_scrub_trigger ),
+      .trigger_o    ( scrub_trigger         )
+    );
+  end else begin : gen_no_scrub_ctrl
+    assign scrub_trigger = ecc_mgr_scrub_trigger;
+
+    reg_err_slv #(
+      .DW      ( 32               ),
+      .ERR_VAL ( 32'hBADCAB1E     ),
+      .req_t   ( safety_reg_req_t ),
+      .rsp_t   ( safety_reg_rsp_t )
+    ) i_scrub_ctrl_err_slv (
+      .req_i   ( scrub_ctrl_reg_req ),
+      .rsp_o   ( scrub_ctrl_reg_rsp )
+    );
+  end
+
+  assign perf_ecc_corr = bank_faults | scrub_fix;
+
+  // ECC event log and interrupt
+  periph_to_reg #(
+    .AW    ( AddrWidth         ),
+    .DW    ( DataWidth         ),
+    .BW    ( 8                 ),
+    .IW    ( SbrObiCfg.IdWidth ),
+    .req_t ( safety_reg_req_t  ),
+    .rsp_t ( safety_reg_rsp_t  )
+  ) i_ecc_log_translate (
+    .clk_i,
+    .rst_ni,
+
+    .req_i     ( ecc_log_obi_req.req     ),
+    .add_i     ( ecc_log_obi_req.a.addr  ),
+    .wen_i     ( ~ecc_log_obi_req.a.we   ),
+    .wdata_i   ( ecc_log_obi_req.a.wdata ),
+    .be_i      ( ecc_log_obi_req.a.be    ),
+    .id_i      ( ecc_log_obi_req.a.aid   ),
+
+    .gnt_o     ( ecc_log_obi_rsp.gnt     ),
+    .r_rdata_o ( ecc_log_obi_rsp.r.rdata ),
+    .r_opc_o   ( ecc_log_obi_rsp.r.err   ),
+    .r_id_o    ( ecc_log_obi_rsp.r.rid   ),
+    .r_valid_o ( ecc_log_obi_rsp.rvalid  ),
+
+    .reg_req_o ( ecc_log_reg_req ),
+    .reg_rsp_i ( ecc_log_reg_rsp )
+  );
+  assign ecc_log_obi_rsp.r.r_optional = '0;
+
+  if (SafetyIslandCfg.UseEccLog) begin : gen_ecc_log
+    safety_island_ecc_log #(
+      .NumBanks      ( SafetyIslandCfg.NumBanks    ),
+      .Depth         ( SafetyIslandCfg.EccLogDepth ),
+      .BankAddrWidth ( $clog2(SafetyIslandCfg.BankNumBytes) ),
+      .AddrWidth     ( AddrWidth        ),
+      .reg_req_t     ( safety_reg_req_t ),
+      .reg_rsp_t     ( safety_reg_rsp_t )
+    ) i_ecc_log (
+      .clk_i,
+      .rst_ni,
+      .testmode_i             ( test_enable_i       ),
+      .reg_req_i              ( ecc_log_reg_req     ),
+      .reg_rsp_o              ( ecc_log_reg_rsp     ),
+      .access_corrected_i     ( bank_faults         ),
+      .access_uncorrectable_i ( bank_uncorrectable  ),
+      .scrub_corrected_i      ( scrub_fix           ),
+      .scrub_uncorrectable_i  ( scrub_uncorrectable ),
+      .access_addr_i          ( bank_access_addr    ),
+      .irq_o                  ( s_periph_irqs[PeriphIrqEccLog] )
+    );
+  end else begin : gen_no_ecc_log
+    assign s_periph_irqs[PeriphIrqEccLog] = 1'b0;
+
+    reg_err_slv #(
+      .DW      ( 32               ),
+      .ERR_VAL ( 32'hBADCAB1E     ),
+      .req_t   ( safety_reg_req_t ),
+      .rsp_t   ( safety_reg_rsp_t )
+    ) i_ecc_log_err_slv (
+      .req_i   ( ecc_log_reg_req ),
+      .rsp_o   ( ecc_log_reg_rsp )
+    );
+  end
+
   // -----------------
   // Periphs
   // -----------------
@@ -793,7 +1624,7 @@ module safety_island_top import safety_island_pkg::*; #(
     .obi_req_t   ( sbr_obi_req_t ),
     .obi_rsp_t   ( sbr_obi_rsp_t ),
     .NumMgrPorts ( NumPeriphs    ),
-    .NumMaxTrans ( 2 )
+    .NumMaxTrans ( SafetyIslandCfg.PeriphMaxTrans )
   ) i_obi_demux (
     .clk_i,
     .rst_ni,
@@ -885,6 +1716,22 @@ module safety_island_top import safety_island_pkg::*; #(
     end
   end
 
+  // Interrupts to the host, raised and lowered through the set and clear registers
+  logic [SafetyIslandCfg.NumHostIrqs-1:0] host_irqs_q;
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_host_irqs
+    if (!rst_ni) begin
+      host_irqs_q <= '0;
+    end else if (soc_ctrl_reg2hw.hostirq_set.qe) begin
+      host_irqs_q <= host_irqs_q |  soc_ctrl_reg2hw.hostirq_set.q[SafetyIslandCfg.NumHostIrqs-1:0];
+    end else if (soc_ctrl_reg2hw.hostirq_clr.qe) begin
+      host_irqs_q <= host_irqs_q & ~soc_ctrl_reg2hw.hostirq_clr.q[SafetyIslandCfg.NumHostIrqs-1:0];
+    end
+  end
+
+  assign soc_ctrl_hw2reg.hostirq.d = 32'(host_irqs_q);
+  assign host_irqs_o               = host_irqs_q;
+
   safety_soc_ctrl_reg_top #(
     .reg_req_t( safety_reg_req_t ),
     .reg_rsp_t( safety_reg_rsp_t ),
@@ -993,47 +1840,461 @@ module safety_island_top import safety_island_pkg::*; #(
   );
   assign timer_obi_rsp.r.r_optional = '0;
 
-  // Timer bus (APB interface)
+  // Timer bus, one window of `TimerUnitAddrRange` per timer. Windows without a timer respond with
+  // an error. The timers are on the register interface, or on APB with `UseRegTimer` unset.
   `APB_TYPEDEF_REQ_T(safety_apb_req_t, logic [31:0], logic [31:0], logic [3:0])
   `APB_TYPEDEF_RESP_T(safety_apb_rsp_t, logic [31:0])
-  safety_apb_req_t timer_apb_req;
-  safety_apb_rsp_t timer_apb_rsp;
-
-  reg_to_apb #(
-    .reg_req_t(safety_reg_req_t),
-    .reg_rsp_t(safety_reg_rsp_t),
-    .apb_req_t(safety_apb_req_t),
-    .apb_rsp_t(safety_apb_rsp_t)
-  ) i_reg_to_apb_timer (
+
+  localparam int unsigned NumTimerPorts = SafetyIslandCfg.NumTimers + 1;
+
+  safety_reg_req_t [NumTimerPorts-1:0] timer_unit_reg_req;
+  safety_reg_rsp_t [NumTimerPorts-1:0] timer_unit_reg_rsp;
+  logic [cf_math_pkg::idx_width(NumTimerPorts)-1:0] timer_sel;
+  logic [31:0] timer_idx;
+
+  assign timer_idx = (timer_target_reg_req.addr - (PeriphBaseAddr+TimerAddrOffset)) /
+                     TimerUnitAddrRange;
+  assign timer_sel = timer_idx < SafetyIslandCfg.NumTimers ? timer_idx : SafetyIslandCfg.NumTimers;
+
+  reg_demux #(
+    .NoPorts ( NumTimerPorts    ),
+    .req_t   ( safety_reg_req_t ),
+    .rsp_t   ( safety_reg_rsp_t )
+  ) i_timer_demux (
     .clk_i,
     .rst_ni,
-    // Register interface
-    .reg_req_i (timer_reg_req),
-    .reg_rsp_o (timer_reg_rsp),
-    // APB interface
-    .apb_req_o (timer_apb_req),
-    .apb_rsp_i (timer_apb_rsp)
+
+    .in_select_i ( timer_sel ),
+
+    .in_req_i  ( timer_target_reg_req ),
+    .in_rsp_o  ( timer_target_reg_rsp ),
+
+    .out_req_o ( timer_unit_reg_req ),
+    .out_rsp_i ( timer_unit_reg_rsp )
   );
 
-  apb_timer_unit #(
-    .APB_ADDR_WIDTH(32)
-  ) i_apb_timer_unit (
-    .HCLK       ( clk_i                 ),
-    .HRESETn    ( rst_ni                ),
-    .PADDR      ( timer_apb_req.paddr   ),
-    .PWDATA     ( timer_apb_req.pwdata  ),
-    .PWRITE     ( timer_apb_req.pwrite  ),
-    .PSEL       ( timer_apb_req.psel    ),
-    .PENABLE    ( timer_apb_req.penable ),
-    .PRDATA     ( timer_apb_rsp.prdata  ),
-    .PREADY     ( timer_apb_rsp.pready  ),
-    .PSLVERR    ( timer_apb_rsp.pslverr ),
-    .ref_clk_i,
-    .event_lo_i ('0/*s_timer_in_lo_event*/),
-    .event_hi_i ('0/*s_timer_in_hi_event*/),
-    .irq_lo_o   ( s_timer_irqs[0]       ),
-    .irq_hi_o   ( s_timer_irqs[1]       ),
-    .busy_o     (                       )
+  reg_err_slv #(
+    .DW      ( 32               ),
+    .ERR_VAL ( 32'hBADCAB1E     ),
+    .req_t   ( safety_reg_req_t ),
+    .rsp_t   ( safety_reg_rsp_t )
+  ) i_timer_err_slv (
+    .req_i   ( timer_unit_reg_req[SafetyIslandCfg.NumTimers] ),
+    .rsp_o   ( timer_unit_reg_rsp[SafetyIslandCfg.NumTimers] )
+  );
+
+  // Capture sources of the timers: the event inputs, then the input interrupts. The APB timers
+  // have fixed events instead, the inputs 2*i and 2*i+1 (modulo `NumTimerEvents`) for timer i.
+  localparam int unsigned NumTimerEventSrcs = SafetyIslandCfg.NumTimerEvents +
+                                              SafetyIslandCfg.NumInterrupts;
+
+  logic [NumTimerEventSrcs-1:0] timer_event_srcs;
+
+  assign timer_event_srcs = {irqs_i, timer_events_i};
+
+  for (genvar i = 0; i < SafetyIslandCfg.NumTimers; i++) begin : gen_timer
+    if (SafetyIslandCfg.UseRegTimer) begin : gen_reg_timer
+      safety_island_timer #(
+        .NumEvents ( NumTimerEventSrcs ),
+        .reg_req_t ( safety_reg_req_t  ),
+        .reg_rsp_t ( safety_reg_rsp_t  )
+      ) i_timer (
+        .clk_i,
+        .rst_ni,
+        .ref_clk_i,
+        .reg_req_i ( timer_unit_reg_req[i] ),
+        .reg_rsp_o ( timer_unit_reg_rsp[i] ),
+        .event_i   ( timer_event_srcs      ),
+        .irq_lo_o  ( s_timer_irqs[2*i]     ),
+        .irq_hi_o  ( s_timer_irqs[2*i+1]   )
+      );
+    end else begin : gen_apb_timer
+      safety_apb_req_t timer_apb_req;
+      safety_apb_rsp_t timer_apb_rsp;
+
+      reg_to_apb #(
+        .reg_req_t(safety_reg_req_t),
+        .reg_rsp_t(safety_reg_rsp_t),
+        .apb_req_t(safety_apb_req_t),
+        .apb_rsp_t(safety_apb_rsp_t)
+      ) i_reg_to_apb_timer (
+        .clk_i,
+        .rst_ni,
+        // Register interface
+        .reg_req_i (timer_unit_reg_req[i]),
+        .reg_rsp_o (timer_unit_reg_rsp[i]),
+        // APB interface
+        .apb_req_o (timer_apb_req),
+        .apb_rsp_i (timer_apb_rsp)
+      );
+
+      apb_timer_unit #(
+        .APB_ADDR_WIDTH(32)
+      ) i_apb_timer_unit (
+        .HCLK       ( clk_i                 ),
+        .HRESETn    ( rst_ni                ),
+        .PADDR      ( timer_apb_req.paddr   ),
+        .PWDATA     ( timer_apb_req.pwdata  ),
+        .PWRITE     ( timer_apb_req.pwrite  ),
+        .PSEL       ( timer_apb_req.psel    ),
+        .PENABLE    ( timer_apb_req.penable ),
+        .PRDATA     ( timer_apb_rsp.prdata  ),
+        .PREADY     ( timer_apb_rsp.pready  ),
+        .PSLVERR    ( timer_apb_rsp.pslverr ),
+        .ref_clk_i,
+        .event_lo_i ( timer_events_i[(2*i)   % SafetyIslandCfg.NumTimerEvents] ),
+        .event_hi_i ( timer_events_i[(2*i+1) % SafetyIslandCfg.NumTimerEvents] ),
+        .irq_lo_o   ( s_timer_irqs[2*i]     ),
+        .irq_hi_o   ( s_timer_irqs[2*i+1]   ),
+        .busy_o     (                       )
+      );
+    end
+  end
+
+  // Instruction cache configuration
+  periph_to_reg #(
+    .AW    ( AddrWidth         ),
+    .DW    ( DataWidth         ),
+    .BW    ( 8                 ),
+    .IW    ( SbrObiCfg.IdWidth ),
+    .req_t ( safety_reg_req_t  ),
+    .rsp_t ( safety_reg_rsp_t  )
+  ) i_icache_translate (
+    .clk_i,
+    .rst_ni,
+
+    .req_i     ( icache_obi_req.req     ),
+    .add_i     ( icache_obi_req.a.addr  ),
+    .wen_i     ( ~icache_obi_req.a.we   ),
+    .wdata_i   ( icache_obi_req.a.wdata ),
+    .be_i      ( icache_obi_req.a.be    ),
+    .id_i      ( icache_obi_req.a.aid   ),
+
+    .gnt_o     ( icache_obi_rsp.gnt     ),
+    .r_rdata_o ( icache_obi_rsp.r.rdata ),
+    .r_opc_o   ( icache_obi_rsp.r.err   ),
+    .r_id_o    ( icache_obi_rsp.r.rid   ),
+    .r_valid_o ( icache_obi_rsp.rvalid  ),
+
+    .reg_req_o ( icache_reg_req ),
+    .reg_rsp_i ( icache_reg_rsp )
+  );
+  assign icache_obi_rsp.r.r_optional = '0;
+
+  // Sensor DMA
+  periph_to_reg #(
+    .AW    ( AddrWidth         ),
+    .DW    ( DataWidth         ),
+    .BW    ( 8                 ),
+    .IW    ( SbrObiCfg.IdWidth ),
+    .req_t ( safety_reg_req_t  ),
+    .rsp_t ( safety_reg_rsp_t  )
+  ) i_sensor_dma_translate (
+    .clk_i,
+    .rst_ni,
+
+    .req_i     ( sensor_dma_cfg_obi_req.req     ),
+    .add_i     ( sensor_dma_cfg_obi_req.a.addr  ),
+    .wen_i     ( ~sensor_dma_cfg_obi_req.a.we   ),
+    .wdata_i   ( sensor_dma_cfg_obi_req.a.wdata ),
+    .be_i      ( sensor_dma_cfg_obi_req.a.be    ),
+    .id_i      ( sensor_dma_cfg_obi_req.a.aid   ),
+
+    .gnt_o     ( sensor_dma_cfg_obi_rsp.gnt     ),
+    .r_rdata_o ( sensor_dma_cfg_obi_rsp.r.rdata ),
+    .r_opc_o   ( sensor_dma_cfg_obi_rsp.r.err   ),
+    .r_id_o    ( sensor_dma_cfg_obi_rsp.r.rid   ),
+    .r_valid_o ( sensor_dma_cfg_obi_rsp.rvalid  ),
+
+    .reg_req_o ( sensor_dma_reg_req ),
+    .reg_rsp_i ( sensor_dma_reg_rsp )
+  );
+  assign sensor_dma_cfg_obi_rsp.r.r_optional = '0;
+
+  if (SafetyIslandCfg.UseSensorDma) begin : gen_sensor_dma
+    safety_island_sensor_dma #(
+      .NumDesc   ( SafetyIslandCfg.SensorDmaNumDesc ),
+      .obi_req_t ( mgr_obi_req_t    ),
+      .obi_rsp_t ( mgr_obi_rsp_t    ),
+      .reg_req_t ( safety_reg_req_t ),
+      .reg_rsp_t ( safety_reg_rsp_t )
+    ) i_sensor_dma (
+      .clk_i,
+      .rst_ni,
+      .timer_lo_i ( s_timer_irqs[0]    ),
+      .timer_hi_i ( s_timer_irqs[1]    ),
+      .obi_req_o  ( sensor_dma_obi_req ),
+      .obi_rsp_i  ( sensor_dma_obi_rsp ),
+      .reg_req_i  ( sensor_dma_reg_req ),
+      .reg_rsp_o  ( sensor_dma_reg_rsp ),
+      .irq_o      ( s_periph_irqs[PeriphIrqSensorDma] )
+    );
+  end else begin : gen_no_sensor_dma
+    assign sensor_dma_obi_req = '0;
+    assign s_periph_irqs[PeriphIrqSensorDma] = 1'b0;
+
+    reg_err_slv #(
+      .DW      ( 32               ),
+      .ERR_VAL ( 32'hBADCAB1E     ),
+      .req_t   ( safety_reg_req_t ),
+      .rsp_t   ( safety_reg_rsp_t )
+    ) i_sensor_dma_err_slv (
+      .req_i   ( sensor_dma_reg_req ),
+      .rsp_o   ( sensor_dma_reg_rsp )
+    );
+  end
+
+  // Store-merge buffers
+  periph_to_reg #(
+    .AW    ( AddrWidth         ),
+    .DW    ( DataWidth         ),
+    .BW    ( 8                 ),
+    .IW    ( SbrObiCfg.IdWidth ),
+    .req_t ( safety_reg_req_t  ),
+    .rsp_t ( safety_reg_rsp_t  )
+  ) i_store_merge_translate (
+    .clk_i,
+    .rst_ni,
+
+    .req_i     ( store_merge_obi_req.req     ),
+    .add_i     ( store_merge_obi_req.a.addr  ),
+    .wen_i     ( ~store_merge_obi_req.a.we   ),
+    .wdata_i   ( store_merge_obi_req.a.wdata ),
+    .be_i      ( store_merge_obi_req.a.be    ),
+    .id_i      ( store_merge_obi_req.a.aid   ),
+
+    .gnt_o     ( store_merge_obi_rsp.gnt     ),
+    .r_rdata_o ( store_merge_obi_rsp.r.rdata ),
+    .r_opc_o   ( store_merge_obi_rsp.r.err   ),
+    .r_id_o    ( store_merge_obi_rsp.r.rid   ),
+    .r_valid_o ( store_merge_obi_rsp.rvalid  ),
+
+    .reg_req_o ( store_merge_reg_req ),
+    .reg_rsp_i ( store_merge_reg_rsp )
+  );
+  assign store_merge_obi_rsp.r.r_optional = '0;
+
+  if (SafetyIslandCfg.UseStoreMerge) begin : gen_store_merge_regs
+    safety_island_store_merge_regs #(
+      .NumBanks  ( SafetyIslandCfg.NumBanks ),
+      .reg_req_t ( safety_reg_req_t ),
+      .reg_rsp_t ( safety_reg_rsp_t )
+    ) i_store_merge_regs (
+      .clk_i,
+      .rst_ni,
+      .reg_req_i ( store_merge_reg_req ),
+      .reg_rsp_o ( store_merge_reg_rsp ),
+      .enable_o  ( store_merge_enable  ),
+      .hit_i     ( store_merge_hit     ),
+      .miss_i    ( store_merge_miss    )
+    );
+  end else begin : gen_no_store_merge_regs
+    assign store_merge_enable = 1'b0;
+
+    reg_err_slv #(
+      .DW      ( 32               ),
+      .ERR_VAL ( 32'hBADCAB1E     ),
+      .req_t   ( safety_reg_req_t ),
+      .rsp_t   ( safety_reg_rsp_t )
+    ) i_store_merge_err_slv (
+      .req_i   ( store_merge_reg_req ),
+      .rsp_o   ( store_merge_reg_rsp )
+    );
+  end
+
+  // SCMI mailbox
+  periph_to_reg #(
+    .AW    ( AddrWidth         ),
+    .DW    ( DataWidth         ),
+    .BW    ( 8                 ),
+    .IW    ( SbrObiCfg.IdWidth ),
+    .req_t ( safety_reg_req_t  ),
+    .rsp_t ( safety_reg_rsp_t  )
+  ) i_mailbox_translate (
+    .clk_i,
+    .rst_ni,
+
+    .req_i     ( mailbox_obi_req.req     ),
+    .add_i     ( mailbox_obi_req.a.addr  ),
+    .wen_i     ( ~mailbox_obi_req.a.we   ),
+    .wdata_i   ( mailbox_obi_req.a.wdata ),
+    .be_i      ( mailbox_obi_req.a.be    ),
+    .id_i      ( mailbox_obi_req.a.aid   ),
+
+    .gnt_o     ( mailbox_obi_rsp.gnt     ),
+    .r_rdata_o ( mailbox_obi_rsp.r.rdata ),
+    .r_opc_o   ( mailbox_obi_rsp.r.err   ),
+    .r_id_o    ( mailbox_obi_rsp.r.rid   ),
+    .r_valid_o ( mailbox_obi_rsp.rvalid  ),
+
+    .reg_req_o ( mailbox_reg_req ),
+    .reg_rsp_i ( mailbox_reg_rsp )
+  );
+  assign mailbox_obi_rsp.r.r_optional = '0;
+
+  if (SafetyIslandCfg.UseMailbox) begin : gen_mailbox
+    safety_island_mailbox #(
+      .NumChannels ( SafetyIslandCfg.MailboxNumChannels ),
+      .reg_req_t   ( safety_reg_req_t ),
+      .reg_rsp_t   ( safety_reg_rsp_t )
+    ) i_mailbox (
+      .clk_i,
+      .rst_ni,
+      .reg_req_i         ( mailbox_reg_req                 ),
+      .reg_rsp_o         ( mailbox_reg_rsp                 ),
+      .doorbell_irq_o    ( s_periph_irqs[PeriphIrqMailbox] ),
+      .completion_irqs_o ( mailbox_irqs_o                  )
+    );
+  end else begin : gen_no_mailbox
+    assign s_periph_irqs[PeriphIrqMailbox] = 1'b0;
+    assign mailbox_irqs_o                  = '0;
+
+    reg_err_slv #(
+      .DW      ( 32               ),
+      .ERR_VAL ( 32'hBADCAB1E     ),
+      .req_t   ( safety_reg_req_t ),
+      .rsp_t   ( safety_reg_rsp_t )
+    ) i_mailbox_err_slv (
+      .req_i   ( mailbox_reg_req ),
+      .rsp_o   ( mailbox_reg_rsp )
+    );
+  end
+
+  // Time-triggered activation table
+  localparam int unsigned NumSchedIrqs = SafetyIslandCfg.UseSchedTable ?
+                                         SafetyIslandCfg.SchedTableNumIrqs : 0;
+
+  periph_to_reg #(
+    .AW    ( AddrWidth         ),
+    .DW    ( DataWidth         ),
+    .BW    ( 8                 ),
+    .IW    ( SbrObiCfg.IdWidth ),
+    .req_t ( safety_reg_req_t  ),
+    .rsp_t ( safety_reg_rsp_t  )
+  ) i_sched_table_translate (
+    .clk_i,
+    .rst_ni,
+
+    .req_i     ( sched_table_obi_req.req     ),
+    .add_i     ( sched_table_obi_req.a.addr  ),
+    .wen_i     ( ~sched_table_obi_req.a.we   ),
+    .wdata_i   ( sched_table_obi_req.a.wdata ),
+    .be_i      ( sched_table_obi_req.a.be    ),
+    .id_i      ( sched_table_obi_req.a.aid   ),
+
+    .gnt_o     ( sched_table_obi_rsp.gnt     ),
+    .r_rdata_o ( sched_table_obi_rsp.r.rdata ),
+    .r_opc_o   ( sched_table_obi_rsp.r.err   ),
+    .r_id_o    ( sched_table_obi_rsp.r.rid   ),
+    .r_valid_o ( sched_table_obi_rsp.rvalid  ),
+
+    .reg_req_o ( sched_table_reg_req ),
+    .reg_rsp_i ( sched_table_reg_rsp )
+  );
+  assign sched_table_obi_rsp.r.r_optional = '0;
+
+  if (SafetyIslandCfg.UseSchedTable) begin : gen_sched_table
+    safety_island_sched_table #(
+      .NumIrqs    ( SafetyIslandCfg.SchedTableNumIrqs ),
+      .NumEntries ( SafetyIslandCfg.SchedTableEntries ),
+      .reg_req_t  ( safety_reg_req_t                  ),
+      .reg_rsp_t  ( safety_reg_rsp_t                  )
+    ) i_sched_table (
+      .clk_i,
+      .rst_ni,
+      .ref_clk_i,
+      .reg_req_i ( sched_table_reg_req ),
+      .reg_rsp_o ( sched_table_reg_rsp ),
+      .irq_o     ( s_periph_irqs[PeriphIrqSchedTable+:SafetyIslandCfg.SchedTableNumIrqs] )
+    );
+  end else begin : gen_no_sched_table
+    reg_err_slv #(
+      .DW      ( 32               ),
+      .ERR_VAL ( 32'hBADCAB1E     ),
+      .req_t   ( safety_reg_req_t ),
+      .rsp_t   ( safety_reg_rsp_t )
+    ) i_sched_table_err_slv (
+      .req_i   ( sched_table_reg_req ),
+      .rsp_o   ( sched_table_reg_rsp )
+    );
+  end
+
+  if (PeriphIrqSchedTable+NumSchedIrqs < NumPeriphInterrupts) begin : gen_periph_irqs_unused
+    assign s_periph_irqs[NumPeriphInterrupts-1:PeriphIrqSchedTable+NumSchedIrqs] = '0;
+  end
+
+  // Crossbar QoS registers
+  periph_to_reg #(
+    .AW    ( AddrWidth         ),
+    .DW    ( DataWidth         ),
+    .BW    ( 8                 ),
+    .IW    ( SbrObiCfg.IdWidth ),
+    .req_t ( safety_reg_req_t  ),
+    .rsp_t ( safety_reg_rsp_t  )
+  ) i_xbar_qos_translate (
+    .clk_i,
+    .rst_ni,
+
+    .req_i     ( xbar_qos_obi_req.req     ),
+    .add_i     ( xbar_qos_obi_req.a.addr  ),
+    .wen_i     ( ~xbar_qos_obi_req.a.we   ),
+    .wdata_i   ( xbar_qos_obi_req.a.wdata ),
+    .be_i      ( xbar_qos_obi_req.a.be    ),
+    .id_i      ( xbar_qos_obi_req.a.aid   ),
+
+    .gnt_o     ( xbar_qos_obi_rsp.gnt     ),
+    .r_rdata_o ( xbar_qos_obi_rsp.r.rdata ),
+    .r_opc_o   ( xbar_qos_obi_rsp.r.err   ),
+    .r_id_o    ( xbar_qos_obi_rsp.r.rid   ),
+    .r_valid_o ( xbar_qos_obi_rsp.rvalid  ),
+
+    .reg_req_o ( xbar_qos_reg_req ),
+    .reg_rsp_i ( xbar_qos_reg_rsp )
+  );
+  assign xbar_qos_obi_rsp.r.r_optional = '0;
+
+  // Bank initialization
+  periph_to_reg #(
+    .AW    ( AddrWidth         ),
+    .DW    ( DataWidth         ),
+    .BW    ( 8                 ),
+    .IW    ( SbrObiCfg.IdWidth ),
+    .req_t ( safety_reg_req_t  ),
+    .rsp_t ( safety_reg_rsp_t  )
+  ) i_bank_init_translate (
+    .clk_i,
+    .rst_ni,
+
+    .req_i     ( bank_init_obi_req.req     ),
+    .add_i     ( bank_init_obi_req.a.addr  ),
+    .wen_i     ( ~bank_init_obi_req.a.we   ),
+    .wdata_i   ( bank_init_obi_req.a.wdata ),
+    .be_i      ( bank_init_obi_req.a.be    ),
+    .id_i      ( bank_init_obi_req.a.aid   ),
+
+    .gnt_o     ( bank_init_obi_rsp.gnt     ),
+    .r_rdata_o ( bank_init_obi_rsp.r.rdata ),
+    .r_opc_o   ( bank_init_obi_rsp.r.err   ),
+    .r_id_o    ( bank_init_obi_rsp.r.rid   ),
+    .r_valid_o ( bank_init_obi_rsp.rvalid  ),
+
+    .reg_req_o ( bank_init_reg_req ),
+    .reg_rsp_i ( bank_init_reg_rsp )
+  );
+  assign bank_init_obi_rsp.r.r_optional = '0;
+
+  // Without the engines, the banks always read as initialized
+  safety_island_bank_init_regs #(
+    .NumBanks  ( SafetyIslandCfg.NumBanks ),
+    .reg_req_t ( safety_reg_req_t ),
+    .reg_rsp_t ( safety_reg_rsp_t )
+  ) i_bank_init_regs (
+    .clk_i,
+    .rst_ni,
+    .reg_req_i ( bank_init_reg_req ),
+    .reg_rsp_o ( bank_init_reg_rsp ),
+    .start_o   ( bank_init_start   ),
+    .busy_i    ( bank_init_busy    )
   );
 
 `ifdef TARGET_SIMULATION
@@ -1077,6 +2338,160 @@ module safety_island_top import safety_island_pkg::*; #(
 
   // AXI input
 
+  axi_input_req_t  axi_in_narrow_req;
+  axi_input_resp_t axi_in_narrow_rsp;
+
+  if (SafetyIslandCfg.UseWideAxiIn) begin : gen_wide_axi_in
+    localparam bit [31:0] MemBaseAddr = BaseAddr32 + MemOffset;
+    localparam bit [31:0] MemEndAddr  = MemBaseAddr +
+                                        SafetyIslandCfg.NumBanks*SafetyIslandCfg.BankNumBytes;
+
+    axi_input_req_t  axi_in_wide_req;
+    axi_input_resp_t axi_in_wide_rsp;
+
+    // Plain accesses to the memory take the wide path, everything else the narrow path through
+    // the crossbar.
+    logic aw_wide, ar_wide, aw_sel, aw_sel_q, aw_sel_hold_q;
+
+    logic [NumManagers-1:0] mgr_lr_req, mgr_sc_req, lr_reserved_q, lr_overlap;
+    logic [NumManagers-1:0][31:0] lr_addr_q;
+    logic [31:0] aw_bytes, aw_lo, aw_hi;
+    logic [7:0] wide_writes_q;
+
+    for (genvar i = 0; i < NumManagers; i++) begin : gen_mgr_lrsc
+      assign mgr_lr_req[i] = all_mgr_obi_req[i].req &&
+                             all_mgr_obi_req[i].a.a_optional.atop == obi_pkg::ATOPLR;
+      assign mgr_sc_req[i] = all_mgr_obi_req[i].req &&
+                             all_mgr_obi_req[i].a.a_optional.atop == obi_pkg::ATOPSC;
+      assign lr_overlap[i] = lr_reserved_q[i] && lr_addr_q[i] >= aw_lo && lr_addr_q[i] < aw_hi;
+    end
+
+    // Wide writes bypass the LR/SC reservations of the atop resolvers. A reservation stays valid
+    // in the resolver until its manager issues an SC, so it is tracked with its word address until
+    // then, and writes overlapping a reserved word take the narrow path. The byte range of the
+    // burst is rounded down to its size, which covers INCR, WRAP and FIXED bursts. New LRs wait
+    // for outstanding wide writes to complete.
+    assign aw_bytes = (32'(axi_input_req_i.aw.len) + 1) << axi_input_req_i.aw.size;
+    assign aw_lo    = axi_input_req_i.aw.addr[31:0] & ~(aw_bytes - 1) & ~32'h3;
+    assign aw_hi    = axi_input_req_i.aw.addr[31:0] + aw_bytes;
+    assign aw_wide = axi_input_req_i.aw.addr[31:0] >= MemBaseAddr &&
+                     axi_input_req_i.aw.addr[31:0] <  MemEndAddr  &&
+                     axi_input_req_i.aw.atop == '0 && !axi_input_req_i.aw.lock &&
+                     !(|lr_overlap) && !(|mgr_lr_req);
+    assign ar_wide = axi_input_req_i.ar.addr[31:0] >= MemBaseAddr &&
+                     axi_input_req_i.ar.addr[31:0] <  MemEndAddr  &&
+                     !axi_input_req_i.ar.lock;
+    // Hold the selection of a stalled AW
+    assign aw_sel  = aw_sel_hold_q ? aw_sel_q : aw_wide;
+
+    always_ff @(posedge clk_i or negedge rst_ni) begin : proc_wide_axi_in
+      if (!rst_ni) begin
+        aw_sel_q      <= 1'b0;
+        aw_sel_hold_q <= 1'b0;
+        lr_reserved_q <= '0;
+        lr_addr_q     <= '0;
+        wide_writes_q <= '0;
+      end else begin
+        aw_sel_q      <= aw_sel;
+        aw_sel_hold_q <= axi_input_req_i.aw_valid && !axi_input_resp_o.aw_ready;
+        for (int i = 0; i < NumManagers; i++) begin
+          if (all_mgr_obi_rsp[i].gnt && mgr_lr_req[i]) begin
+            lr_reserved_q[i] <= 1'b1;
+            lr_addr_q[i]     <= {all_mgr_obi_req[i].a.addr[31:2], 2'b00};
+          end else if (all_mgr_obi_rsp[i].gnt && mgr_sc_req[i]) begin
+            lr_reserved_q[i] <= 1'b0;
+          end
+        end
+        wide_writes_q <= wide_writes_q +
+                         (axi_in_wide_req.aw_valid && axi_in_wide_rsp.aw_ready) -
+                         (axi_in_wide_rsp.b_valid  && axi_in_wide_req.b_ready);
+      end
+    end
+
+    always_comb begin : proc_lr_hold
+      xbar_mgr_obi_req = all_mgr_obi_req;
+      for (int i = 0; i < NumManagers; i++) begin
+        if (mgr_lr_req[i] && (wide_writes_q != '0 || (axi_input_req_i.aw_valid && aw_sel))) begin
+          xbar_mgr_obi_req[i].req = 1'b0;
+        end
+      end
+    end
+
+    axi_demux_simple #(
+      .AxiIdWidth  ( AxiInputIdWidth  ),
+      .AtopSupport ( 1'b1             ),
+      .axi_req_t   ( axi_input_req_t  ),
+      .axi_resp_t  ( axi_input_resp_t ),
+      .NoMstPorts  ( 2                ),
+      .MaxTrans    ( SafetyIslandCfg.AxiInMaxTrans ),
+      .AxiLookBits ( AxiInputIdWidth  ),
+      .UniqueIds   ( 1'b0             )
+    ) i_axi_in_demux (
+      .clk_i,
+      .rst_ni,
+      .test_i          ( test_enable_i    ),
+      .slv_req_i       ( axi_input_req_i  ),
+      .slv_aw_select_i ( aw_sel           ),
+      .slv_ar_select_i ( ar_wide          ),
+      .slv_resp_o      ( axi_input_resp_o ),
+      .mst_reqs_o      ( {axi_in_wide_req, axi_in_narrow_req} ),
+      .mst_resps_i     ( {axi_in_wide_rsp, axi_in_narrow_rsp} )
+    );
+
+    safety_island_wide_axi_in #(
+      .NumBanks         ( SafetyIslandCfg.NumBanks     ),
+      .BankNumBytes     ( SafetyIslandCfg.BankNumBytes ),
+      .MemBaseAddr      ( MemBaseAddr      ),
+      .AxiAddrWidth     ( AxiAddrWidth     ),
+      .AxiDataWidth     ( AxiDataWidth     ),
+      .AxiIdWidth       ( AxiInputIdWidth  ),
+      .AxiUserWidth     ( AxiUserWidth     ),
+      .MaxTrans         ( SafetyIslandCfg.AxiInMaxTrans ),
+      .AxiUserAtop      ( AxiUserAtop      ),
+      .AxiUserAtopMsb   ( AxiUserAtopMsb   ),
+      .AxiUserAtopLsb   ( AxiUserAtopLsb   ),
+      .AxiUserEccErr    ( AxiUserEccErr    ),
+      .AxiUserEccErrBit ( AxiUserEccErrBit ),
+      .axi_req_t        ( axi_input_req_t  ),
+      .axi_rsp_t        ( axi_input_resp_t )
+    ) i_wide_axi_in (
+      .clk_i,
+      .rst_ni,
+      .axi_req_i        ( axi_in_wide_req     ),
+      .axi_rsp_o        ( axi_in_wide_rsp     ),
+      .bank_req_o       ( wide_bank_req       ),
+      .bank_we_o        ( wide_bank_we        ),
+      .bank_addr_o      ( wide_bank_addr      ),
+      .bank_wdata_o     ( wide_bank_wdata     ),
+      .bank_be_o        ( wide_bank_be        ),
+      .bank_gnt_i       ( wide_bank_gnt       ),
+      .bank_rvalid_i    ( wide_bank_rvalid    ),
+      .bank_rdata_i     ( wide_bank_rdata     ),
+      .bank_multi_err_i ( wide_bank_multi_err )
+    );
+
+    // pragma translate_off
+    `ifndef VERILATOR
+    initial begin : proc_assert_wide_axi_in
+      assert (AxiDataWidth > DataWidth) else
+        $fatal(1, "The wide AXI input requires an AXI data width above %0d!", DataWidth);
+      assert (BankNumWords % NumWideLanes == 0) else
+        $fatal(1, "The bank size must be a multiple of the AXI data width!");
+    end
+    `endif
+    // pragma translate_on
+  end else begin : gen_no_wide_axi_in
+    assign axi_in_narrow_req = axi_input_req_i;
+    assign axi_input_resp_o  = axi_in_narrow_rsp;
+    assign xbar_mgr_obi_req  = all_mgr_obi_req;
+
+    assign wide_bank_req   = '0;
+    assign wide_bank_we    = '0;
+    assign wide_bank_addr  = '0;
+    assign wide_bank_wdata = '0;
+    assign wide_bank_be    = '0;
+  end
+
   localparam int unsigned NumInterBanks = AxiDataWidth/MgrObiCfg.DataWidth;
   logic [NumInterBanks-1:0][AxiInputIdWidth-1:0] axi_in_aw_id, axi_in_ar_id;
   logic [NumInterBanks-1:0][AxiUserWidth-1:0] axi_in_aw_user, axi_in_w_user, axi_in_ar_user;
@@ -1151,15 +2566,15 @@ module safety_island_top import safety_island_pkg::*; #(
     .AxiDataWidth   ( AxiDataWidth     ),
     .AxiIdWidth     ( AxiInputIdWidth  ),
     .AxiUserWidth   ( AxiUserWidth     ),
-    .MaxTrans       ( 2                ),
+    .MaxTrans       ( SafetyIslandCfg.AxiInMaxTrans ),
     .axi_req_t      ( axi_input_req_t  ),
     .axi_rsp_t      ( axi_input_resp_t )
   ) i_axi_to_obi (
     .clk_i,
     .rst_ni,
     .testmode_i        ( test_enable_i      ),
-    .axi_req_i         ( axi_input_req_i    ),
-    .axi_rsp_o         ( axi_input_resp_o   ),
+    .axi_req_i         ( axi_in_narrow_req  ),
+    .axi_rsp_o         ( axi_in_narrow_rsp  ),
     .obi_req_o         ( axi_input_obi_req  ),
     .obi_rsp_i         ( axi_input_obi_rsp  ),
 
@@ -1193,6 +2608,169 @@ module safety_island_top import safety_island_pkg::*; #(
 
   // AXI output
 
+  // The crossbar, the instruction cache refills and the posted-write buffer share the AXI output
+  // through a mux, which uses the MSBs of the AXI ID to route the responses.
+  localparam int unsigned NumAxiOutPorts       = axi_out_num_ports(SafetyIslandCfg);
+  localparam int unsigned AxiOutIdxICache      = 1;
+  localparam int unsigned AxiOutIdxWriteBuffer = 1 + SafetyIslandCfg.UseICache;
+  localparam int unsigned AxiOutMuxIdWidth     = AxiOutputIdWidth > $clog2(NumAxiOutPorts) ?
+                                                 AxiOutputIdWidth - $clog2(NumAxiOutPorts) : 1;
+
+  if (AxiOutputIdWidth <= $clog2(NumAxiOutPorts)) begin : gen_axi_out_id_check
+    $fatal(1, "AxiOutputIdWidth must be larger than %0d", $clog2(NumAxiOutPorts));
+  end
+
+  `AXI_TYPEDEF_ALL(axi_out_mux,
+                   logic[AxiAddrWidth-1:0],
+                   logic[AxiOutMuxIdWidth-1:0],
+                   logic[AxiDataWidth-1:0],
+                   logic[AxiDataWidth/8-1:0],
+                   logic[AxiUserWidth-1:0])
+  `AXI_TYPEDEF_ALL(axi_out_full,
+                   logic[AxiAddrWidth-1:0],
+                   logic[AxiOutputIdWidth-1:0],
+                   logic[AxiDataWidth-1:0],
+                   logic[AxiDataWidth/8-1:0],
+                   logic[AxiUserWidth-1:0])
+
+  axi_out_mux_req_t  [NumAxiOutPorts-1:0] axi_out_mux_req;
+  axi_out_mux_resp_t [NumAxiOutPorts-1:0] axi_out_mux_rsp;
+  axi_out_mux_req_t  xbar_axi_out_req;
+  axi_out_mux_resp_t xbar_axi_out_rsp;
+  assign axi_out_mux_req[0] = xbar_axi_out_req;
+  assign xbar_axi_out_rsp   = axi_out_mux_rsp[0];
+
+  if (SafetyIslandCfg.UseICache) begin : gen_icache
+    safety_island_icache #(
+      .NumLines        ( SafetyIslandCfg.ICacheNumLines  ),
+      .LineBytes       ( SafetyIslandCfg.ICacheLineBytes ),
+      .IslandBaseAddr  ( BaseAddr32         ),
+      .IslandAddrRange ( AddrRange          ),
+      .AxiAddrWidth    ( AxiAddrWidth       ),
+      .AxiDataWidth    ( AxiDataWidth       ),
+      .AxiUserWidth    ( AxiUserWidth       ),
+      .AxiUser         ( DefaultUser        ),
+      .AxiUserEccErr   ( AxiUserEccErr      ),
+      .AxiUserEccErrBit ( AxiUserEccErrBit  ),
+      .MaxBypassTrans  ( SafetyIslandCfg.XbarMaxTrans ),
+      .axi_req_t       ( axi_out_mux_req_t  ),
+      .axi_rsp_t       ( axi_out_mux_resp_t ),
+      .obi_req_t       ( mgr_obi_req_t      ),
+      .obi_rsp_t       ( mgr_obi_rsp_t      ),
+      .reg_req_t       ( safety_reg_req_t   ),
+      .reg_rsp_t       ( safety_reg_rsp_t   )
+    ) i_icache (
+      .clk_i,
+      .rst_ni,
+      .core_req_i   ( core_fetch_obi_req               ),
+      .core_rsp_o   ( core_fetch_obi_rsp               ),
+      .bypass_req_o ( core_instr_obi_req               ),
+      .bypass_rsp_i ( core_instr_obi_rsp               ),
+      .axi_req_o    ( axi_out_mux_req[AxiOutIdxICache] ),
+      .axi_rsp_i    ( axi_out_mux_rsp[AxiOutIdxICache] ),
+      .reg_req_i    ( icache_reg_req                   ),
+      .reg_rsp_o    ( icache_reg_rsp                   )
+    );
+  end else begin : gen_no_icache
+    assign core_instr_obi_req = core_fetch_obi_req;
+    assign core_fetch_obi_rsp = core_instr_obi_rsp;
+
+    reg_err_slv #(
+      .DW      ( 32               ),
+      .ERR_VAL ( 32'hBADCAB1E     ),
+      .req_t   ( safety_reg_req_t ),
+      .rsp_t   ( safety_reg_rsp_t )
+    ) i_icache_err_slv (
+      .req_i   ( icache_reg_req ),
+      .rsp_o   ( icache_reg_rsp )
+    );
+  end
+
+  // Posted-write buffer between the crossbar and obi_to_axi
+  xbar_sbr_obi_req_t axi_out_obi_req;
+  xbar_sbr_obi_rsp_t axi_out_obi_rsp;
+
+  if (SafetyIslandCfg.UseWriteBuffer) begin : gen_write_buffer
+    safety_island_write_buffer #(
+      .NumEntries   ( SafetyIslandCfg.WriteBufferEntries    ),
+      .BurstWords   ( SafetyIslandCfg.WriteBufferBurstWords ),
+      .MergeTimeout ( 8                  ),
+      .AxiAddrWidth ( AxiAddrWidth       ),
+      .AxiDataWidth ( AxiDataWidth       ),
+      .AxiUserWidth ( AxiUserWidth       ),
+      .AxiUser      ( DefaultUser        ),
+      .AxiUserEccErr    ( AxiUserEccErr    ),
+      .AxiUserEccErrBit ( AxiUserEccErrBit ),
+      .obi_req_t    ( xbar_sbr_obi_req_t ),
+      .obi_rsp_t    ( xbar_sbr_obi_rsp_t ),
+      .axi_req_t    ( axi_out_mux_req_t  ),
+      .axi_rsp_t    ( axi_out_mux_resp_t )
+    ) i_write_buffer (
+      .clk_i,
+      .rst_ni,
+      .obi_req_i   ( axi_output_obi_req                    ),
+      .obi_rsp_o   ( axi_output_obi_rsp                    ),
+      .obi_req_o   ( axi_out_obi_req                       ),
+      .obi_rsp_i   ( axi_out_obi_rsp                       ),
+      .axi_req_o   ( axi_out_mux_req[AxiOutIdxWriteBuffer] ),
+      .axi_rsp_i   ( axi_out_mux_rsp[AxiOutIdxWriteBuffer] ),
+      .err_valid_o ( posted_err_valid                      ),
+      .err_addr_o  ( posted_err_addr                       ),
+      .err_o       ( posted_err                            ),
+      .err_ready_i ( posted_err_ready )
+    );
+  end else begin : gen_no_write_buffer
+    assign axi_out_obi_req    = axi_output_obi_req;
+    assign axi_output_obi_rsp = axi_out_obi_rsp;
+    assign posted_err_valid   = 1'b0;
+    assign posted_err_addr    = '0;
+    assign posted_err         = '0;
+  end
+
+  if (NumAxiOutPorts > 1) begin : gen_axi_out_mux
+    axi_out_full_req_t  axi_out_req;
+    axi_out_full_resp_t axi_out_rsp;
+
+    axi_mux #(
+      .SlvAxiIDWidth ( AxiOutMuxIdWidth       ),
+      .slv_aw_chan_t ( axi_out_mux_aw_chan_t  ),
+      .mst_aw_chan_t ( axi_out_full_aw_chan_t ),
+      .w_chan_t      ( axi_out_mux_w_chan_t   ),
+      .slv_b_chan_t  ( axi_out_mux_b_chan_t   ),
+      .mst_b_chan_t  ( axi_out_full_b_chan_t  ),
+      .slv_ar_chan_t ( axi_out_mux_ar_chan_t  ),
+      .mst_ar_chan_t ( axi_out_full_ar_chan_t ),
+      .slv_r_chan_t  ( axi_out_mux_r_chan_t   ),
+      .mst_r_chan_t  ( axi_out_full_r_chan_t  ),
+      .slv_req_t     ( axi_out_mux_req_t      ),
+      .slv_resp_t    ( axi_out_mux_resp_t     ),
+      .mst_req_t     ( axi_out_full_req_t     ),
+      .mst_resp_t    ( axi_out_full_resp_t    ),
+      .NoSlvPorts    ( NumAxiOutPorts         ),
+      .MaxWTrans     ( axi_out_max_trans(SafetyIslandCfg) ),
+      .FallThrough   ( 1'b0                   ),
+      .SpillAw       ( 1'b0                   ),
+      .SpillW        ( 1'b0                   ),
+      .SpillB        ( 1'b0                   ),
+      .SpillAr       ( 1'b0                   ),
+      .SpillR        ( 1'b0                   )
+    ) i_axi_out_mux (
+      .clk_i,
+      .rst_ni,
+      .test_i      ( test_enable_i   ),
+      .slv_reqs_i  ( axi_out_mux_req ),
+      .slv_resps_o ( axi_out_mux_rsp ),
+      .mst_req_o   ( axi_out_req     ),
+      .mst_resp_i  ( axi_out_rsp     )
+    );
+
+    `AXI_ASSIGN_REQ_STRUCT(axi_output_req_o, axi_out_req)
+    `AXI_ASSIGN_RESP_STRUCT(axi_out_rsp, axi_output_resp_i)
+  end else begin : gen_no_axi_out_mux
+    `AXI_ASSIGN_REQ_STRUCT(axi_output_req_o, axi_out_mux_req[0])
+    `AXI_ASSIGN_RESP_STRUCT(axi_out_mux_rsp[0], axi_output_resp_i)
+  end
+
   logic [1:0]                                      axi_out_rsp_sel;
   logic [AxiUserWidth-1:0]                         axi_out_b_user,
                                                    axi_out_r_user;
@@ -1209,26 +2787,45 @@ module safety_island_top import safety_island_pkg::*; #(
     assign axi_out_obi_user = '0;
   end
 
+  assign perf_axi_out_req    = axi_out_obi_req.req;
+  assign perf_axi_out_gnt    = axi_out_obi_rsp.gnt;
+  assign perf_axi_out_we     = axi_out_obi_req.a.we;
+  assign perf_axi_out_rvalid = axi_out_obi_rsp.rvalid;
+
+  // The ATOP ID in the AXI user is DefaultUser's for hart 0 and offset by the OBI ID of the data
+  // manager for harts 1 and 2 in split mode, so each hart holds its own external reservations.
+  logic [AxiUserWidth-1:0] axi_out_user;
+
+  if (AxiUserAtop && SafetyIslandCfg.UseSplitMode) begin : gen_hart_atop_user
+    always_comb begin : proc_axi_out_user
+      axi_out_user = DefaultUser;
+      axi_out_user[AxiUserAtopMsb:AxiUserAtopLsb] =
+        DefaultUser[AxiUserAtopMsb:AxiUserAtopLsb] +
+        (AxiUserAtopMsb+1-AxiUserAtopLsb)'(axi_out_obi_req.a.aid[MgrObiCfg.IdWidth-1:0]);
+    end
+  end else begin : gen_default_user
+    assign axi_out_user = DefaultUser;
+  end
+
   obi_to_axi #(
     .ObiCfg       ( XbarSbrObiCfg      ),
     .obi_req_t    ( xbar_sbr_obi_req_t ),
     .obi_rsp_t    ( xbar_sbr_obi_rsp_t ),
-    .axi_req_t    ( axi_output_req_t   ),
-    .axi_rsp_t    ( axi_output_resp_t  ),
+    .axi_req_t    ( axi_out_mux_req_t  ),
+    .axi_rsp_t    ( axi_out_mux_resp_t ),
     .AxiAddrWidth ( AxiAddrWidth       ),
     .AxiDataWidth ( AxiDataWidth       ),
     .AxiUserWidth ( AxiUserWidth       ),
-    .MaxRequests  ( 2                  ),
+    .MaxRequests  ( SafetyIslandCfg.AxiOutMaxTrans ),
     .AxiLite      ( 1'b0               )
   ) i_obi_to_axi (
     .clk_i,
     .rst_ni,
-    .obi_req_i ( axi_output_obi_req ),
-    .obi_rsp_o ( axi_output_obi_rsp ),
-    .user_i    ( DefaultUser        ),// Only one ATOP-capable master (cv32e40p data port),
-                                      // so we have only one user config even when using user as ATOP ID.
-    .axi_req_o ( axi_output_req_o   ),
-    .axi_rsp_i ( axi_output_resp_i  ),
+    .obi_req_i ( axi_out_obi_req    ),
+    .obi_rsp_o ( axi_out_obi_rsp    ),
+    .user_i    ( axi_out_user       ),
+    .axi_req_o ( xbar_axi_out_req   ),
+    .axi_rsp_i ( xbar_axi_out_rsp   ),
 
     .axi_rsp_channel_sel ( axi_out_rsp_sel  ),
     .axi_rsp_b_user_o    ( axi_out_b_user   ),
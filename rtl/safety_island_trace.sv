@@ -0,0 +1,312 @@
+// Copyright 2024 ETH Zurich and University of Bologna.
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License.  You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+// Branch trace encoder of the (voted) core instruction fetches.
+//
+// Only discontinuities of the granted fetch addresses are traced, sequential fetches are counted.
+// Each packet is two words written to a circular buffer in memory through the write port:
+//   word 0  [1:0] type: 0 branch, 1 branch after an interrupt, 2 start, 3 stop
+//           [7:2] sequential fetches since the previous packet (saturating)
+//           [15:8] interrupt ID (type 1)
+//           [31:16] cycles since the previous packet (saturating)
+//   word 1  fetch address (type 3: the stop address or the last fetch address)
+// The decoder rebuilds the executed instructions from the program, as the fetches past a taken
+// branch or an interrupt were not executed. This is a trace of fetches, not of retired
+// instructions: prefetched instructions past a branch, trap or interrupt are counted as
+// sequential, hardware loop back-edges look like any other discontinuity, and the trapping or
+// interrupted instruction is not recorded.
+//
+// While the packet FIFO has less than two free entries, `stall_o` holds back new fetches of the
+// core, so no packet is lost: a fetch presented before the stall may still be granted and takes
+// the last entry.
+//
+// Register map (32-bit registers):
+//   0x000  CTRL        [0] enable, [1] wrap around at the end of the buffer instead of stopping,
+//                      writing [0] from 0 to 1 starts a new trace at the buffer start
+//   0x004  STATUS      [0] tracing, [1] wrapped, [2] stopped at the end of the buffer,
+//                      [3] packets dropped, [4] write error, writing 1 clears [3] and [4]
+//   0x008  BUF_BASE    start address of the buffer
+//   0x00C  BUF_SIZE    size of the buffer in bytes, a multiple of 8
+//   0x010  WRITE_PTR   offset of the next word in the buffer, the oldest packet after a wrap
+//   0x014  START_ADDR  fetch address starting the trace, 0 to start with the next fetch
+//   0x018  STOP_ADDR   fetch address stopping the trace, 0 to stop only on disable
+//   0x01C  DROPPED     dropped packets, saturating, cleared on write (stays 0 with `stall_o`)
+
+module safety_island_trace #(
+  parameter int unsigned FifoDepth  = 4,
+  parameter type         reg_req_t  = logic,
+  parameter type         reg_rsp_t  = logic
+) (
+  input  logic        clk_i,
+  input  logic        rst_ni,
+  input  logic        testmode_i,
+
+  input  reg_req_t    reg_req_i,
+  output reg_rsp_t    reg_rsp_o,
+
+  // Fetches and interrupt handshake of the core
+  input  logic        fetch_req_i,
+  input  logic        fetch_gnt_i,
+  input  logic [31:0] fetch_addr_i,
+  input  logic        irq_ack_i,
+  input  logic [7:0]  irq_id_i,
+  // Hold back new fetches
+  output logic        stall_o,
+
+  // Write port to the trace buffer
+  output logic        mem_req_o,
+  input  logic        mem_gnt_i,
+  output logic [31:0] mem_addr_o,
+  output logic [31:0] mem_wdata_o,
+  input  logic        mem_rvalid_i,
+  input  logic        mem_err_i
+);
+
+  if (FifoDepth < 2) begin : gen_fifo_depth_check
+    $fatal(1, "The trace needs a FifoDepth of at least 2 to stall the core, got %0d", FifoDepth);
+  end
+
+  typedef enum logic [1:0] {
+    PktBranch = 2'd0,
+    PktIrq    = 2'd1,
+    PktStart  = 2'd2,
+    PktStop   = 2'd3
+  } pkt_type_e;
+
+  typedef struct packed {
+    logic [15:0] cycles;
+    logic [7:0]  irq_id;
+    logic [5:0]  seq;
+    pkt_type_e   pkt_type;
+    logic [31:0] addr;
+  } packet_t;
+
+  logic        enable_q, wrap_q, active_q, done_q, full_q, wrapped_q, dropped_q, err_q;
+  logic [31:0] base_q, size_q, wptr_q, start_addr_q, stop_addr_q, drop_cnt_q;
+  logic [31:0] last_addr_q;
+  logic [5:0]  seq_q;
+  logic [15:0] cycles_q;
+  logic        irq_pending_q, half_q;
+  logic [7:0]  irq_id_q;
+
+  logic       reg_write;
+  logic [9:0] reg_word;
+  logic       ctrl_write, arm;
+
+  logic    fetch, seq_fetch, armed, start_hit, stop_hit, sw_stop;
+  logic    emit, push, pop, fifo_full, fifo_empty, wr_last;
+  logic [cf_math_pkg::idx_width(FifoDepth)-1:0] fifo_usage;
+  packet_t pkt, head;
+
+  assign reg_write  = reg_req_i.valid && reg_req_i.write;
+  assign reg_word   = reg_req_i.addr[11:2];
+  assign ctrl_write = reg_write && reg_word == 10'h0;
+  assign arm        = ctrl_write && reg_req_i.wdata[0] && !enable_q;
+
+  always_comb begin : proc_reg_read
+    reg_rsp_o.ready = 1'b1;
+    reg_rsp_o.error = 1'b0;
+    reg_rsp_o.rdata = '0;
+    unique case (reg_word)
+      10'h0:   reg_rsp_o.rdata = {30'b0, wrap_q, enable_q};
+      10'h1:   reg_rsp_o.rdata = {27'b0, err_q, dropped_q, full_q, wrapped_q, active_q};
+      10'h2:   reg_rsp_o.rdata = base_q;
+      10'h3:   reg_rsp_o.rdata = size_q;
+      10'h4:   reg_rsp_o.rdata = wptr_q;
+      10'h5:   reg_rsp_o.rdata = start_addr_q;
+      10'h6:   reg_rsp_o.rdata = stop_addr_q;
+      10'h7:   reg_rsp_o.rdata = drop_cnt_q;
+      default: reg_rsp_o.error = 1'b1;
+    endcase
+  end
+
+  // -----------------
+  // Encoder
+  // -----------------
+
+  assign fetch     = fetch_req_i && fetch_gnt_i;
+  assign seq_fetch = fetch && fetch_addr_i == last_addr_q + 32'd4;
+  assign armed     = enable_q && !active_q && !done_q && !full_q;
+  assign start_hit = armed && fetch && (start_addr_q == '0 || fetch_addr_i == start_addr_q);
+  assign stop_hit  = active_q && fetch && stop_addr_q != '0 && fetch_addr_i == stop_addr_q;
+  assign sw_stop   = active_q && !enable_q;
+
+  always_comb begin : proc_packet
+    emit         = 1'b0;
+    pkt          = '0;
+    pkt.cycles   = cycles_q;
+    pkt.seq      = seq_q;
+    pkt.irq_id   = irq_id_q;
+    pkt.addr     = fetch_addr_i;
+    pkt.pkt_type = irq_pending_q ? PktIrq : PktBranch;
+    if (start_hit) begin
+      emit         = 1'b1;
+      pkt.pkt_type = PktStart;
+      pkt.cycles   = '0;
+      pkt.seq      = '0;
+    end else if (stop_hit) begin
+      emit         = 1'b1;
+      pkt.pkt_type = PktStop;
+    end else if (sw_stop) begin
+      emit         = 1'b1;
+      pkt.pkt_type = PktStop;
+      pkt.addr     = last_addr_q;
+    end else if (active_q && fetch && !seq_fetch) begin
+      emit         = 1'b1;
+    end
+  end
+
+  assign push = emit && !fifo_full;
+
+  // The usage wraps to zero when the FIFO is full
+  assign stall_o = (active_q || armed) &&
+                   (fifo_full || fifo_usage == ($bits(fifo_usage))'(FifoDepth-1));
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_encoder
+    if (!rst_ni) begin
+      active_q      <= 1'b0;
+      done_q        <= 1'b0;
+      last_addr_q   <= '0;
+      seq_q         <= '0;
+      cycles_q      <= '0;
+      irq_pending_q <= 1'b0;
+      irq_id_q      <= '0;
+      dropped_q     <= 1'b0;
+      drop_cnt_q    <= '0;
+    end else begin
+      if (fetch) begin
+        last_addr_q <= fetch_addr_i;
+      end
+
+      if (emit) begin
+        seq_q         <= '0;
+        cycles_q      <= '0;
+        irq_pending_q <= 1'b0;
+      end else begin
+        if (seq_fetch && seq_q != '1) begin
+          seq_q <= seq_q + 1;
+        end
+        if (cycles_q != '1) begin
+          cycles_q <= cycles_q + 1;
+        end
+      end
+      if (irq_ack_i) begin
+        irq_pending_q <= 1'b1;
+        irq_id_q      <= irq_id_i;
+      end
+
+      if (start_hit) begin
+        active_q <= 1'b1;
+      end else if (stop_hit || sw_stop && !fifo_full || full_q) begin
+        // A stop by software waits for room for its packet
+        active_q <= 1'b0;
+      end
+      if (ctrl_write) begin
+        done_q <= 1'b0;
+      end else if (stop_hit) begin
+        done_q <= 1'b1;
+      end
+
+      if (reg_write && reg_word == 10'h1 && reg_req_i.wdata[3]) begin
+        dropped_q <= 1'b0;
+      end else if (emit && fifo_full) begin
+        dropped_q <= 1'b1;
+      end
+      if (reg_write && reg_word == 10'h7) begin
+        drop_cnt_q <= '0;
+      end else if (emit && fifo_full && drop_cnt_q != '1) begin
+        drop_cnt_q <= drop_cnt_q + 1;
+      end
+    end
+  end
+
+  fifo_v3 #(
+    .FALL_THROUGH ( 1'b0      ),
+    .dtype        ( packet_t  ),
+    .DEPTH        ( FifoDepth )
+  ) i_packet_fifo (
+    .clk_i,
+    .rst_ni,
+    .flush_i    ( 1'b0       ),
+    .testmode_i,
+    .full_o     ( fifo_full  ),
+    .empty_o    ( fifo_empty ),
+    .usage_o    ( fifo_usage ),
+    .data_i     ( pkt        ),
+    .push_i     ( push       ),
+    .data_o     ( head       ),
+    .pop_i      ( pop        )
+  );
+
+  // -----------------
+  // Buffer writes
+  // -----------------
+
+  // Without room in the buffer, packets are discarded
+  assign mem_req_o   = !fifo_empty && !full_q && size_q[31:3] != '0;
+  assign mem_addr_o  = base_q + wptr_q;
+  assign mem_wdata_o = half_q ? head.addr : {head.cycles, head.irq_id, head.seq, head.pkt_type};
+  assign wr_last     = wptr_q + 32'd4 >= {size_q[31:3], 3'b000};
+  assign pop         = !fifo_empty && (mem_req_o ? mem_gnt_i && half_q : 1'b1);
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_regs
+    if (!rst_ni) begin
+      enable_q     <= 1'b0;
+      wrap_q       <= 1'b0;
+      base_q       <= '0;
+      size_q       <= '0;
+      start_addr_q <= '0;
+      stop_addr_q  <= '0;
+      wptr_q       <= '0;
+      half_q       <= 1'b0;
+      wrapped_q    <= 1'b0;
+      full_q       <= 1'b0;
+      err_q        <= 1'b0;
+    end else begin
+      if (ctrl_write) begin
+        enable_q <= reg_req_i.wdata[0];
+        wrap_q   <= reg_req_i.wdata[1];
+      end
+      if (reg_write && reg_word == 10'h2) begin
+        base_q <= reg_req_i.wdata;
+      end
+      if (reg_write && reg_word == 10'h3) begin
+        size_q <= reg_req_i.wdata;
+      end
+      if (reg_write && reg_word == 10'h5) begin
+        start_addr_q <= reg_req_i.wdata;
+      end
+      if (reg_write && reg_word == 10'h6) begin
+        stop_addr_q <= reg_req_i.wdata;
+      end
+
+      if (arm) begin
+        wptr_q    <= '0;
+        half_q    <= 1'b0;
+        wrapped_q <= 1'b0;
+        full_q    <= 1'b0;
+      end else if (mem_req_o && mem_gnt_i) begin
+        half_q <= !half_q;
+        wptr_q <= wr_last ? '0 : wptr_q + 32'd4;
+        if (wr_last) begin
+          wrapped_q <= wrap_q;
+          full_q    <= !wrap_q;
+        end
+      end
+
+      if (reg_write && reg_word == 10'h1 && reg_req_i.wdata[4]) begin
+        err_q <= 1'b0;
+      end else if (mem_rvalid_i && mem_err_i) begin
+        err_q <= 1'b1;
+      end
+    end
+  end
+
+endmodule
@@ -0,0 +1,185 @@
+// Copyright 2024 ETH Zurich and University of Bologna.
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License.  You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+// Wide AXI input path into the memory banks.
+//
+// Plain (non-atomic, non-exclusive) AXI accesses to the island memory are split into their 32-bit
+// lanes, and each lane accesses the matching sub-bank of the addressed `safety_island_wide_bank`
+// directly, bypassing the crossbar. All lanes of a beat are thus served in the same cycle.
+// Atomics and exclusive accesses have to be routed through the narrow path. The response user
+// bits carry the ATOP ID and the ECC error like on the narrow path.
+
+module safety_island_wide_axi_in #(
+  parameter int unsigned NumBanks         = 2,
+  parameter bit [31:0]   BankNumBytes     = 32'h0001_0000,
+  parameter bit [31:0]   MemBaseAddr      = '0,
+  parameter int unsigned AxiAddrWidth     = 48,
+  parameter int unsigned AxiDataWidth     = 64,
+  parameter int unsigned AxiIdWidth       = 1,
+  parameter int unsigned AxiUserWidth     = 1,
+  parameter int unsigned MaxTrans         = 2,
+  parameter bit          AxiUserAtop      = 1'b0,
+  parameter int unsigned AxiUserAtopMsb   = 0,
+  parameter int unsigned AxiUserAtopLsb   = 0,
+  parameter bit          AxiUserEccErr    = 1'b0,
+  parameter int unsigned AxiUserEccErrBit = 0,
+  parameter type         axi_req_t        = logic,
+  parameter type         axi_rsp_t        = logic,
+  // Dependent parameters, do not override
+  parameter int unsigned NumLanes         = AxiDataWidth/32
+) (
+  input  logic                                              clk_i,
+  input  logic                                              rst_ni,
+
+  input  axi_req_t                                          axi_req_i,
+  output axi_rsp_t                                          axi_rsp_o,
+
+  // Lane ports of all banks
+  output logic [NumBanks-1:0][NumLanes-1:0]                 bank_req_o,
+  output logic [NumBanks-1:0][NumLanes-1:0]                 bank_we_o,
+  output logic [NumBanks-1:0][NumLanes-1:0][31:0]           bank_addr_o,
+  output logic [NumBanks-1:0][NumLanes-1:0][31:0]           bank_wdata_o,
+  output logic [NumBanks-1:0][NumLanes-1:0][3:0]            bank_be_o,
+  input  logic [NumBanks-1:0][NumLanes-1:0]                 bank_gnt_i,
+  input  logic [NumBanks-1:0][NumLanes-1:0]                 bank_rvalid_i,
+  input  logic [NumBanks-1:0][NumLanes-1:0][31:0]           bank_rdata_i,
+  input  logic [NumBanks-1:0][NumLanes-1:0]                 bank_multi_err_i
+);
+
+  localparam int unsigned BankIdxWidth = NumBanks > 1 ? $clog2(NumBanks) : 1;
+
+  logic [NumLanes-1:0]                    lane_req, lane_gnt, lane_we, lane_rvalid;
+  logic [NumLanes-1:0][AxiAddrWidth-1:0]  lane_addr;
+  logic [NumLanes-1:0][31:0]              lane_wdata, lane_rdata;
+  logic [NumLanes-1:0][3:0]               lane_be;
+  logic [NumLanes-1:0]                    lane_multi_err;
+
+  logic [AxiUserWidth-1:0] req_user, rsp_user;
+  logic [NumLanes-1:0]     req_bank_strb, req_size_enable, rsp_ecc_err;
+  logic                    req_write, req_last, rsp_hs;
+
+  axi_to_detailed_mem_user #(
+    .axi_req_t      ( axi_req_t    ),
+    .axi_resp_t     ( axi_rsp_t    ),
+    .AddrWidth      ( AxiAddrWidth ),
+    .DataWidth      ( AxiDataWidth ),
+    .IdWidth        ( AxiIdWidth   ),
+    .UserWidth      ( AxiUserWidth ),
+    .NumBanks       ( NumLanes     ),
+    .BufDepth       ( MaxTrans     ),
+    .HideStrb       ( 1'b1         ),
+    .OutFifoDepth   ( 2            ),
+    .PropagateWUser ( 1'b0         ),
+    .RUserExtra     ( 1            )
+  ) i_axi_to_mem (
+    .clk_i,
+    .rst_ni,
+
+    .busy_o       (),
+
+    .axi_req_i    ( axi_req_i      ),
+    .axi_resp_o   ( axi_rsp_o      ),
+
+    .mem_req_o    ( lane_req       ),
+    .mem_gnt_i    ( lane_gnt       ),
+    .mem_addr_o   ( lane_addr      ),
+    .mem_wdata_o  ( lane_wdata     ),
+    .mem_strb_o   ( lane_be        ),
+    .mem_atop_o   (),
+    .mem_lock_o   (),
+    .mem_we_o     ( lane_we        ),
+    .mem_id_o     (),
+    .mem_user_o   (),
+    .mem_cache_o  (),
+    .mem_prot_o   (),
+    .mem_qos_o    (),
+    .mem_region_o (),
+    .mem_rvalid_i ( lane_rvalid    ),
+    .mem_rdata_i  ( lane_rdata     ),
+    .mem_err_i    ( '0             ),
+    .mem_exokay_i ( '0             ),
+    .mem_ruser_i  ( lane_multi_err ),
+
+    .ruser_req_user_o        ( req_user        ),
+    .ruser_req_bank_strb_o   ( req_bank_strb   ),
+    .ruser_req_size_enable_o ( req_size_enable ),
+    .ruser_rsp_extra_o       ( rsp_ecc_err     ),
+    .ruser_req_write_o       ( req_write       ),
+    .ruser_req_last_o        ( req_last        ),
+    .ruser_rsp_hs_o          ( rsp_hs          ),
+    .ruser_i                 ( rsp_user        )
+  );
+
+  // -----------------
+  // Lanes to banks
+  // -----------------
+
+  for (genvar l = 0; l < NumLanes; l++) begin : gen_lane
+    logic [BankIdxWidth-1:0] bank_idx;
+    logic [31:0]             mem_addr;
+
+    assign mem_addr = lane_addr[l][31:0] - MemBaseAddr;
+    assign bank_idx = NumBanks > 1 ? BankIdxWidth'(mem_addr >> $clog2(BankNumBytes)) : '0;
+
+    for (genvar b = 0; b < NumBanks; b++) begin : gen_bank
+      assign bank_req_o  [b][l] = lane_req[l] && bank_idx == b;
+      assign bank_we_o   [b][l] = lane_we[l];
+      assign bank_addr_o [b][l] = mem_addr;
+      assign bank_wdata_o[b][l] = lane_wdata[l];
+      assign bank_be_o   [b][l] = lane_be[l];
+    end
+
+    // Banks respond one cycle after the grant, so responses stay in order.
+    always_comb begin : proc_lane_rsp
+      lane_gnt      [l] = bank_gnt_i[bank_idx][l];
+      lane_rvalid   [l] = 1'b0;
+      lane_rdata    [l] = '0;
+      lane_multi_err[l] = 1'b0;
+      for (int unsigned b = 0; b < NumBanks; b++) begin
+        if (bank_rvalid_i[b][l]) begin
+          lane_rvalid   [l] = 1'b1;
+          lane_rdata    [l] = bank_rdata_i[b][l];
+          lane_multi_err[l] = bank_multi_err_i[b][l];
+        end
+      end
+    end
+  end
+
+  // -----------------
+  // Response user
+  // -----------------
+
+  logic b_ecc_err_d, b_ecc_err_q, b_ecc_err_incr;
+
+  assign b_ecc_err_incr = b_ecc_err_q | (rsp_hs & req_write & |(rsp_ecc_err & req_bank_strb));
+  assign b_ecc_err_d    = rsp_hs && req_write && req_last ? 1'b0 : b_ecc_err_incr;
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_b_ecc_err
+    if (!rst_ni) begin
+      b_ecc_err_q <= 1'b0;
+    end else begin
+      b_ecc_err_q <= b_ecc_err_d;
+    end
+  end
+
+  always_comb begin : proc_rsp_user
+    rsp_user = '0;
+    // Respond with the same ATOP ID
+    if (AxiUserAtop) begin
+      rsp_user[AxiUserAtopMsb:AxiUserAtopLsb] = req_user[AxiUserAtopMsb:AxiUserAtopLsb];
+    end
+    // Attach ECC error
+    if (AxiUserEccErr) begin
+      rsp_user[AxiUserEccErrBit] = req_write ? b_ecc_err_incr :
+                                               |(rsp_ecc_err & req_size_enable);
+    end
+  end
+
+endmodule
@@ -0,0 +1,149 @@
+// Copyright 2024 ETH Zurich and University of Bologna.
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License.  You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+// Memory bank for the wide AXI input path.
+//
+// The bank is split into `NumLanes` word-interleaved ECC sub-banks, so that the 32-bit lanes of a
+// wide AXI beat access their sub-banks in parallel. The narrow port from the crossbar accesses one
+// sub-bank per request and alternates priority with the lane port on conflicts. Both ports expect
+// the read data one cycle after the grant. ECC faults of the sub-banks are combined towards the
+// ECC manager, which keeps counting per bank.
+
+module safety_island_wide_bank #(
+  /// Number of 32-bit words in the bank
+  parameter int unsigned NumWords  = 1024,
+  /// Number of 32-bit lanes (sub-banks)
+  parameter int unsigned NumLanes  = 2,
+  parameter int unsigned AddrWidth = 32
+) (
+  input  logic                                clk_i,
+  input  logic                                rst_ni,
+  input  logic                                test_enable_i,
+
+  // Narrow port (from the crossbar)
+  input  logic                                req_i,
+  input  logic                                we_i,
+  input  logic [AddrWidth-1:0]                addr_i,
+  input  logic [31:0]                         wdata_i,
+  input  logic [3:0]                          be_i,
+  output logic                                gnt_o,
+  output logic [31:0]                         rdata_o,
+  output logic                                multi_err_o,
+
+  // Lane ports (from the wide AXI input), lane i only accesses sub-bank i
+  input  logic [NumLanes-1:0]                 lane_req_i,
+  input  logic [NumLanes-1:0]                 lane_we_i,
+  input  logic [NumLanes-1:0][AddrWidth-1:0]  lane_addr_i,
+  input  logic [NumLanes-1:0][31:0]           lane_wdata_i,
+  input  logic [NumLanes-1:0][3:0]            lane_be_i,
+  output logic [NumLanes-1:0]                 lane_gnt_o,
+  output logic [NumLanes-1:0]                 lane_rvalid_o,
+  output logic [NumLanes-1:0][31:0]           lane_rdata_o,
+  output logic [NumLanes-1:0]                 lane_multi_err_o,
+
+  // ECC
+  input  logic                                scrub_trigger_i,
+  output logic                                scrub_fix_o,
+  output logic                                scrub_uncorrectable_o,
+  output logic                                single_err_o
+);
+
+  localparam int unsigned LaneBits = NumLanes > 1 ? $clog2(NumLanes) : 1;
+
+  logic [LaneBits-1:0] narrow_lane, narrow_lane_q;
+  logic [NumLanes-1:0] narrow_gnt;
+  logic [NumLanes-1:0] sub_scrub_fix, sub_scrub_uncorrectable, sub_single_err, sub_multi_err;
+  logic [NumLanes-1:0][31:0] sub_rdata;
+
+  assign narrow_lane = NumLanes > 1 ? addr_i[2 +: LaneBits] : '0;
+
+  // Word index within the sub-bank
+  function automatic logic [AddrWidth-1:0] sub_addr(logic [AddrWidth-1:0] addr);
+    return (addr >> (2 + $clog2(NumLanes))) << 2;
+  endfunction
+
+  for (genvar i = 0; i < NumLanes; i++) begin : gen_sub_bank
+    logic narrow_req, lane_wins, prio_lane_q;
+    logic sub_req, sub_we, sub_gnt;
+    logic [AddrWidth-1:0] sub_bank_addr;
+    logic [31:0] sub_wdata;
+    logic [3:0]  sub_be;
+
+    assign narrow_req = req_i && narrow_lane == i;
+    assign lane_wins  = lane_req_i[i] && (!narrow_req || prio_lane_q);
+
+    assign sub_req       = narrow_req || lane_req_i[i];
+    assign sub_we        = lane_wins ? lane_we_i[i]             : we_i;
+    assign sub_bank_addr = lane_wins ? sub_addr(lane_addr_i[i]) : sub_addr(addr_i);
+    assign sub_wdata     = lane_wins ? lane_wdata_i[i]          : wdata_i;
+    assign sub_be        = lane_wins ? lane_be_i[i]             : be_i;
+
+    assign lane_gnt_o[i] = lane_wins && sub_gnt;
+    assign narrow_gnt[i] = narrow_req && !lane_wins && sub_gnt;
+
+    // Alternate priority on conflicts
+    always_ff @(posedge clk_i or negedge rst_ni) begin : proc_prio
+      if (!rst_ni) begin
+        prio_lane_q      <= 1'b0;
+        lane_rvalid_o[i] <= 1'b0;
+      end else begin
+        if (narrow_req && lane_req_i[i] && sub_gnt) begin
+          prio_lane_q <= !lane_wins;
+        end
+        lane_rvalid_o[i] <= lane_gnt_o[i];
+      end
+    end
+
+    ecc_sram_wrap #(
+      .BankSize        (NumWords/NumLanes),
+      .InputECC        (0),
+      .EnableTestMask  (0)
+    ) i_sub_bank (
+      .clk_i,
+      .rst_ni,
+      .test_enable_i         ( test_enable_i ),
+
+      .scrub_trigger_i       ( scrub_trigger_i            ),
+      .scrubber_fix_o        ( sub_scrub_fix          [i] ),
+      .scrub_uncorrectable_o ( sub_scrub_uncorrectable[i] ),
+
+      .tcdm_wdata_i          ( sub_wdata     ),
+      .tcdm_add_i            ( sub_bank_addr ),
+      .tcdm_req_i            ( sub_req       ),
+      .tcdm_wen_i            ( ~sub_we       ),
+      .tcdm_be_i             ( sub_be        ),
+      .tcdm_rdata_o          ( sub_rdata[i]  ),
+      .tcdm_gnt_o            ( sub_gnt       ),
+      .single_error_o        ( sub_single_err[i] ),
+      .multi_error_o         ( sub_multi_err [i] ),
+
+      .test_write_mask_ni    ( '0 )
+    );
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_narrow_lane
+    if (!rst_ni) begin
+      narrow_lane_q <= '0;
+    end else if (|narrow_gnt) begin
+      narrow_lane_q <= narrow_lane;
+    end
+  end
+
+  assign gnt_o            = |narrow_gnt;
+  assign rdata_o          = sub_rdata[narrow_lane_q];
+  assign multi_err_o      = sub_multi_err[narrow_lane_q];
+  assign lane_rdata_o     = sub_rdata;
+  assign lane_multi_err_o = sub_multi_err;
+
+  assign scrub_fix_o           = |sub_scrub_fix;
+  assign scrub_uncorrectable_o = |sub_scrub_uncorrectable;
+  assign single_err_o          = |sub_single_err;
+
+endmodule
@@ -0,0 +1,348 @@
+// Copyright 2024 ETH Zurich and University of Bologna.
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License.  You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+// Posted-write buffer for the AXI output.
+//
+// Plain writes are acknowledged as soon as they are buffered. Sequential word writes are merged
+// into one entry, each entry is sent as a single AXI burst of 32-bit beats. An entry is closed
+// when it is full, a non-sequential write arrives, a read or atomic hits it, or it was not
+// extended for `MergeTimeout` cycles.
+//
+// Reads and atomics are passed through to the OBI output. Reads overlapping a buffered or
+// in-flight write wait until its B response returned, atomics wait until the buffer is empty.
+// Error responses of posted writes cannot be returned to the issuer anymore, they are reported
+// with the burst address on `err_*_o` instead, `err_o` holding the ECC error flagged in the B user
+// and the bus error like the OBI {ruser, err}. B responses are not accepted while the error queue
+// is full, so no error is lost. The top reports them through the bus error unit of the core data
+// port, whichever manager issued the write, as the buffer does not keep the issuer.
+
+module safety_island_write_buffer #(
+  /// Number of buffered bursts
+  parameter int unsigned           NumEntries   = 4,
+  /// Maximum number of 32-bit words per burst
+  parameter int unsigned           BurstWords   = 8,
+  /// Idle cycles until an entry is closed for merging
+  parameter int unsigned           MergeTimeout = 8,
+  parameter int unsigned           AxiAddrWidth = 32,
+  parameter int unsigned           AxiDataWidth = 64,
+  parameter int unsigned           AxiUserWidth = 1,
+  parameter bit [AxiUserWidth-1:0] AxiUser      = '0,
+  /// Bit of the AXI B user signalling an ECC error
+  parameter bit                    AxiUserEccErr    = 1'b0,
+  parameter int unsigned           AxiUserEccErrBit = 0,
+  parameter type                   obi_req_t    = logic,
+  parameter type                   obi_rsp_t    = logic,
+  parameter type                   axi_req_t    = logic,
+  parameter type                   axi_rsp_t    = logic
+) (
+  input  logic        clk_i,
+  input  logic        rst_ni,
+
+  // Crossbar side
+  input  obi_req_t    obi_req_i,
+  output obi_rsp_t    obi_rsp_o,
+
+  // Reads and atomics towards obi_to_axi
+  output obi_req_t    obi_req_o,
+  input  obi_rsp_t    obi_rsp_i,
+
+  // Buffered write bursts
+  output axi_req_t    axi_req_o,
+  input  axi_rsp_t    axi_rsp_i,
+
+  // Posted write errors
+  output logic        err_valid_o,
+  output logic [31:0] err_addr_o,
+  output logic [1:0]  err_o,
+  input  logic        err_ready_i
+);
+
+  localparam int unsigned EntryIdxWidth = NumEntries > 1 ? $clog2(NumEntries) : 1;
+  localparam int unsigned LenWidth      = $clog2(BurstWords+1);
+  localparam int unsigned BeatIdxWidth  = BurstWords > 1 ? $clog2(BurstWords) : 1;
+  localparam int unsigned TimeoutWidth  = $clog2(MergeTimeout+1);
+  localparam int unsigned AxiStrbWidth  = AxiDataWidth/8;
+  localparam int unsigned LaneIdxWidth  = AxiDataWidth > 32 ? $clog2(AxiDataWidth/32) : 1;
+
+  typedef logic [EntryIdxWidth-1:0] entry_idx_t;
+  typedef logic [29:0]              word_addr_t;
+
+  function automatic entry_idx_t next_idx(entry_idx_t idx);
+    return (32'(idx) == NumEntries-1) ? '0 : idx + 1;
+  endfunction
+
+  // -----------------
+  // Entries
+  // -----------------
+
+  logic       [NumEntries-1:0]                ent_valid_q, ent_sent_q;
+  word_addr_t [NumEntries-1:0]                ent_addr_q;
+  logic       [NumEntries-1:0][LenWidth-1:0]  ent_len_q;
+  logic       [NumEntries-1:0][BurstWords-1:0][31:0] ent_data_q;
+  logic       [NumEntries-1:0][BurstWords-1:0][3:0]  ent_strb_q;
+
+  entry_idx_t alloc_ptr_q, drain_ptr_q, free_ptr_q;
+  logic       open_q;
+  entry_idx_t open_idx_q;
+  logic [TimeoutWidth-1:0] idle_cnt_q;
+  logic       err_full, err_empty;
+  logic [1:0] b_err;
+
+  // -----------------
+  // Request routing
+  // -----------------
+
+  word_addr_t req_addr;
+  logic       req_atop, req_posted;
+  logic       can_merge, can_alloc, hazard, hazard_open;
+  logic       posted_gnt, pass_gnt, pass_rsp;
+  logic [7:0] pass_outstanding_q;
+  logic       posted_rsp_q;
+  logic [$bits(obi_rsp_i.r.rid)-1:0] posted_rid_q;
+
+  assign req_addr   = obi_req_i.a.addr[31:2];
+  assign req_atop   = obi_req_i.a.a_optional.atop != '0;
+  assign req_posted = obi_req_i.a.we && !req_atop;
+
+  assign can_merge = open_q && req_addr == ent_addr_q[open_idx_q] + word_addr_t'(ent_len_q[open_idx_q]) &&
+                     32'(ent_len_q[open_idx_q]) < BurstWords && req_addr[9:0] != '0;
+  assign can_alloc = !ent_valid_q[alloc_ptr_q];
+
+  // Reads must not overtake buffered writes to the same word, atomics must not overtake any
+  always_comb begin : proc_hazard
+    hazard      = 1'b0;
+    hazard_open = 1'b0;
+    for (int unsigned i = 0; i < NumEntries; i++) begin
+      if (ent_valid_q[i] && (req_atop || (req_addr >= ent_addr_q[i] &&
+                                          req_addr <  ent_addr_q[i] + word_addr_t'(ent_len_q[i])))) begin
+        hazard = 1'b1;
+        if (open_q && entry_idx_t'(i) == open_idx_q) hazard_open = 1'b1;
+      end
+    end
+  end
+
+  // Responses are kept in order by only accepting posted writes without reads in flight
+  assign posted_gnt = obi_req_i.req && req_posted && pass_outstanding_q == '0 &&
+                      (can_merge || can_alloc);
+
+  always_comb begin : proc_pass_req
+    obi_req_o     = obi_req_i;
+    obi_req_o.req = obi_req_i.req && !req_posted && !hazard;
+  end
+
+  assign pass_gnt = obi_req_o.req && obi_rsp_i.gnt;
+  assign pass_rsp = obi_rsp_i.rvalid;
+
+  always_comb begin : proc_rsp
+    obi_rsp_o     = obi_rsp_i;
+    obi_rsp_o.gnt = posted_gnt || pass_gnt;
+    if (posted_rsp_q) begin
+      obi_rsp_o.rvalid = 1'b1;
+      obi_rsp_o.r      = '0;
+      obi_rsp_o.r.rid  = posted_rid_q;
+    end
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_rsp_state
+    if (!rst_ni) begin
+      pass_outstanding_q <= '0;
+      posted_rsp_q       <= 1'b0;
+      posted_rid_q       <= '0;
+    end else begin
+      pass_outstanding_q <= pass_outstanding_q + pass_gnt - pass_rsp;
+      posted_rsp_q       <= posted_gnt;
+      if (posted_gnt) begin
+        posted_rid_q <= obi_req_i.a.aid;
+      end
+    end
+  end
+
+  // -----------------
+  // Drain
+  // -----------------
+
+  typedef enum logic [1:0] {
+    DrainIdle,
+    DrainAw,
+    DrainW
+  } drain_state_e;
+
+  drain_state_e drain_state_q, drain_state_d;
+  logic [BeatIdxWidth-1:0] beat_q, beat_d;
+  logic drain_ready, drain_done, close_open;
+  logic [31:0] beat_addr;
+  logic [LaneIdxWidth-1:0] beat_lane;
+
+  // Entries are sent in allocation order once closed
+  assign drain_ready = ent_valid_q[drain_ptr_q] && !ent_sent_q[drain_ptr_q] &&
+                       !(open_q && open_idx_q == drain_ptr_q);
+
+  assign beat_addr = {ent_addr_q[drain_ptr_q] + word_addr_t'(beat_q), 2'b00};
+  assign beat_lane = AxiDataWidth > 32 ? beat_addr[2+:LaneIdxWidth] : '0;
+
+  always_comb begin : proc_drain
+    drain_state_d = drain_state_q;
+    beat_d        = beat_q;
+    drain_done    = 1'b0;
+
+    axi_req_o           = '0;
+    axi_req_o.aw.addr   = AxiAddrWidth'({ent_addr_q[drain_ptr_q], 2'b00});
+    axi_req_o.aw.len    = axi_pkg::len_t'(ent_len_q[drain_ptr_q] - 1);
+    axi_req_o.aw.size   = axi_pkg::size_t'(2);
+    axi_req_o.aw.burst  = axi_pkg::BURST_INCR;
+    axi_req_o.aw.cache  = axi_pkg::CACHE_BUFFERABLE;
+    axi_req_o.aw.user   = AxiUser;
+    axi_req_o.w.data    = {(AxiDataWidth/32){ent_data_q[drain_ptr_q][beat_q]}};
+    axi_req_o.w.strb    = AxiStrbWidth'(ent_strb_q[drain_ptr_q][beat_q]) << (4*beat_lane);
+    axi_req_o.w.last    = 32'(beat_q) == 32'(ent_len_q[drain_ptr_q]) - 1;
+    axi_req_o.w.user    = AxiUser;
+    // Back-pressure B while errors cannot be queued
+    axi_req_o.b_ready   = !err_full;
+
+    case (drain_state_q)
+      DrainIdle: begin
+        beat_d = '0;
+        if (drain_ready) drain_state_d = DrainAw;
+      end
+      DrainAw: begin
+        axi_req_o.aw_valid = 1'b1;
+        if (axi_rsp_i.aw_ready) drain_state_d = DrainW;
+      end
+      DrainW: begin
+        axi_req_o.w_valid = 1'b1;
+        if (axi_rsp_i.w_ready) begin
+          beat_d = beat_q + 1;
+          if (axi_req_o.w.last) begin
+            drain_done    = 1'b1;
+            drain_state_d = DrainIdle;
+          end
+        end
+      end
+      default: drain_state_d = DrainIdle;
+    endcase
+  end
+
+  // -----------------
+  // Entry state
+  // -----------------
+
+  logic b_done;
+  assign b_done = axi_rsp_i.b_valid && !err_full;
+
+  // Close the open entry when it cannot grow anymore or a read or atomic is waiting for it
+  assign close_open = open_q &&
+                      ((32'(ent_len_q[open_idx_q]) == BurstWords) ||
+                       (32'(idle_cnt_q) >= MergeTimeout) ||
+                       (obi_req_i.req && !req_posted && hazard_open) ||
+                       (obi_req_i.req && req_posted && !can_merge));
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_entries
+    if (!rst_ni) begin
+      ent_valid_q   <= '0;
+      ent_sent_q    <= '0;
+      ent_addr_q    <= '0;
+      ent_len_q     <= '0;
+      ent_data_q    <= '0;
+      ent_strb_q    <= '0;
+      alloc_ptr_q   <= '0;
+      drain_ptr_q   <= '0;
+      free_ptr_q    <= '0;
+      open_q        <= 1'b0;
+      open_idx_q    <= '0;
+      idle_cnt_q    <= '0;
+      drain_state_q <= DrainIdle;
+      beat_q        <= '0;
+    end else begin
+      drain_state_q <= drain_state_d;
+      beat_q        <= beat_d;
+
+      if (open_q && !(posted_gnt && can_merge) && 32'(idle_cnt_q) < MergeTimeout) begin
+        idle_cnt_q <= idle_cnt_q + 1;
+      end
+
+      if (close_open) begin
+        open_q <= 1'b0;
+      end
+
+      if (posted_gnt) begin
+        idle_cnt_q <= '0;
+        if (can_merge) begin
+          ent_data_q[open_idx_q][ent_len_q[open_idx_q]] <= obi_req_i.a.wdata;
+          ent_strb_q[open_idx_q][ent_len_q[open_idx_q]] <= obi_req_i.a.be;
+          ent_len_q [open_idx_q] <= ent_len_q[open_idx_q] + 1;
+        end else begin
+          ent_valid_q[alloc_ptr_q]   <= 1'b1;
+          ent_sent_q [alloc_ptr_q]   <= 1'b0;
+          ent_addr_q [alloc_ptr_q]   <= req_addr;
+          ent_len_q  [alloc_ptr_q]   <= LenWidth'(1);
+          ent_data_q [alloc_ptr_q][0] <= obi_req_i.a.wdata;
+          ent_strb_q [alloc_ptr_q][0] <= obi_req_i.a.be;
+          alloc_ptr_q <= next_idx(alloc_ptr_q);
+          open_q      <= 1'b1;
+          open_idx_q  <= alloc_ptr_q;
+        end
+      end
+
+      if (drain_done) begin
+        ent_sent_q[drain_ptr_q] <= 1'b1;
+        drain_ptr_q <= next_idx(drain_ptr_q);
+      end
+
+      // Single AXI ID, B responses return in order
+      if (b_done) begin
+        ent_valid_q[free_ptr_q] <= 1'b0;
+        free_ptr_q <= next_idx(free_ptr_q);
+      end
+    end
+  end
+
+  // -----------------
+  // Error reporting
+  // -----------------
+
+  assign b_err = {AxiUserEccErr && axi_rsp_i.b.user[AxiUserEccErrBit],
+                  axi_rsp_i.b.resp inside {axi_pkg::RESP_SLVERR, axi_pkg::RESP_DECERR}};
+
+  fifo_v3 #(
+    .FALL_THROUGH ( 1'b0   ),
+    .DATA_WIDTH   ( 34     ),
+    .DEPTH        ( 2      )
+  ) i_err_fifo (
+    .clk_i,
+    .rst_ni,
+    .flush_i    ( 1'b0 ),
+    .testmode_i ( 1'b0 ),
+    .full_o     ( err_full    ),
+    .empty_o    ( err_empty   ),
+    .usage_o    (),
+    .data_i     ( {b_err, ent_addr_q[free_ptr_q], 2'b00} ),
+    .push_i     ( b_done && b_err != '0 ),
+    .data_o     ( {err_o, err_addr_o} ),
+    .pop_i      ( err_valid_o && err_ready_i )
+  );
+
+  assign err_valid_o = !err_empty;
+
+  // pragma translate_off
+  `ifndef VERILATOR
+  initial begin : proc_assert_params
+    assert (BurstWords >= 1 && BurstWords <= 256) else
+      $fatal(1, "BurstWords must be between 1 and 256!");
+    assert (AxiDataWidth >= 32) else
+      $fatal(1, "The AXI data width must be at least 32 bit!");
+  end
+
+  assert property (@(posedge clk_i) disable iff (!rst_ni)
+                   !(posted_gnt && !can_merge && ent_valid_q[alloc_ptr_q])) else
+    $error("Write buffer entry allocated twice!");
+  `endif
+  // pragma translate_on
+
+endmodule
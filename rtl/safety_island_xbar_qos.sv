@@ -0,0 +1,165 @@
+// Copyright 2024 ETH Zurich and University of Bologna.
+// Copyright and related rights are licensed under the Solderpad Hardware
+// License, Version 0.51 (the "License"); you may not use this file except in
+// compliance with the License.  You may obtain a copy of the License at
+// http://solderpad.org/licenses/SHL-0.51. Unless required by applicable law
+// or agreed to in writing, software, hardware and materials distributed under
+// this License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+// CONDITIONS OF ANY KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations under the License.
+
+// Priority and bandwidth-budget arbitration in front of the main crossbar.
+//
+// While enabled, a manager's request is held back from the crossbar while another manager requests
+// the same subordinate with a higher rank. The rank of a manager is its priority, and a manager
+// within its budget ranks above all managers that have used up their budget in the current window.
+// Managers of equal rank keep the round-robin arbitration of the crossbar. A request that reached
+// the crossbar is not held back until it is granted.
+//
+// Register map (32-bit registers):
+//   0x000      CTRL           [0] enable
+//   0x004      WINDOW         [15:0] cycles per budget window
+//   0x040+4*m  MGR_CFG[m]     [1:0] priority (3 is highest), [31:16] grants per window (0: no limit)
+//   0x080+4*m  MGR_THROTTLED[m] cycles manager m was held back
+//   0x0C0+4*m  MGR_MAX_WAIT[m]  longest cycles from a request of manager m to its grant
+// The counters saturate and are cleared on write. MGR_MAX_WAIT also counts while disabled.
+
+module safety_island_xbar_qos #(
+  parameter int unsigned NumManagers     = 6,
+  parameter int unsigned NumSubordinates = 4,
+  parameter int unsigned SbrIdxWidth     = cf_math_pkg::idx_width(NumSubordinates),
+  parameter type         reg_req_t       = logic,
+  parameter type         reg_rsp_t       = logic
+) (
+  input  logic                                   clk_i,
+  input  logic                                   rst_ni,
+
+  input  reg_req_t                               reg_req_i,
+  output reg_rsp_t                               reg_rsp_o,
+
+  input  logic [NumManagers-1:0]                 req_i,
+  input  logic [NumManagers-1:0][SbrIdxWidth-1:0] sbr_idx_i,
+  output logic [NumManagers-1:0]                 req_o,
+  input  logic [NumManagers-1:0]                 gnt_i
+);
+
+  logic        enable_q;
+  logic [15:0] window_q, window_cnt_q;
+  logic [1:0]  prio_q      [NumManagers];
+  logic [15:0] budget_q    [NumManagers];
+  logic [15:0] used_q      [NumManagers];
+  logic [31:0] throttled_q [NumManagers];
+  logic [31:0] wait_q      [NumManagers];
+  logic [31:0] max_wait_q  [NumManagers];
+  logic [NumManagers-1:0] presented_q;
+
+  logic       reg_write;
+  logic [9:0] reg_word;
+  logic       mgr_valid;
+  logic [3:0] mgr_idx;
+
+  assign reg_write = reg_req_i.valid && reg_req_i.write;
+  assign reg_word  = reg_req_i.addr[11:2];
+  assign mgr_idx   = reg_word[3:0];
+  assign mgr_valid = reg_word[9:6] == '0 && reg_word[5:4] != '0 && mgr_idx < NumManagers;
+
+  always_comb begin : proc_reg_read
+    reg_rsp_o.ready = 1'b1;
+    reg_rsp_o.error = 1'b0;
+    reg_rsp_o.rdata = '0;
+    if (reg_word == 10'h0) begin
+      reg_rsp_o.rdata = {31'b0, enable_q};
+    end else if (reg_word == 10'h1) begin
+      reg_rsp_o.rdata = {16'b0, window_q};
+    end else if (mgr_valid) begin
+      unique case (reg_word[5:4])
+        2'h1:    reg_rsp_o.rdata = {budget_q[mgr_idx], 14'b0, prio_q[mgr_idx]};
+        2'h2:    reg_rsp_o.rdata = throttled_q[mgr_idx];
+        default: reg_rsp_o.rdata = max_wait_q[mgr_idx];
+      endcase
+    end else begin
+      reg_rsp_o.error = 1'b1;
+    end
+  end
+
+  // Rank of each manager: within budget, then priority
+  logic [NumManagers-1:0][2:0] rank;
+  for (genvar m = 0; m < NumManagers; m++) begin : gen_rank
+    assign rank[m] = {budget_q[m] == '0 || used_q[m] < budget_q[m], prio_q[m]};
+  end
+
+  always_comb begin : proc_qos
+    req_o = req_i;
+    if (enable_q) begin
+      for (int unsigned m = 0; m < NumManagers; m++) begin
+        for (int unsigned n = 0; n < NumManagers; n++) begin
+          if (n != m && req_i[n] && sbr_idx_i[n] == sbr_idx_i[m] && rank[n] > rank[m] &&
+              !presented_q[m]) begin
+            req_o[m] = 1'b0;
+          end
+        end
+      end
+    end
+  end
+
+  always_ff @(posedge clk_i or negedge rst_ni) begin : proc_regs
+    if (!rst_ni) begin
+      enable_q     <= 1'b0;
+      window_q     <= 16'd256;
+      window_cnt_q <= '0;
+      prio_q       <= '{default: '0};
+      budget_q     <= '{default: '0};
+      used_q       <= '{default: '0};
+      throttled_q  <= '{default: '0};
+      wait_q       <= '{default: '0};
+      max_wait_q   <= '{default: '0};
+      presented_q  <= '0;
+    end else begin
+      if (reg_write && reg_word == 10'h0) begin
+        enable_q <= reg_req_i.wdata[0];
+      end
+      if (reg_write && reg_word == 10'h1) begin
+        window_q <= reg_req_i.wdata[15:0];
+      end
+
+      window_cnt_q <= window_cnt_q + 1;
+      if (window_cnt_q + 1 >= window_q) begin
+        window_cnt_q <= '0;
+      end
+
+      presented_q <= req_o & ~gnt_i;
+
+      for (int unsigned m = 0; m < NumManagers; m++) begin
+        if (reg_write && mgr_valid && mgr_idx == m && reg_word[5:4] == 2'h1) begin
+          prio_q[m]   <= reg_req_i.wdata[1:0];
+          budget_q[m] <= reg_req_i.wdata[31:16];
+        end
+
+        if (window_cnt_q + 1 >= window_q) begin
+          used_q[m] <= '0;
+        end else if (req_o[m] && gnt_i[m] && used_q[m] != '1) begin
+          used_q[m] <= used_q[m] + 1;
+        end
+
+        if (reg_write && mgr_valid && mgr_idx == m && reg_word[5:4] == 2'h2) begin
+          throttled_q[m] <= '0;
+        end else if (req_i[m] && !req_o[m] && throttled_q[m] != '1) begin
+          throttled_q[m] <= throttled_q[m] + 1;
+        end
+
+        // Cycles up to and including the grant
+        if (req_i[m] && gnt_i[m]) begin
+          wait_q[m] <= '0;
+        end else if (req_i[m] && wait_q[m] != '1) begin
+          wait_q[m] <= wait_q[m] + 1;
+        end
+        if (reg_write && mgr_valid && mgr_idx == m && reg_word[5:4] == 2'h3) begin
+          max_wait_q[m] <= '0;
+        end else if (req_i[m] && gnt_i[m] && wait_q[m] + 1 > max_wait_q[m]) begin
+          max_wait_q[m] <= wait_q[m] + 1;
+        end
+      end
+    end
+  end
+
+endmodule
@@ -7,7 +7,7 @@
 package safety_soc_ctrl_reg_pkg;
 
   // Address widths within the block
-  parameter int BlockAw = 4;
+  parameter int BlockAw = 5;
 
   ////////////////////////////
   // Typedefs for registers //
@@ -29,6 +29,16 @@ package safety_soc_ctrl_reg_pkg;
     logic [1:0]  q;
   } safety_soc_ctrl_reg2hw_bootmode_reg_t;
 
+  typedef struct packed {
+    logic [31:0] q;
+    logic        qe;
+  } safety_soc_ctrl_reg2hw_hostirq_set_reg_t;
+
+  typedef struct packed {
+    logic [31:0] q;
+    logic        qe;
+  } safety_soc_ctrl_reg2hw_hostirq_clr_reg_t;
+
   typedef struct packed {
     logic        d;
     logic        de;
@@ -39,40 +49,59 @@ package safety_soc_ctrl_reg_pkg;
     logic        de;
   } safety_soc_ctrl_hw2reg_bootmode_reg_t;
 
+  typedef struct packed {
+    logic [31:0] d;
+  } safety_soc_ctrl_hw2reg_hostirq_reg_t;
+
   // Register -> HW type
   typedef struct packed {
-    safety_soc_ctrl_reg2hw_bootaddr_reg_t bootaddr; // [66:35]
-    safety_soc_ctrl_reg2hw_fetchen_reg_t fetchen; // [34:34]
-    safety_soc_ctrl_reg2hw_corestatus_reg_t corestatus; // [33:2]
-    safety_soc_ctrl_reg2hw_bootmode_reg_t bootmode; // [1:0]
+    safety_soc_ctrl_reg2hw_bootaddr_reg_t bootaddr; // [132:101]
+    safety_soc_ctrl_reg2hw_fetchen_reg_t fetchen; // [100:100]
+    safety_soc_ctrl_reg2hw_corestatus_reg_t corestatus; // [99:68]
+    safety_soc_ctrl_reg2hw_bootmode_reg_t bootmode; // [67:66]
+    safety_soc_ctrl_reg2hw_hostirq_set_reg_t hostirq_set; // [65:33]
+    safety_soc_ctrl_reg2hw_hostirq_clr_reg_t hostirq_clr; // [32:0]
   } safety_soc_ctrl_reg2hw_t;
 
   // HW -> register type
   typedef struct packed {
-    safety_soc_ctrl_hw2reg_fetchen_reg_t fetchen; // [4:3]
-    safety_soc_ctrl_hw2reg_bootmode_reg_t bootmode; // [2:0]
+    safety_soc_ctrl_hw2reg_fetchen_reg_t fetchen; // [36:35]
+    safety_soc_ctrl_hw2reg_bootmode_reg_t bootmode; // [34:32]
+    safety_soc_ctrl_hw2reg_hostirq_reg_t hostirq; // [31:0]
   } safety_soc_ctrl_hw2reg_t;
 
   // Register offsets
-  parameter logic [BlockAw-1:0] SAFETY_SOC_CTRL_BOOTADDR_OFFSET = 4'h 0;
-  parameter logic [BlockAw-1:0] SAFETY_SOC_CTRL_FETCHEN_OFFSET = 4'h 4;
-  parameter logic [BlockAw-1:0] SAFETY_SOC_CTRL_CORESTATUS_OFFSET = 4'h 8;
-  parameter logic [BlockAw-1:0] SAFETY_SOC_CTRL_BOOTMODE_OFFSET = 4'h c;
+  parameter logic [BlockAw-1:0] SAFETY_SOC_CTRL_BOOTADDR_OFFSET = 5'h 0;
+  parameter logic [BlockAw-1:0] SAFETY_SOC_CTRL_FETCHEN_OFFSET = 5'h 4;
+  parameter logic [BlockAw-1:0] SAFETY_SOC_CTRL_CORESTATUS_OFFSET = 5'h 8;
+  parameter logic [BlockAw-1:0] SAFETY_SOC_CTRL_BOOTMODE_OFFSET = 5'h c;
+  parameter logic [BlockAw-1:0] SAFETY_SOC_CTRL_HOSTIRQ_OFFSET = 5'h 10;
+  parameter logic [BlockAw-1:0] SAFETY_SOC_CTRL_HOSTIRQ_SET_OFFSET = 5'h 14;
+  parameter logic [BlockAw-1:0] SAFETY_SOC_CTRL_HOSTIRQ_CLR_OFFSET = 5'h 18;
+
+  // Reset values for hwext registers and their fields
+  parameter logic [31:0] SAFETY_SOC_CTRL_HOSTIRQ_RESVAL = 32'h 0;
 
   // Register index
   typedef enum int {
     SAFETY_SOC_CTRL_BOOTADDR,
     SAFETY_SOC_CTRL_FETCHEN,
     SAFETY_SOC_CTRL_CORESTATUS,
-    SAFETY_SOC_CTRL_BOOTMODE
+    SAFETY_SOC_CTRL_BOOTMODE,
+    SAFETY_SOC_CTRL_HOSTIRQ,
+    SAFETY_SOC_CTRL_HOSTIRQ_SET,
+    SAFETY_SOC_CTRL_HOSTIRQ_CLR
   } safety_soc_ctrl_id_e;
 
   // Register width information to check illegal writes
-  parameter logic [3:0] SAFETY_SOC_CTRL_PERMIT [4] = '{
+  parameter logic [3:0] SAFETY_SOC_CTRL_PERMIT [7] = '{
     4'b 1111, // index[0] SAFETY_SOC_CTRL_BOOTADDR
     4'b 0001, // index[1] SAFETY_SOC_CTRL_FETCHEN
     4'b 1111, // index[2] SAFETY_SOC_CTRL_CORESTATUS
-    4'b 0001  // index[3] SAFETY_SOC_CTRL_BOOTMODE
+    4'b 0001, // index[3] SAFETY_SOC_CTRL_BOOTMODE
+    4'b 1111, // index[4] SAFETY_SOC_CTRL_HOSTIRQ
+    4'b 1111, // index[5] SAFETY_SOC_CTRL_HOSTIRQ_SET
+    4'b 1111  // index[6] SAFETY_SOC_CTRL_HOSTIRQ_CLR
   };
 
 endpackage
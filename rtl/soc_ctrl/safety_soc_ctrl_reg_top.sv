@@ -10,7 +10,7 @@
 module safety_soc_ctrl_reg_top #(
   parameter type reg_req_t = logic,
   parameter type reg_rsp_t = logic,
-  parameter int AW = 4,
+  parameter int AW = 5,
   parameter int unsigned BootAddrDefault = 32'h0
 ) (
   input logic clk_i,
@@ -81,6 +81,12 @@ module safety_soc_ctrl_reg_top #(
   logic [1:0] bootmode_qs;
   logic [1:0] bootmode_wd;
   logic bootmode_we;
+  logic [31:0] hostirq_qs;
+  logic hostirq_re;
+  logic [31:0] hostirq_set_wd;
+  logic hostirq_set_we;
+  logic [31:0] hostirq_clr_wd;
+  logic hostirq_clr_we;
 
   // Register instances
   // R[bootaddr]: V(False)
@@ -191,15 +197,86 @@ module safety_soc_ctrl_reg_top #(
   );
 
 
+  // R[hostirq]: V(True)
 
+  prim_subreg_ext #(
+    .DW    (32)
+  ) u_hostirq (
+    .re     (hostirq_re),
+    .we     (1'b0),
+    .wd     ('0),
+    .d      (hw2reg.hostirq.d),
+    .qre    (),
+    .qe     (),
+    .q      (),
+    .qs     (hostirq_qs)
+  );
+
+
+  // R[hostirq_set]: V(False)
+
+  prim_subreg #(
+    .DW      (32),
+    .SWACCESS("WO"),
+    .RESVAL  (32'h0)
+  ) u_hostirq_set (
+    .clk_i   (clk_i    ),
+    .rst_ni  (rst_ni  ),
+
+    // from register interface
+    .we     (hostirq_set_we),
+    .wd     (hostirq_set_wd),
+
+    // from internal hardware
+    .de     (1'b0),
+    .d      ('0  ),
+
+    // to internal hardware
+    .qe     (reg2hw.hostirq_set.qe),
+    .q      (reg2hw.hostirq_set.q ),
+
+    .qs     ()
+  );
+
+
+  // R[hostirq_clr]: V(False)
+
+  prim_subreg #(
+    .DW      (32),
+    .SWACCESS("WO"),
+    .RESVAL  (32'h0)
+  ) u_hostirq_clr (
+    .clk_i   (clk_i    ),
+    .rst_ni  (rst_ni  ),
+
+    // from register interface
+    .we     (hostirq_clr_we),
+    .wd     (hostirq_clr_wd),
+
+    // from internal hardware
+    .de     (1'b0),
+    .d      ('0  ),
+
+    // to internal hardware
+    .qe     (reg2hw.hostirq_clr.qe),
+    .q      (reg2hw.hostirq_clr.q ),
+
+    .qs     ()
+  );
 
-  logic [3:0] addr_hit;
+
+
+
+  logic [6:0] addr_hit;
   always_comb begin
     addr_hit = '0;
     addr_hit[0] = (reg_addr == SAFETY_SOC_CTRL_BOOTADDR_OFFSET);
     addr_hit[1] = (reg_addr == SAFETY_SOC_CTRL_FETCHEN_OFFSET);
     addr_hit[2] = (reg_addr == SAFETY_SOC_CTRL_CORESTATUS_OFFSET);
     addr_hit[3] = (reg_addr == SAFETY_SOC_CTRL_BOOTMODE_OFFSET);
+    addr_hit[4] = (reg_addr == SAFETY_SOC_CTRL_HOSTIRQ_OFFSET);
+    addr_hit[5] = (reg_addr == SAFETY_SOC_CTRL_HOSTIRQ_SET_OFFSET);
+    addr_hit[6] = (reg_addr == SAFETY_SOC_CTRL_HOSTIRQ_CLR_OFFSET);
   end
 
   assign addrmiss = (reg_re || reg_we) ? ~|addr_hit : 1'b0 ;
@@ -210,7 +287,10 @@ module safety_soc_ctrl_reg_top #(
               ((addr_hit[0] & (|(SAFETY_SOC_CTRL_PERMIT[0] & ~reg_be))) |
                (addr_hit[1] & (|(SAFETY_SOC_CTRL_PERMIT[1] & ~reg_be))) |
                (addr_hit[2] & (|(SAFETY_SOC_CTRL_PERMIT[2] & ~reg_be))) |
-               (addr_hit[3] & (|(SAFETY_SOC_CTRL_PERMIT[3] & ~reg_be)))));
+               (addr_hit[3] & (|(SAFETY_SOC_CTRL_PERMIT[3] & ~reg_be))) |
+               (addr_hit[4] & (|(SAFETY_SOC_CTRL_PERMIT[4] & ~reg_be))) |
+               (addr_hit[5] & (|(SAFETY_SOC_CTRL_PERMIT[5] & ~reg_be))) |
+               (addr_hit[6] & (|(SAFETY_SOC_CTRL_PERMIT[6] & ~reg_be)))));
   end
 
   assign bootaddr_we = addr_hit[0] & reg_we & !reg_error;
@@ -225,6 +305,14 @@ module safety_soc_ctrl_reg_top #(
   assign bootmode_we = addr_hit[3] & reg_we & !reg_error;
   assign bootmode_wd = reg_wdata[1:0];
 
+  assign hostirq_re = addr_hit[4] & reg_re & !reg_error;
+
+  assign hostirq_set_we = addr_hit[5] & reg_we & !reg_error;
+  assign hostirq_set_wd = reg_wdata[31:0];
+
+  assign hostirq_clr_we = addr_hit[6] & reg_we & !reg_error;
+  assign hostirq_clr_wd = reg_wdata[31:0];
+
   // Read data return
   always_comb begin
     reg_rdata_next = '0;
@@ -245,6 +333,18 @@ module safety_soc_ctrl_reg_top #(
         reg_rdata_next[1:0] = bootmode_qs;
       end
 
+      addr_hit[4]: begin
+        reg_rdata_next[31:0] = hostirq_qs;
+      end
+
+      addr_hit[5]: begin
+        reg_rdata_next[31:0] = '0;
+      end
+
+      addr_hit[6]: begin
+        reg_rdata_next[31:0] = '0;
+      end
+
       default: begin
         reg_rdata_next = '1;
       end
@@ -267,7 +367,7 @@ endmodule
 
 module safety_soc_ctrl_reg_top_intf
 #(
-  parameter int AW = 4,
+  parameter int AW = 5,
   localparam int DW = 32
 ) (
   input logic clk_i,
@@ -23,7 +23,9 @@ package safety_island_synth_pkg;
 
   localparam int unsigned SynthAxiInIdWidth  = 5;
   typedef logic [SynthAxiInIdWidth-1:0] synth_axi_in_id_t;
-  localparam int unsigned SynthAxiOutIdWidth = 2;
+  // Two ID bits for the crossbar, plus the bits selecting the AXI output manager
+  localparam int unsigned SynthAxiOutIdWidth =
+    2 + $clog2(axi_out_num_ports(SafetyIslandDefaultConfig));
   typedef logic [SynthAxiOutIdWidth-1:0] synth_axi_out_id_t;
   localparam bit [SynthAxiUserWidth-1:0] SynthDefaultUser = 10'b0000000101;
 
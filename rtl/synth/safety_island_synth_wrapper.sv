@@ -71,6 +71,8 @@ module safety_island_synth_wrapper import safety_island_synth_pkg::*; #(
 ) (
   input  logic clk_i,
   input  logic ref_clk_i,
+  // Clock of the host receiving the output interrupts
+  input  logic host_clk_i,
   input  logic rst_ni,
   input  logic pwr_on_rst_ni,
   input  logic test_enable_i,
@@ -86,9 +88,13 @@ module safety_island_synth_wrapper import safety_island_synth_pkg::*; #(
   output logic jtag_tdo_o,
 
   input  logic [SafetyIslandCfg.NumInterrupts-1:0] irqs_i,
+  input  logic [SafetyIslandCfg.NumTimerEvents-1:0] timer_events_i,
 
   output logic [NumDebug-1:0]                      debug_req_o,
 
+  output logic [SafetyIslandCfg.MailboxNumChannels-1:0] mailbox_irqs_o,
+  output logic [SafetyIslandCfg.NumHostIrqs-1:0]        host_irqs_o,
+
   input  logic [AsyncAxiInAwWidth-1:0] async_axi_in_aw_data_i,
   input  logic            [LogDepth:0] async_axi_in_aw_wptr_i,
   output logic            [LogDepth:0] async_axi_in_aw_rptr_o,
@@ -131,6 +137,14 @@ module safety_island_synth_wrapper import safety_island_synth_pkg::*; #(
   logic fetch_en_sync;
   logic axi_isolate_sync;
   logic [SafetyIslandCfg.NumInterrupts-1:0] irqs_sync;
+  logic [SafetyIslandCfg.NumTimerEvents-1:0] timer_events_sync;
+
+  localparam int unsigned NumOutIrqs = SafetyIslandCfg.MailboxNumChannels +
+                                       SafetyIslandCfg.NumHostIrqs;
+
+  logic [SafetyIslandCfg.MailboxNumChannels-1:0] mailbox_irqs;
+  logic [SafetyIslandCfg.NumHostIrqs-1:0]        host_irqs;
+  logic [NumOutIrqs-1:0]                         out_irqs, out_irqs_sync;
 
   sync #(
     .STAGES     ( SyncStages ),
@@ -164,6 +178,34 @@ module safety_island_synth_wrapper import safety_island_synth_pkg::*; #(
     );
   end
 
+  for (genvar i = 0; i < SafetyIslandCfg.NumTimerEvents; i++) begin : gen_timer_event_sync
+    sync #(
+      .STAGES     ( SyncStages ),
+      .ResetValue ( 1'b0       )
+    ) i_timer_event_sync (
+      .clk_i,
+      .rst_ni   ( pwr_on_rst_ni        ),
+      .serial_i ( timer_events_i[i]    ),
+      .serial_o ( timer_events_sync[i] )
+    );
+  end
+
+  // Interrupts to the host, synchronized to its clock
+  assign out_irqs                      = {host_irqs, mailbox_irqs};
+  assign {host_irqs_o, mailbox_irqs_o} = out_irqs_sync;
+
+  for (genvar i = 0; i < NumOutIrqs; i++) begin : gen_out_irq_sync
+    sync #(
+      .STAGES     ( SyncStages ),
+      .ResetValue ( 1'b0       )
+    ) i_out_irq_sync (
+      .clk_i    ( host_clk_i    ),
+      .rst_ni   ( pwr_on_rst_ni ),
+      .serial_i ( out_irqs[i]      ),
+      .serial_o ( out_irqs_sync[i] )
+    );
+  end
+
   axi_cdc_dst #(
     .LogDepth   ( LogDepth         ),
     .SyncStages ( CdcSyncStages    ),
@@ -229,7 +271,7 @@ module safety_island_synth_wrapper import safety_island_synth_pkg::*; #(
   );
 
   axi_isolate            #(
-    .NumPending           ( safety_island_pkg::AxiMaxOutTrans ),
+    .NumPending           ( safety_island_pkg::axi_out_max_trans(SafetyIslandCfg) ),
     .TerminateTransaction ( 1              ),
     .AtopSupport          ( 1              ),
     .AxiAddrWidth         ( AxiAddrWidth   ),
@@ -287,7 +329,10 @@ module safety_island_synth_wrapper import safety_island_synth_pkg::*; #(
     .bootmode_i,
     .fetch_enable_i   ( fetch_en_sync        ),
     .irqs_i           ( irqs_sync            ),
+    .timer_events_i   ( timer_events_sync    ),
     .debug_req_o      ( debug_req_o          ),
+    .mailbox_irqs_o   ( mailbox_irqs         ),
+    .host_irqs_o      ( host_irqs            ),
     .axi_input_req_i  ( axi_in_req           ),
     .axi_input_resp_o ( axi_in_resp          ),
     .axi_output_req_o ( axi_out_isolate_req  ),
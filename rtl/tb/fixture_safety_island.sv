@@ -23,7 +23,63 @@ module fixture_safety_island;
   localparam real TestFrac   = 0.9;
 
   // Safety Island Configs
-  parameter safety_island_pkg::safety_island_cfg_t SafetyIslandCfg = SafetyIslandDefaultConfig;
+  parameter int unsigned NumBanks  = SafetyIslandDefaultConfig.NumBanks;
+  parameter int unsigned NumTimers = SafetyIslandDefaultConfig.NumTimers;
+  parameter bit          UseICache = SafetyIslandDefaultConfig.UseICache;
+  parameter bit          UseWriteBuffer = SafetyIslandDefaultConfig.UseWriteBuffer;
+  parameter bit          UseWideAxiIn   = SafetyIslandDefaultConfig.UseWideAxiIn;
+  parameter bit          UseStoreMerge  = SafetyIslandDefaultConfig.UseStoreMerge;
+  parameter bit          UseMailbox     = SafetyIslandDefaultConfig.UseMailbox;
+  parameter bit          UseSplitMode   = SafetyIslandDefaultConfig.UseSplitMode;
+  parameter bit          UseAmoUnit     = SafetyIslandDefaultConfig.UseAmoUnit;
+  parameter bit          UseDataFastPath = SafetyIslandDefaultConfig.UseDataFastPath;
+  parameter bit          UseRegTimer    = SafetyIslandDefaultConfig.UseRegTimer;
+  parameter bit          UseSensorDma   = SafetyIslandDefaultConfig.UseSensorDma;
+  parameter bit          UsePerfMon     = SafetyIslandDefaultConfig.UsePerfMon;
+  parameter bit          UseXbarQos     = SafetyIslandDefaultConfig.UseXbarQos;
+  parameter bit          UseIrqTimestamp = SafetyIslandDefaultConfig.UseIrqTimestamp;
+  parameter bit          UseBankInit    = SafetyIslandDefaultConfig.UseBankInit;
+  parameter bit          UseScrubCtrl   = SafetyIslandDefaultConfig.UseScrubCtrl;
+  parameter bit          UseEccLog      = SafetyIslandDefaultConfig.UseEccLog;
+  parameter bit          UseTrace       = SafetyIslandDefaultConfig.UseTrace;
+  parameter bit          UseSchedTable  = SafetyIslandDefaultConfig.UseSchedTable;
+  parameter bit          UseTclsResync  = SafetyIslandDefaultConfig.UseTclsResync;
+  // Outstanding transactions on the AXI ports and the interconnect
+  parameter int unsigned MaxTrans  = SafetyIslandDefaultConfig.AxiOutMaxTrans;
+  // Additional cycles of latency to the external memory (in each direction)
+  parameter int unsigned ExtMemLatency = 0;
+
+  function automatic safety_island_cfg_t gen_safety_island_cfg();
+    safety_island_cfg_t ret = SafetyIslandDefaultConfig;
+    ret.NumBanks  = NumBanks;
+    ret.NumTimers = NumTimers;
+    ret.UseICache = UseICache;
+    ret.UseWriteBuffer = UseWriteBuffer;
+    ret.UseWideAxiIn   = UseWideAxiIn;
+    ret.UseStoreMerge  = UseStoreMerge;
+    ret.UseMailbox     = UseMailbox;
+    ret.UseSplitMode   = UseSplitMode;
+    ret.UseAmoUnit     = UseAmoUnit;
+    ret.UseDataFastPath = UseDataFastPath;
+    ret.UseRegTimer    = UseRegTimer;
+    ret.UseSensorDma   = UseSensorDma;
+    ret.UsePerfMon     = UsePerfMon;
+    ret.UseXbarQos     = UseXbarQos;
+    ret.UseIrqTimestamp = UseIrqTimestamp;
+    ret.UseBankInit    = UseBankInit;
+    ret.UseScrubCtrl   = UseScrubCtrl;
+    ret.UseEccLog      = UseEccLog;
+    ret.UseTrace       = UseTrace;
+    ret.UseSchedTable  = UseSchedTable;
+    ret.UseTclsResync  = UseTclsResync;
+    ret.AxiInMaxTrans  = MaxTrans;
+    ret.AxiOutMaxTrans = MaxTrans;
+    ret.XbarMaxTrans   = MaxTrans;
+    ret.PeriphMaxTrans = MaxTrans;
+    return ret;
+  endfunction
+
+  parameter safety_island_pkg::safety_island_cfg_t SafetyIslandCfg = gen_safety_island_cfg();
 
 `ifdef SAFED_POSTLAYOUT
   localparam int unsigned              GlobalAddrWidth = 48;
@@ -52,7 +108,7 @@ module fixture_safety_island;
   localparam int unsigned AxiAddrWidth     = GlobalAddrWidth;
   localparam int unsigned AxiInputIdWidth  = 6;
   localparam int unsigned AxiUserWidth     = 10;
-  localparam int unsigned AxiOutputIdWidth = 2;
+  localparam int unsigned AxiOutputIdWidth = 3;
 
   `AXI_TYPEDEF_ALL(axi_input,
                    logic[AxiAddrWidth-1:0],
@@ -134,14 +190,26 @@ module fixture_safety_island;
 
   logic axi_isolate, axi_isolated;
 
+  logic [SafetyIslandCfg.MailboxNumChannels-1:0] mailbox_irqs;
+  logic [SafetyIslandCfg.NumHostIrqs-1:0]        host_irqs;
+  logic [SafetyIslandCfg.NumTimerEvents-1:0]     timer_events;
+
   assign axi_isolate = 1'b0; // Hardcoded for now, eventually connect to control register
 
+  // The host interrupts loop back as timer events, so software can generate capture edges
+  for (genvar i = 0; i < SafetyIslandCfg.NumTimerEvents; i++) begin : gen_timer_events
+    assign timer_events[i] = host_irqs[i % SafetyIslandCfg.NumHostIrqs];
+  end
+
   axi_input_req_t from_ext_req;
   axi_input_resp_t from_ext_resp;
 
   axi_output_req_t to_ext_req;
   axi_output_resp_t to_ext_resp;
 
+  axi_output_req_t ext_mem_req;
+  axi_output_resp_t ext_mem_resp;
+
   axi_cdc_src #(
     .LogDepth  ( LogDepth            ),
     .SyncStages( 3                   ),
@@ -208,6 +276,25 @@ module fixture_safety_island;
     .dst_resp_i                 ( to_ext_resp )
   );
 
+  // Model the latency of the SoC memory system
+  axi_multicut #(
+    .NoCuts     ( ExtMemLatency        ),
+    .aw_chan_t  ( axi_output_aw_chan_t ),
+    .w_chan_t   ( axi_output_w_chan_t  ),
+    .b_chan_t   ( axi_output_b_chan_t  ),
+    .ar_chan_t  ( axi_output_ar_chan_t ),
+    .r_chan_t   ( axi_output_r_chan_t  ),
+    .axi_req_t  ( axi_output_req_t     ),
+    .axi_resp_t ( axi_output_resp_t    )
+  ) i_ext_mem_latency (
+    .clk_i      ( s_ext_clk    ),
+    .rst_ni     ( s_rst_n      ),
+    .slv_req_i  ( to_ext_req   ),
+    .slv_resp_o ( to_ext_resp  ),
+    .mst_req_o  ( ext_mem_req  ),
+    .mst_resp_i ( ext_mem_resp )
+  );
+
 `ifdef SAFED_POSTLAYOUT
   safety_island
 `else // SAFED_POSTLAYOUT
@@ -258,6 +345,7 @@ module fixture_safety_island;
   i_dut (
     .clk_i                   ( s_clk         ),
     .ref_clk_i               ( s_ref_clk     ),
+    .host_clk_i              ( s_ext_clk     ),
     .rst_ni                  ( s_rst_n       ),
     .pwr_on_rst_ni           ( s_rst_n       ),
     .test_enable_i           ( s_test_enable ),
@@ -272,9 +360,12 @@ module fixture_safety_island;
     .jtag_tdi_i              ( s_tdi   ),
     .jtag_tdo_o              ( s_tdo   ),
 
-    .irqs_i                  ( '0 ),
+    .irqs_i                  ( '0           ),
+    .timer_events_i          ( timer_events ),
 
     .debug_req_o             (),
+    .mailbox_irqs_o          ( mailbox_irqs ),
+    .host_irqs_o             ( host_irqs    ),
 
     .async_axi_in_aw_data_i  ( async_in_aw_data ),
     .async_axi_in_aw_wptr_i  ( in_aw_wptr       ),
@@ -348,8 +439,8 @@ module fixture_safety_island;
     .test_mode       ( s_test_enable ),
     .boot_mode       ( s_bootmode    ),
     .rtc             ( s_ref_clk     ),
-    .axi_mst_req     ( to_ext_req    ),
-    .axi_mst_rsp     ( to_ext_resp   ),
+    .axi_mst_req     ( ext_mem_req   ),
+    .axi_mst_rsp     ( ext_mem_resp  ),
     .axi_slv_req     ( from_ext_req  ),
     .axi_slv_rsp     ( from_ext_resp ),
     // JTAG interface
@@ -358,6 +449,9 @@ module fixture_safety_island;
     .jtag_tms        ( s_tms   ),
     .jtag_tdi        ( s_tdi   ),
     .jtag_tdo        ( s_tdo   ),
+    // Interrupts to the host
+    .mailbox_irqs    ( mailbox_irqs ),
+    .host_irqs       ( host_irqs    ),
     // Exit
     .exit_status
   );
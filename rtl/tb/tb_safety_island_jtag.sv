@@ -10,7 +10,55 @@
 
 module tb_safety_island_jtag;
 
-  fixture_safety_island fixt_safety_island();
+  parameter int unsigned NumBanks  = safety_island_pkg::SafetyIslandDefaultConfig.NumBanks;
+  parameter int unsigned NumTimers = safety_island_pkg::SafetyIslandDefaultConfig.NumTimers;
+  parameter bit          UseICache = safety_island_pkg::SafetyIslandDefaultConfig.UseICache;
+  parameter bit          UseWriteBuffer = safety_island_pkg::SafetyIslandDefaultConfig.UseWriteBuffer;
+  parameter bit          UseWideAxiIn   = safety_island_pkg::SafetyIslandDefaultConfig.UseWideAxiIn;
+  parameter bit          UseStoreMerge  = safety_island_pkg::SafetyIslandDefaultConfig.UseStoreMerge;
+  parameter bit          UseMailbox     = safety_island_pkg::SafetyIslandDefaultConfig.UseMailbox;
+  parameter bit          UseSplitMode   = safety_island_pkg::SafetyIslandDefaultConfig.UseSplitMode;
+  parameter bit          UseAmoUnit     = safety_island_pkg::SafetyIslandDefaultConfig.UseAmoUnit;
+  parameter bit          UseDataFastPath = safety_island_pkg::SafetyIslandDefaultConfig.UseDataFastPath;
+  parameter bit          UseRegTimer    = safety_island_pkg::SafetyIslandDefaultConfig.UseRegTimer;
+  parameter bit          UseSensorDma   = safety_island_pkg::SafetyIslandDefaultConfig.UseSensorDma;
+  parameter bit          UsePerfMon     = safety_island_pkg::SafetyIslandDefaultConfig.UsePerfMon;
+  parameter bit          UseXbarQos     = safety_island_pkg::SafetyIslandDefaultConfig.UseXbarQos;
+  parameter bit          UseIrqTimestamp = safety_island_pkg::SafetyIslandDefaultConfig.UseIrqTimestamp;
+  parameter bit          UseBankInit    = safety_island_pkg::SafetyIslandDefaultConfig.UseBankInit;
+  parameter bit          UseScrubCtrl   = safety_island_pkg::SafetyIslandDefaultConfig.UseScrubCtrl;
+  parameter bit          UseEccLog      = safety_island_pkg::SafetyIslandDefaultConfig.UseEccLog;
+  parameter bit          UseTrace       = safety_island_pkg::SafetyIslandDefaultConfig.UseTrace;
+  parameter bit          UseSchedTable  = safety_island_pkg::SafetyIslandDefaultConfig.UseSchedTable;
+  parameter bit          UseTclsResync  = safety_island_pkg::SafetyIslandDefaultConfig.UseTclsResync;
+  parameter int unsigned MaxTrans  = safety_island_pkg::SafetyIslandDefaultConfig.AxiOutMaxTrans;
+  parameter int unsigned ExtMemLatency = 0;
+
+  fixture_safety_island #(
+    .NumBanks       ( NumBanks       ),
+    .NumTimers      ( NumTimers      ),
+    .UseICache      ( UseICache      ),
+    .UseWriteBuffer ( UseWriteBuffer ),
+    .UseWideAxiIn   ( UseWideAxiIn   ),
+    .UseStoreMerge  ( UseStoreMerge  ),
+    .UseMailbox     ( UseMailbox     ),
+    .UseSplitMode   ( UseSplitMode   ),
+    .UseAmoUnit     ( UseAmoUnit     ),
+    .UseDataFastPath ( UseDataFastPath ),
+    .UseRegTimer    ( UseRegTimer    ),
+    .UseSensorDma   ( UseSensorDma   ),
+    .UsePerfMon     ( UsePerfMon     ),
+    .UseXbarQos     ( UseXbarQos     ),
+    .UseIrqTimestamp ( UseIrqTimestamp ),
+    .UseBankInit    ( UseBankInit    ),
+    .UseScrubCtrl   ( UseScrubCtrl   ),
+    .UseEccLog      ( UseEccLog      ),
+    .UseTrace       ( UseTrace       ),
+    .UseSchedTable  ( UseSchedTable  ),
+    .UseTclsResync  ( UseTclsResync  ),
+    .MaxTrans       ( MaxTrans       ),
+    .ExtMemLatency  ( ExtMemLatency  )
+  ) fixt_safety_island();
 
   string       preload_elf;
   bit   [31:0] exit_code;
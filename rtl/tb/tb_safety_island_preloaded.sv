@@ -10,19 +10,91 @@
 
 module tb_safety_island_preloaded;
 
-  fixture_safety_island fixt_safety_island();
+  parameter int unsigned NumBanks  = safety_island_pkg::SafetyIslandDefaultConfig.NumBanks;
+  parameter int unsigned NumTimers = safety_island_pkg::SafetyIslandDefaultConfig.NumTimers;
+  parameter bit          UseICache = safety_island_pkg::SafetyIslandDefaultConfig.UseICache;
+  parameter bit          UseWriteBuffer = safety_island_pkg::SafetyIslandDefaultConfig.UseWriteBuffer;
+  parameter bit          UseWideAxiIn   = safety_island_pkg::SafetyIslandDefaultConfig.UseWideAxiIn;
+  parameter bit          UseStoreMerge  = safety_island_pkg::SafetyIslandDefaultConfig.UseStoreMerge;
+  parameter bit          UseMailbox     = safety_island_pkg::SafetyIslandDefaultConfig.UseMailbox;
+  parameter bit          UseSplitMode   = safety_island_pkg::SafetyIslandDefaultConfig.UseSplitMode;
+  parameter bit          UseAmoUnit     = safety_island_pkg::SafetyIslandDefaultConfig.UseAmoUnit;
+  parameter bit          UseDataFastPath = safety_island_pkg::SafetyIslandDefaultConfig.UseDataFastPath;
+  parameter bit          UseRegTimer    = safety_island_pkg::SafetyIslandDefaultConfig.UseRegTimer;
+  parameter bit          UseSensorDma   = safety_island_pkg::SafetyIslandDefaultConfig.UseSensorDma;
+  parameter bit          UsePerfMon     = safety_island_pkg::SafetyIslandDefaultConfig.UsePerfMon;
+  parameter bit          UseXbarQos     = safety_island_pkg::SafetyIslandDefaultConfig.UseXbarQos;
+  parameter bit          UseIrqTimestamp = safety_island_pkg::SafetyIslandDefaultConfig.UseIrqTimestamp;
+  parameter bit          UseBankInit    = safety_island_pkg::SafetyIslandDefaultConfig.UseBankInit;
+  parameter bit          UseScrubCtrl   = safety_island_pkg::SafetyIslandDefaultConfig.UseScrubCtrl;
+  parameter bit          UseEccLog      = safety_island_pkg::SafetyIslandDefaultConfig.UseEccLog;
+  parameter bit          UseTrace       = safety_island_pkg::SafetyIslandDefaultConfig.UseTrace;
+  parameter bit          UseSchedTable  = safety_island_pkg::SafetyIslandDefaultConfig.UseSchedTable;
+  parameter bit          UseTclsResync  = safety_island_pkg::SafetyIslandDefaultConfig.UseTclsResync;
+  parameter int unsigned MaxTrans  = safety_island_pkg::SafetyIslandDefaultConfig.AxiOutMaxTrans;
+  parameter int unsigned ExtMemLatency = 0;
+
+  fixture_safety_island #(
+    .NumBanks       ( NumBanks       ),
+    .NumTimers      ( NumTimers      ),
+    .UseICache      ( UseICache      ),
+    .UseWriteBuffer ( UseWriteBuffer ),
+    .UseWideAxiIn   ( UseWideAxiIn   ),
+    .UseStoreMerge  ( UseStoreMerge  ),
+    .UseMailbox     ( UseMailbox     ),
+    .UseSplitMode   ( UseSplitMode   ),
+    .UseAmoUnit     ( UseAmoUnit     ),
+    .UseDataFastPath ( UseDataFastPath ),
+    .UseRegTimer    ( UseRegTimer    ),
+    .UseSensorDma   ( UseSensorDma   ),
+    .UsePerfMon     ( UsePerfMon     ),
+    .UseXbarQos     ( UseXbarQos     ),
+    .UseIrqTimestamp ( UseIrqTimestamp ),
+    .UseBankInit    ( UseBankInit    ),
+    .UseScrubCtrl   ( UseScrubCtrl   ),
+    .UseEccLog      ( UseEccLog      ),
+    .UseTrace       ( UseTrace       ),
+    .UseSchedTable  ( UseSchedTable  ),
+    .UseTclsResync  ( UseTclsResync  ),
+    .MaxTrans       ( MaxTrans       ),
+    .ExtMemLatency  ( ExtMemLatency  )
+  ) fixt_safety_island();
 
   string       preload_elf;
+  int unsigned axi_traffic;
+  int unsigned axi_bandwidth;
+  int unsigned mailbox_roundtrips;
+  int unsigned amo_queue;
+  int unsigned host_irqs;
+  int unsigned host_irq_idx;
   bit   [31:0] exit_code;
   bit          exit_status;
 
   initial begin : axi_boot_process
 
     if (!$value$plusargs("BINARY=%s",   preload_elf))   preload_elf   = "";
+    if (!$value$plusargs("AXI_TRAFFIC=%d", axi_traffic)) axi_traffic = 0;
+    if (!$value$plusargs("AXI_BANDWIDTH=%d", axi_bandwidth)) axi_bandwidth = 0;
+    if (!$value$plusargs("MAILBOX_ROUNDTRIPS=%d", mailbox_roundtrips)) mailbox_roundtrips = 0;
+    if (!$value$plusargs("AMO_QUEUE=%d", amo_queue)) amo_queue = 0;
+    if (!$value$plusargs("HOST_IRQS=%d", host_irqs)) host_irqs = 0;
 
     fixt_safety_island.vip.set_safed_boot_mode(safety_island_pkg::Preloaded);
     fixt_safety_island.vip.safed_wait_for_reset();
+    // Optional AXI input bandwidth measurement before the binary is loaded
+    if (axi_bandwidth != 0) fixt_safety_island.vip.axi_input_bandwidth(axi_bandwidth);
     fixt_safety_island.vip.axi_safed_elf_run(preload_elf);
+    // Optional AXI input traffic concurrent to the running binary
+    if (axi_traffic != 0) fixt_safety_island.vip.axi_bank_traffic(axi_traffic);
+    // Optional SCMI requests to the running binary
+    if (mailbox_roundtrips != 0) fixt_safety_island.vip.axi_mailbox_roundtrip(mailbox_roundtrips);
+    // Optional host side of the AMO queue benchmark
+    if (amo_queue != 0) fixt_safety_island.vip.axi_amo_queue(amo_queue);
+    // Optional interrupts raised by the binary, acknowledged by the host
+    for (int unsigned i = 0; i < host_irqs; i++) begin
+      fixt_safety_island.vip.axi_wait_host_irq(host_irq_idx);
+      $display("[TB] Host interrupt %0d", host_irq_idx);
+    end
     fixt_safety_island.vip.axi_safed_wait_for_eoc(exit_code, exit_status);
 
     $finish;
@@ -56,6 +56,9 @@ module vip_safety_island_soc import safety_island_pkg::*; #(
   output logic jtag_tms,
   output logic jtag_tdi,
   input  logic jtag_tdo,
+  // Interrupts to the host
+  input  logic [DutCfg.MailboxNumChannels-1:0] mailbox_irqs,
+  input  logic [DutCfg.NumHostIrqs-1:0]        host_irqs,
   // Exit
   output bit exit_status
 );
@@ -72,6 +75,12 @@ module vip_safety_island_soc import safety_island_pkg::*; #(
                   safety_soc_ctrl_reg_pkg::SAFETY_SOC_CTRL_CORESTATUS_OFFSET;
   localparam bit [AxiAddrWidth-1:0] BootModeAddr   = SocCtrlAddr +
                   safety_soc_ctrl_reg_pkg::SAFETY_SOC_CTRL_BOOTMODE_OFFSET;
+  localparam bit [AxiAddrWidth-1:0] HostIrqClrAddr = SocCtrlAddr +
+                  safety_soc_ctrl_reg_pkg::SAFETY_SOC_CTRL_HOSTIRQ_CLR_OFFSET;
+  localparam bit [AxiAddrWidth-1:0] MailboxAddr    = BaseAddr + PeriphOffset + MailboxAddrOffset;
+  // Queues shared with `sw/tests/runtime_amo_queue`, in the top page of bank 0
+  localparam bit [AxiAddrWidth-1:0] AmoQueueAddr   = BaseAddr + MemOffset + DutCfg.BankNumBytes -
+                                                     'h1000;
 
   typedef logic [AxiAddrWidth-1:0] addr_t;
   typedef logic [AxiDataWidth-1:0] axi_data_t;
@@ -335,6 +344,99 @@ module vip_safety_island_soc import safety_island_pkg::*; #(
 
   endtask
 
+  // Wait for any interrupt line to the host instead of polling, then acknowledge it through the
+  // clear register and wait for the synchronized line to drop.
+  task automatic axi_wait_host_irq(output int unsigned idx);
+    @(posedge ext_clk iff |host_irqs);
+    for (idx = 0; idx < DutCfg.NumHostIrqs; idx++) begin
+      if (host_irqs[idx]) break;
+    end
+    axi_write_32(HostIrqClrAddr, 1 << idx);
+    wait (!host_irqs[idx]);
+  endtask
+
+  // Send SCMI messages through mailbox channel 0 and report the round-trip latency from ringing
+  // the doorbell to the completion interrupt. The binary running on the island is expected to
+  // answer each message with its payload incremented by one.
+  task automatic axi_mailbox_roundtrip(input int unsigned num_msgs);
+    word_bt  data;
+    realtime t_start;
+    real     cycles, cycles_sum = 0, cycles_max = 0;
+    $display("[AXI] Mailbox: %0d round trips", num_msgs);
+    // Interrupt-driven completion
+    axi_write_32(MailboxAddr + 'h10, 1);
+    for (int unsigned i = 0; i < num_msgs; i++) begin
+      axi_data_t beats [$];
+      // Wait for the island to free the channel
+      do begin
+        beats.delete();
+        axi_read_beats(MailboxAddr + 'h04, 2, 0, beats);
+        data = beats[0] >> (8 * ((MailboxAddr + 'h04) % AxiStrbWidth));
+      end while (!data[0]);
+      axi_write_32(MailboxAddr + 'h18, i);               // MESSAGE_HEADER
+      axi_write_32(MailboxAddr + 'h1C, 'hCAFE_0000 + i); // MESSAGE_PAYLOAD_1
+      axi_write_32(MailboxAddr + 'h14, 8);               // LENGTH
+      axi_write_32(MailboxAddr + 'h04, 0);               // CHANNEL_STATUS: busy
+      t_start = $realtime;
+      axi_write_32(MailboxAddr + 'h20, 1);               // DOORBELL
+      wait (mailbox_irqs[0]);
+      cycles = ($realtime - t_start)/ClkPeriodSys;
+      cycles_sum += cycles;
+      if (cycles > cycles_max) cycles_max = cycles;
+      beats.delete();
+      axi_read_beats(MailboxAddr + 'h1C, 2, 0, beats);
+      data = beats[0] >> (8 * ((MailboxAddr + 'h1C) % AxiStrbWidth));
+      if (data != 'hCAFE_0000 + i + 1)
+        $error("[AXI] Mailbox: response 0x%h to message %0d", data, i);
+      axi_write_32(MailboxAddr + 'h24, 0);               // Acknowledge COMPLETION_INTERRUPT
+    end
+    $display("[AXI] Mailbox: round trip %0.1f cycles on average, %0.0f max",
+             cycles_sum/num_msgs, cycles_max);
+  endtask
+
+  // Lock-free queue operations from the host against the binary running on the island, using AXI
+  // ATOPs on the queue words. The layout matches `sw/tests/runtime_shared/include/amo_queue.h`:
+  // 0x00 READY, 0x04 MPSC_TAIL, 0x08 MPSC_DONE, 0x10 SPSC_TAIL, 0x14 SPSC_HEAD,
+  // 0x100 MPSC slots, 0x400 SPSC ring of `AMO_QUEUE_RING` words.
+  // The host enqueues `num_ops` tagged items into the MPSC queue concurrently with the island,
+  // then produces `num_ops` items into the SPSC ring consumed by the island.
+  task automatic axi_amo_queue(input int unsigned num_ops);
+    localparam int unsigned RingWords = 16;
+    word_bt      data, ticket;
+    int unsigned tail = 0;
+    realtime     t_start;
+    // Wait for the island to initialize the queues
+    do begin
+      #(ClkPeriodSys * 16);
+      axi_read_32(AmoQueueAddr + 'h00, data);
+    end while (data != num_ops);
+
+    $display("[AXI] AMO queue: %0d MPSC enqueues", num_ops);
+    t_start = $realtime;
+    for (int unsigned i = 0; i < num_ops; i++) begin
+      axi_atop_32(AmoQueueAddr + 'h04, {axi_pkg::ATOP_ATOMICLOAD, axi_pkg::ATOP_LITTLE_END,
+                                        axi_pkg::ATOP_ADD}, 1, ticket);
+      axi_write_32(AmoQueueAddr + 'h100 + 4*ticket, 'h8000_0000 | i);
+    end
+    axi_atop_32(AmoQueueAddr + 'h08, {axi_pkg::ATOP_ATOMICLOAD, axi_pkg::ATOP_LITTLE_END,
+                                      axi_pkg::ATOP_ADD}, 1, data);
+    $display("[AXI] AMO queue: MPSC %0.1f cycles per enqueue",
+             ($realtime - t_start)/ClkPeriodSys/num_ops);
+
+    $display("[AXI] AMO queue: %0d SPSC items", num_ops);
+    t_start = $realtime;
+    for (int unsigned i = 0; i < num_ops; i++) begin
+      // Wait for a free slot
+      do axi_read_32(AmoQueueAddr + 'h14, data); while (tail - data >= RingWords);
+      axi_write_32(AmoQueueAddr + 'h400 + 4*(tail % RingWords), 7*i + 1);
+      axi_atop_32(AmoQueueAddr + 'h10, {axi_pkg::ATOP_ATOMICLOAD, axi_pkg::ATOP_LITTLE_END,
+                                        axi_pkg::ATOP_ADD}, 1, data);
+      tail++;
+    end
+    $display("[AXI] AMO queue: SPSC %0.1f cycles per item",
+             ($realtime - t_start)/ClkPeriodSys/num_ops);
+  endtask
+
   // Load a binary
   task automatic jtag_safed_elf_preload(input string binary, output word_bt entry);
     longint sec_addr, sec_len;
@@ -506,6 +608,44 @@ module vip_safety_island_soc import safety_island_pkg::*; #(
     axi_write_beats(addr, 2, beats);
   endtask
 
+  task automatic axi_read_32(input addr_t addr, output word_bt data);
+    axi_data_t beats [$];
+    axi_read_beats(addr, 2, 0, beats);
+    data = beats[0] >> (8 * addr[AxiStrbBits-1:0]);
+  endtask
+
+  // Single-word AXI ATOP, returns the old value for atomic loads, swaps and compares
+  task automatic axi_atop_32(
+    input  addr_t          addr,
+    input  axi_pkg::atop_t atop,
+    input  word_bt         operand,
+    output word_bt         old
+  );
+    axi_ext_driver_t::ax_beat_t ax = new();
+    axi_ext_driver_t::w_beat_t  w  = new();
+    axi_ext_driver_t::b_beat_t  b;
+    axi_ext_driver_t::r_beat_t  r;
+    @(posedge clk);
+    ax.ax_addr  = addr;
+    ax.ax_id    = '0;
+    ax.ax_len   = 0;
+    ax.ax_size  = 2;
+    ax.ax_burst = axi_pkg::BURST_INCR;
+    ax.ax_atop  = atop;
+    w.w_strb    = 4'hF << addr[AxiStrbBits-1:0];
+    w.w_data    = operand << (8 * addr[AxiStrbBits-1:0]);
+    w.w_last    = 1'b1;
+    axi_ext_driver.send_aw(ax);
+    axi_ext_driver.send_w(w);
+    fork
+      axi_ext_driver.recv_b(b);
+      if (atop[axi_pkg::ATOP_R_RESP]) axi_ext_driver.recv_r(r);
+    join
+    if (b.b_resp != axi_pkg::RESP_OKAY)
+      $error("[AXI] - ATOP error response: %d!", b.b_resp);
+    old = atop[axi_pkg::ATOP_R_RESP] ? r.r_data >> (8 * addr[AxiStrbBits-1:0]) : '0;
+  endtask
+
   task automatic axi_poll_bit31(
     input doub_bt addr,
     output word_bt data,
@@ -519,6 +659,88 @@ module vip_safety_island_soc import safety_island_pkg::*; #(
     end while (~data[31]);
   endtask
 
+  // Generate concurrent AXI input traffic on the memory banks and report the achieved bandwidth.
+  // Each burst writes and reads back a scratch window at the top of a bank, cycling through all
+  // banks. Binaries running alongside must not use the top `traffic_bytes` of any bank.
+  task automatic axi_bank_traffic(
+    input int unsigned num_bursts,
+    input int unsigned traffic_bytes = 'h1000
+  );
+    int unsigned burst_beats = AxiBurstBytes/AxiStrbWidth;
+    int unsigned num_bytes   = 0;
+    realtime     t_start;
+    $display("[AXI] Bank traffic: %0d bursts over %0d banks", num_bursts, DutCfg.NumBanks);
+    t_start = $realtime;
+    for (int unsigned i = 0; i < num_bursts; i++) begin
+      axi_data_t wbeats [$];
+      axi_data_t rbeats [$];
+      addr_t addr = BaseAddr + MemOffset + (i % DutCfg.NumBanks)*DutCfg.BankNumBytes +
+                    DutCfg.BankNumBytes - traffic_bytes +
+                    ((i / DutCfg.NumBanks)*AxiBurstBytes) % traffic_bytes;
+      for (int b = 0; b < burst_beats; b++) wbeats.push_back(axi_data_t'(addr) + b);
+      axi_write_beats(addr, AxiStrbBits, wbeats);
+      axi_read_beats(addr, AxiStrbBits, burst_beats-1, rbeats);
+      if (rbeats != wbeats) $error("[AXI] Bank traffic read back mismatch at 0x%h", addr);
+      num_bytes += 2*AxiBurstBytes;
+    end
+    $display("[AXI] Bank traffic: %0d bytes in %0.0f cycles (%0.3f bytes/cycle)", num_bytes,
+             ($realtime - t_start)/ClkPeriodSys,
+             num_bytes/(($realtime - t_start)/ClkPeriodSys));
+  endtask
+
+  // Measure the AXI input bandwidth with back-to-back bursts to the memory banks. All bursts are
+  // issued without waiting for responses, so the achieved bandwidth is limited by the number of
+  // outstanding transactions the island accepts. Overwrites the memory banks.
+  task automatic axi_input_bandwidth(input int unsigned num_bursts);
+    int unsigned burst_beats = AxiBurstBytes/AxiStrbWidth;
+    int unsigned mem_bytes   = DutCfg.NumBanks*DutCfg.BankNumBytes;
+    realtime     t_start;
+    real         cycles;
+    for (int write = 1; write >= 0; write--) begin
+      t_start = $realtime;
+      fork
+        for (int unsigned i = 0; i < num_bursts; i++) begin
+          axi_ext_driver_t::ax_beat_t ax = new();
+          ax.ax_addr  = BaseAddr + MemOffset + (i*AxiBurstBytes) % mem_bytes;
+          ax.ax_id    = '0;
+          ax.ax_len   = burst_beats - 1;
+          ax.ax_size  = AxiStrbBits;
+          ax.ax_burst = axi_pkg::BURST_INCR;
+          if (write) axi_ext_driver.send_aw(ax);
+          else       axi_ext_driver.send_ar(ax);
+        end
+        if (write) begin
+          for (int unsigned i = 0; i < num_bursts*burst_beats; i++) begin
+            axi_ext_driver_t::w_beat_t w = new();
+            w.w_strb = '1;
+            w.w_data = axi_data_t'(i);
+            w.w_last = ((i % burst_beats) == burst_beats - 1);
+            axi_ext_driver.send_w(w);
+          end
+        end
+        for (int unsigned i = 0; i < num_bursts; i++) begin
+          if (write) begin
+            axi_ext_driver_t::b_beat_t b;
+            axi_ext_driver.recv_b(b);
+            if (b.b_resp != axi_pkg::RESP_OKAY)
+              $error("[AXI] - Write error response: %d!", b.b_resp);
+          end else begin
+            axi_ext_driver_t::r_beat_t r;
+            do begin
+              axi_ext_driver.recv_r(r);
+              if (r.r_resp != axi_pkg::RESP_OKAY)
+                $error("[AXI] - Read error response: %d!", r.r_resp);
+            end while (!r.r_last);
+          end
+        end
+      join
+      cycles = ($realtime - t_start)/ClkPeriodSys;
+      $display("[AXI] Input %s bandwidth: %0d bytes in %0.0f cycles (%0.3f bytes/cycle)",
+               write ? "write" : "read", num_bursts*AxiBurstBytes, cycles,
+               num_bursts*AxiBurstBytes/cycles);
+    end
+  endtask
+
   // Load a binary
   task automatic axi_elf_preload(input string binary, output word_bt entry);
     longint sec_addr, sec_len, bus_offset, write_addr;
@@ -21,6 +21,122 @@ VSIM_SUPPRESS   += -suppress vsim-3009 -suppress vsim-8683 -suppress vsim-8386
 VLOG_FLAGS      +=
 VOPT_FLAGS      += +acc
 
+# Override the number of memory banks of the testbench (e.g. SAFED_NUM_BANKS=4), also passed to
+# the software builds as ARCHI_SAFETY_ISLAND_NB_BANKS
+ifneq ($(SAFED_NUM_BANKS),)
+VOPT_FLAGS      += -G/$(SIM_TOP)/NumBanks=$(SAFED_NUM_BANKS)
+export SAFED_NUM_BANKS
+endif
+
+# Override the number of timers of the testbench (e.g. SAFED_NUM_TIMERS=3)
+ifneq ($(SAFED_NUM_TIMERS),)
+VOPT_FLAGS      += -G/$(SIM_TOP)/NumTimers=$(SAFED_NUM_TIMERS)
+endif
+
+# Enable the instruction cache of the testbench (SAFED_USE_ICACHE=1)
+ifneq ($(SAFED_USE_ICACHE),)
+VOPT_FLAGS      += -G/$(SIM_TOP)/UseICache=$(SAFED_USE_ICACHE)
+endif
+
+# Enable the posted-write buffer of the testbench (SAFED_USE_WRITE_BUFFER=1)
+ifneq ($(SAFED_USE_WRITE_BUFFER),)
+VOPT_FLAGS      += -G/$(SIM_TOP)/UseWriteBuffer=$(SAFED_USE_WRITE_BUFFER)
+endif
+
+# Enable the wide AXI input path of the testbench (SAFED_WIDE_AXI_IN=1)
+ifneq ($(SAFED_WIDE_AXI_IN),)
+VOPT_FLAGS      += -G/$(SIM_TOP)/UseWideAxiIn=$(SAFED_WIDE_AXI_IN)
+endif
+
+# Enable the store-merge buffers of the testbench (SAFED_USE_STORE_MERGE=1)
+ifneq ($(SAFED_USE_STORE_MERGE),)
+VOPT_FLAGS      += -G/$(SIM_TOP)/UseStoreMerge=$(SAFED_USE_STORE_MERGE)
+endif
+
+# Enable the SCMI mailbox of the testbench (SAFED_USE_MAILBOX=1)
+ifneq ($(SAFED_USE_MAILBOX),)
+VOPT_FLAGS      += -G/$(SIM_TOP)/UseMailbox=$(SAFED_USE_MAILBOX)
+endif
+
+# Enable the runtime split mode of the testbench's TCLS cores (SAFED_USE_SPLIT_MODE=1)
+ifneq ($(SAFED_USE_SPLIT_MODE),)
+VOPT_FLAGS      += -G/$(SIM_TOP)/UseSplitMode=$(SAFED_USE_SPLIT_MODE)
+endif
+
+# Enable the near-memory AMO units of the testbench (SAFED_USE_AMO_UNIT=1)
+ifneq ($(SAFED_USE_AMO_UNIT),)
+VOPT_FLAGS      += -G/$(SIM_TOP)/UseAmoUnit=$(SAFED_USE_AMO_UNIT)
+endif
+
+# Enable the direct core data path of the testbench (SAFED_USE_DATA_FAST_PATH=1)
+ifneq ($(SAFED_USE_DATA_FAST_PATH),)
+VOPT_FLAGS      += -G/$(SIM_TOP)/UseDataFastPath=$(SAFED_USE_DATA_FAST_PATH)
+endif
+
+# Use the register-interface timers instead of the APB timers (SAFED_USE_REG_TIMER=1)
+ifneq ($(SAFED_USE_REG_TIMER),)
+VOPT_FLAGS      += -G/$(SIM_TOP)/UseRegTimer=$(SAFED_USE_REG_TIMER)
+endif
+
+# Enable the sensor readout DMA of the testbench (SAFED_USE_SENSOR_DMA=1)
+ifneq ($(SAFED_USE_SENSOR_DMA),)
+VOPT_FLAGS      += -G/$(SIM_TOP)/UseSensorDma=$(SAFED_USE_SENSOR_DMA)
+endif
+
+# Enable the island performance monitor of the testbench (SAFED_USE_PERF_MON=1)
+ifneq ($(SAFED_USE_PERF_MON),)
+VOPT_FLAGS      += -G/$(SIM_TOP)/UsePerfMon=$(SAFED_USE_PERF_MON)
+endif
+
+# Enable the crossbar QoS arbitration of the testbench (SAFED_USE_XBAR_QOS=1)
+ifneq ($(SAFED_USE_XBAR_QOS),)
+VOPT_FLAGS      += -G/$(SIM_TOP)/UseXbarQos=$(SAFED_USE_XBAR_QOS)
+endif
+
+# Enable the interrupt latency timestamps of the testbench (SAFED_USE_IRQ_TIMESTAMP=1)
+ifneq ($(SAFED_USE_IRQ_TIMESTAMP),)
+VOPT_FLAGS      += -G/$(SIM_TOP)/UseIrqTimestamp=$(SAFED_USE_IRQ_TIMESTAMP)
+endif
+
+# Enable the memory bank initialization engines of the testbench (SAFED_USE_BANK_INIT=1)
+ifneq ($(SAFED_USE_BANK_INIT),)
+VOPT_FLAGS      += -G/$(SIM_TOP)/UseBankInit=$(SAFED_USE_BANK_INIT)
+endif
+
+# Enable the adaptive scrubbing of the testbench (SAFED_USE_SCRUB_CTRL=1)
+ifneq ($(SAFED_USE_SCRUB_CTRL),)
+VOPT_FLAGS      += -G/$(SIM_TOP)/UseScrubCtrl=$(SAFED_USE_SCRUB_CTRL)
+endif
+
+# Enable the ECC event log of the testbench (SAFED_USE_ECC_LOG=1)
+ifneq ($(SAFED_USE_ECC_LOG),)
+VOPT_FLAGS      += -G/$(SIM_TOP)/UseEccLog=$(SAFED_USE_ECC_LOG)
+endif
+
+# Enable the branch trace encoder of the testbench (SAFED_USE_TRACE=1)
+ifneq ($(SAFED_USE_TRACE),)
+VOPT_FLAGS      += -G/$(SIM_TOP)/UseTrace=$(SAFED_USE_TRACE)
+endif
+
+# Enable the time-triggered activation table of the testbench (SAFED_USE_SCHED_TABLE=1)
+ifneq ($(SAFED_USE_SCHED_TABLE),)
+VOPT_FLAGS      += -G/$(SIM_TOP)/UseSchedTable=$(SAFED_USE_SCHED_TABLE)
+endif
+
+# Enable the TCLS resynchronization assist of the testbench (SAFED_USE_TCLS_RESYNC=1)
+ifneq ($(SAFED_USE_TCLS_RESYNC),)
+VOPT_FLAGS      += -G/$(SIM_TOP)/UseTclsResync=$(SAFED_USE_TCLS_RESYNC)
+endif
+
+# Outstanding transactions of the island (SAFED_MAX_TRANS) and additional external memory
+# latency in cycles (SAFED_EXT_LATENCY) of the testbench
+ifneq ($(SAFED_MAX_TRANS),)
+VOPT_FLAGS      += -G/$(SIM_TOP)/MaxTrans=$(SAFED_MAX_TRANS)
+endif
+ifneq ($(SAFED_EXT_LATENCY),)
+VOPT_FLAGS      += -G/$(SIM_TOP)/ExtMemLatency=$(SAFED_EXT_LATENCY)
+endif
+
 .PHONY: safed_sim_all
 safed_sim_all: safed_sim_build safed_sim_opt
 
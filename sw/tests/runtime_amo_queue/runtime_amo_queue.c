@@ -0,0 +1,125 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Host-island lock-free queue benchmark.
+ *
+ * MPSC: the island and the host (+AMO_QUEUE) each enqueue NUM_OPS tagged items
+ * by taking a ticket with an AMO add on the shared tail, so both sides contend
+ * on the same word. Each item must land in exactly one slot.
+ * SPSC: the host produces NUM_OPS items into a ring and publishes them with an
+ * AMO add on the tail; the island consumes them and releases the slots with an
+ * AMO add on the head.
+ * The island reports its cycles per operation, the testbench those of the
+ * host. Compare with SAFED_USE_AMO_UNIT=0.
+ */
+
+#include "pulp.h"
+#include <stdint.h>
+#include <stdio.h>
+
+#include "amo_queue.h"
+#include "perf_mon.h"
+
+#if NUM_OPS > AMO_QUEUE_MAX_OPS
+#error "NUM_OPS exceeds the MPSC slots"
+#endif
+
+#define Q(offset) ((volatile uint32_t *)(AMO_QUEUE_BASE + (offset)))
+
+static inline uint32_t amo_add(volatile uint32_t *addr, uint32_t data) {
+    uint32_t prev;
+    asm volatile("amoadd.w %[prev], %[data], (%[addr])"
+                 : [ prev ] "=r"(prev)
+                 : [ addr ] "r"(addr), [ data ] "r"(data)
+                 : "memory");
+    return prev;
+}
+
+static uint32_t cycles(void) {
+    uintptr_t perf = ARCHI_PERF_MON_ADDR;
+    writew(PERF_MON_CTRL_ENABLE | PERF_MON_CTRL_SNAPSHOT,
+           perf + PERF_MON_CTRL_OFFSET);
+    return readw(perf + PERF_MON_CYCLES_OFFSET);
+}
+
+int main(void) {
+    unsigned int errors = 0;
+    uint32_t start, mpsc_cycles, spsc_cycles;
+    uint32_t seen_host[(NUM_OPS + 31) / 32] = {0};
+    uint32_t seen_island[(NUM_OPS + 31) / 32] = {0};
+
+    for (int i = 0; i < 2 * NUM_OPS; i++)
+        *Q(AMO_QUEUE_MPSC_SLOT_OFFSET(i)) = 0;
+    *Q(AMO_QUEUE_MPSC_TAIL_OFFSET) = 0;
+    *Q(AMO_QUEUE_MPSC_DONE_OFFSET) = 0;
+    *Q(AMO_QUEUE_SPSC_TAIL_OFFSET) = 0;
+    *Q(AMO_QUEUE_SPSC_HEAD_OFFSET) = 0;
+
+    writew(PERF_MON_CTRL_CLEAR, ARCHI_PERF_MON_ADDR + PERF_MON_CTRL_OFFSET);
+    *Q(AMO_QUEUE_READY_OFFSET) = NUM_OPS;
+
+    // MPSC enqueue, concurrent with the host
+    start = cycles();
+    for (int i = 0; i < NUM_OPS; i++) {
+        uint32_t ticket = amo_add(Q(AMO_QUEUE_MPSC_TAIL_OFFSET), 1);
+        *Q(AMO_QUEUE_MPSC_SLOT_OFFSET(ticket)) = AMO_QUEUE_TAG_ISLAND | i;
+    }
+    mpsc_cycles = cycles() - start;
+    amo_add(Q(AMO_QUEUE_MPSC_DONE_OFFSET), 1);
+
+    // Consume the MPSC queue once both producers are done
+    while (*Q(AMO_QUEUE_MPSC_DONE_OFFSET) != 2)
+        ;
+    if (*Q(AMO_QUEUE_MPSC_TAIL_OFFSET) != 2 * NUM_OPS) {
+        printf("MPSC tail: %d, expected %d\r\n", *Q(AMO_QUEUE_MPSC_TAIL_OFFSET),
+               2 * NUM_OPS);
+        errors++;
+    }
+    for (int i = 0; i < 2 * NUM_OPS; i++) {
+        uint32_t item = *Q(AMO_QUEUE_MPSC_SLOT_OFFSET(i));
+        uint32_t idx = item & 0xffff;
+        uint32_t *seen = item & AMO_QUEUE_TAG_HOST ? seen_host : seen_island;
+        if (!(item & (AMO_QUEUE_TAG_HOST | AMO_QUEUE_TAG_ISLAND)) ||
+            idx >= NUM_OPS || seen[idx / 32] & (1u << (idx % 32))) {
+            printf("MPSC slot %d: bad item 0x%x\r\n", i, item);
+            errors++;
+            continue;
+        }
+        seen[idx / 32] |= 1u << (idx % 32);
+    }
+
+    // SPSC consumer of the host's items
+    start = cycles();
+    for (uint32_t i = 0; i < NUM_OPS; i++) {
+        while (*Q(AMO_QUEUE_SPSC_TAIL_OFFSET) == i)
+            ;
+        uint32_t item = *Q(AMO_QUEUE_SPSC_RING_OFFSET(i % AMO_QUEUE_RING));
+        if (item != 7 * i + 1) {
+            printf("SPSC item %d: 0x%x\r\n", i, item);
+            errors++;
+        }
+        amo_add(Q(AMO_QUEUE_SPSC_HEAD_OFFSET), 1);
+    }
+    spsc_cycles = cycles() - start;
+
+    printf("MPSC: %d cycles per enqueue\r\n", mpsc_cycles / NUM_OPS);
+    printf("SPSC: %d cycles per item\r\n", spsc_cycles / NUM_OPS);
+    printf("Errors: %d\r\n", errors);
+
+    return errors;
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: AXI output bandwidth of the core for a given external memory
+ * latency and outstanding transaction depth.
+ *
+ * Streams reads and writes to memory behind the AXI output and reports the
+ * achieved bytes per cycle. The testbench reports the AXI input bandwidth
+ * (+AXI_BANDWIDTH=<bursts>) before the binary is loaded. Rebuild the hardware
+ * with different SAFED_MAX_TRANS and SAFED_EXT_LATENCY to sweep.
+ */
+
+#include "pulp.h"
+#include <stdint.h>
+#include <stdio.h>
+
+#include "csr.h"
+
+#define EXT_ADDR  0x20000000
+#define NUM_WORDS 1024
+
+static void report(const char *name, unsigned int cycles)
+{
+    unsigned int bytes = NUM_WORDS * 4;
+    printf("AXI output %s: %d bytes in %d cycles (%d.%03d bytes/cycle)\r\n",
+           name, bytes, cycles, bytes / cycles,
+           (bytes % cycles) * 1000 / cycles);
+}
+
+int main(void)
+{
+    volatile uint32_t *ext = (volatile uint32_t *)EXT_ADDR;
+    unsigned int errors = 0;
+    unsigned int start, cycles;
+    uint32_t sum = 0;
+
+    csr_write(CSR_MCOUNTINHIBIT, 0);
+
+    start = csr_read(CSR_MCYCLE);
+    for (int i = 0; i < NUM_WORDS; i++)
+        ext[i] = i;
+    cycles = csr_read(CSR_MCYCLE) - start;
+    report("write", cycles);
+
+    start = csr_read(CSR_MCYCLE);
+    for (int i = 0; i < NUM_WORDS; i++)
+        sum += ext[i];
+    cycles = csr_read(CSR_MCYCLE) - start;
+    report("read", cycles);
+
+    if (sum != NUM_WORDS * (NUM_WORDS - 1) / 2)
+        errors++;
+
+    printf("Errors: %d\r\n", errors);
+
+    return errors;
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Core memory bandwidth under concurrent AXI input traffic.
+ *
+ * The testbench (+AXI_TRAFFIC=<bursts>) streams bursts round-robin over the
+ * top of all memory banks while the core copies a buffer. Passes overlapping
+ * with the AXI traffic only slow down when both hit the same bank, so the
+ * slowdown shrinks with a growing SAFED_NUM_BANKS. `make bank-sweep` runs
+ * the test with 2, 4 and 8 banks and collects the average cycles per pass and
+ * the AXI bandwidth printed by the testbench, and fails unless the average
+ * shrinks with each step.
+ *
+ * The fastest pass bounds the uncontended copy. A conflict on a bank costs
+ * the core at most one cycle of round-robin arbitration, and the AXI traffic
+ * is at the bank of a given core access for about 1/SAFED_NUM_BANKS of the
+ * time, so with src and dst each contended, the slowest pass may not take
+ * more than 1 + 2/SAFED_NUM_BANKS times the fastest one.
+ */
+
+#include "pulp.h"
+#include <stdint.h>
+#include <stdio.h>
+
+#include "csr.h"
+#include "mem_banks.h"
+
+#define BUF_WORDS  1024
+#define NUM_PASSES 32
+
+static uint32_t src[BUF_WORDS];
+static uint32_t dst[BUF_WORDS];
+
+int main(void) {
+    unsigned int errors = 0;
+    unsigned int cycles[NUM_PASSES];
+    unsigned int total = 0;
+    unsigned int min = ~0u, max = 0;
+
+    printf("Banks: %d, src in bank %d, dst in bank %d\r\n", SAFED_NUM_BANKS,
+           (int)SAFED_ADDR_TO_BANK((uintptr_t)src),
+           (int)SAFED_ADDR_TO_BANK((uintptr_t)dst));
+
+    for (int i = 0; i < BUF_WORDS; i++)
+        src[i] = i;
+
+    csr_write(CSR_MCOUNTINHIBIT, 0);
+
+    for (int pass = 0; pass < NUM_PASSES; pass++) {
+        unsigned int start = csr_read(CSR_MCYCLE);
+        for (int i = 0; i < BUF_WORDS; i++)
+            dst[i] = src[i] + pass;
+        cycles[pass] = csr_read(CSR_MCYCLE) - start;
+    }
+
+    for (int i = 0; i < BUF_WORDS; i++) {
+        if (dst[i] != i + NUM_PASSES - 1)
+            errors++;
+    }
+
+    // Print after the measurement to not disturb it with stdout traffic
+    for (int pass = 0; pass < NUM_PASSES; pass++) {
+        printf("Pass %2d: %d cycles (%d bytes)\r\n", pass, cycles[pass],
+               2 * BUF_WORDS * 4);
+        total += cycles[pass];
+        if (cycles[pass] < min)
+            min = cycles[pass];
+        if (cycles[pass] > max)
+            max = cycles[pass];
+    }
+    printf("Banks: %d, average: %d cycles per pass\r\n", SAFED_NUM_BANKS,
+           total / NUM_PASSES);
+    printf("Banks: %d, slowdown: %d%% (%d to %d cycles)\r\n", SAFED_NUM_BANKS,
+           100 * (max - min) / min, min, max);
+
+    if (max * SAFED_NUM_BANKS > min * (SAFED_NUM_BANKS + 2)) {
+        printf("ERROR! Slowdown above the bound of %d%%\r\n",
+               200 / SAFED_NUM_BANKS);
+        errors++;
+    }
+
+    printf("Errors: %d\r\n", errors);
+
+    return errors;
+}
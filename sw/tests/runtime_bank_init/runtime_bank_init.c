@@ -0,0 +1,85 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Memory bank initialization after reset against a software
+ * loop.
+ *
+ * The banks are initialized by the hardware after reset, so memory that was
+ * never written reads as zero. The cycles of that initialization are compared
+ * with a software loop zeroing a buffer, projected to a full bank.
+ */
+
+#include "pulp.h"
+#include <stdint.h>
+#include <stdio.h>
+
+#include "csr.h"
+#include "io.h"
+#include "bank_init.h"
+#include "mem_banks.h"
+
+#define BUF_WORDS  2048
+#define BANK_WORDS (SAFED_BANK_SIZE / 4)
+
+int main(void)
+{
+    unsigned int errors = 0;
+    uint32_t *buf = pi_l2_malloc(BUF_WORDS * 4);
+    unsigned int hw, sw, start;
+
+    csr_write(CSR_MCOUNTINHIBIT, 0);
+
+    if (readw(ARCHI_BANK_INIT_ADDR + BANK_INIT_BUSY_OFFSET)) {
+        printf("Banks still busy after boot\r\n");
+        errors++;
+    }
+
+    hw = readw(ARCHI_BANK_INIT_ADDR + BANK_INIT_CYCLES_OFFSET);
+    if (hw < BANK_WORDS || hw > BANK_WORDS + BANK_WORDS / 16) {
+        printf("Initialization took %d cycles for %d words\r\n", hw,
+               BANK_WORDS);
+        errors++;
+    }
+
+    /* Never written since reset, except for the allocator's chunk header */
+    for (int i = 4; i < BUF_WORDS; i++) {
+        if (buf[i] != 0) {
+            printf("Word %d not zero: 0x%x\r\n", i, buf[i]);
+            errors++;
+            break;
+        }
+    }
+
+    start = csr_read(CSR_MCYCLE);
+    for (int i = 0; i < BUF_WORDS; i++)
+        writew(0, (uintptr_t)&buf[i]);
+    sw = (csr_read(CSR_MCYCLE) - start) * (BANK_WORDS / BUF_WORDS);
+
+    printf("Bank of %d words: %d cycles in hardware, %d in software\r\n",
+           BANK_WORDS, hw, sw);
+    if (hw >= sw) {
+        printf("Hardware initialization not faster than software\r\n");
+        errors++;
+    }
+
+    pi_l2_free(buf, BUF_WORDS * 4);
+
+    printf("Errors: %d\r\n", errors);
+
+    return errors;
+}
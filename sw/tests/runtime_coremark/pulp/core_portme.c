@@ -19,6 +19,21 @@ Original Author: Shay Gal-on
 #include <stdio.h>
 #include <stdlib.h>
 #include "coremark.h"
+#ifdef STORE_MERGE_STATS
+#include "pulp.h"
+#include "mem_banks.h"
+#include "store_merge.h"
+#endif
+#ifdef SCRUB_STATS
+#include "pulp.h"
+#include "mem_banks.h"
+#include "scrub_ctrl.h"
+#endif
+#ifdef PERF_STATS
+#include "perf.h"
+/* Core events of the timed iterations */
+static struct perf_region perf_region;
+#endif
 #if CALLGRIND_RUN
 #include <valgrind/callgrind.h>
 #endif
@@ -203,9 +218,15 @@ time_in_secs(CORE_TICKS ticks)
 
 void start_time(void) {
     bench_start_time();
+#ifdef PERF_STATS
+    perf_start(&perf_region);
+#endif
 }
 
 void stop_time(void) {
+#ifdef PERF_STATS
+    perf_stop(&perf_region);
+#endif
     bench_stop_time();
 }
 
@@ -269,6 +290,26 @@ portable_init(core_portable *p, int *argc, char *argv[])
     }
 #endif /* sample of potential platform specific init via command line, reset \
           the number of contexts being used if first argument is M<n>*/
+#ifdef SCRUB_STATS
+    /* Scrub as fast as possible: in every idle bank cycle with the adaptive
+     * policy, or every 2 cycles with the ECC manager's fixed interval */
+    for (int bank = 0; bank < SAFED_NUM_BANKS; bank++)
+    {
+        pulp_write32(SAFED_ECC_MGR_BANK_ADDR(bank)
+                         + SAFED_ECC_MGR_SCRUB_INTERVAL_OFFSET,
+                     SCRUB_STATS == 1 ? 0 : 2);
+        pulp_write32(ARCHI_SCRUB_CTRL_ADDR + SCRUB_CTRL_BANK_OFFSET(bank)
+                         + SCRUB_CTRL_STALLS_OFFSET,
+                     0);
+    }
+    pulp_write32(ARCHI_SCRUB_CTRL_ADDR + SCRUB_CTRL_MIN_INTERVAL_OFFSET, 0);
+    pulp_write32(ARCHI_SCRUB_CTRL_ADDR + SCRUB_CTRL_MAX_INTERVAL_OFFSET, 0);
+    pulp_write32(ARCHI_SCRUB_CTRL_ADDR + SCRUB_CTRL_CTRL_OFFSET,
+                 SCRUB_STATS == 1 ? SCRUB_CTRL_CTRL_ENABLE : 0);
+#endif
+#ifdef PERF_STATS
+    perf_setup(&perf_region, NULL, SAFED_NUM_MHPM_COUNTERS);
+#endif
     p->portable_id = 1;
 }
 /* Function: portable_fini
@@ -277,6 +318,42 @@ portable_init(core_portable *p, int *argc, char *argv[])
 void
 portable_fini(core_portable *p)
 {
+#ifdef STORE_MERGE_STATS
+    for (int bank = 0; bank < SAFED_NUM_BANKS; bank++)
+    {
+        ee_printf("Store merge bank %d: %lu hits, %lu misses\n", bank,
+                  (unsigned long)pulp_read32(ARCHI_STORE_MERGE_ADDR
+                                             + STORE_MERGE_HITS_OFFSET(bank)),
+                  (unsigned long)pulp_read32(ARCHI_STORE_MERGE_ADDR
+                                             + STORE_MERGE_MISSES_OFFSET(bank)));
+    }
+#endif
+#ifdef SCRUB_STATS
+    for (int bank = 0; bank < SAFED_NUM_BANKS; bank++)
+    {
+        ee_u32 base = ARCHI_SCRUB_CTRL_ADDR + SCRUB_CTRL_BANK_OFFSET(bank);
+        ee_u32 stalls = pulp_read32(base + SCRUB_CTRL_STALLS_OFFSET);
+        ee_u32 sweeps = pulp_read32(base + SCRUB_CTRL_SWEEPS_OFFSET);
+        ee_printf("Scrub bank %d: %lu sweeps, last in %lu cycles, %lu stall "
+                  "cycles\n",
+                  bank,
+                  (unsigned long)sweeps,
+                  (unsigned long)pulp_read32(base
+                                             + SCRUB_CTRL_SWEEP_CYCLES_OFFSET),
+                  (unsigned long)stalls);
+        /* The adaptive policy never triggers a scrub next to a request, so
+         * each scrub can only stall the cycles after its trigger */
+        if (SCRUB_STATS == 1
+            && stalls > (SCRUB_CTRL_SCRUB_CYCLES - 1) * (sweeps + 1)
+                            * (SAFED_BANK_SIZE / 4))
+            ee_printf("ERROR! Adaptive scrubbing stalled bank %d in a "
+                      "trigger cycle\n",
+                      bank);
+    }
+#endif
+#ifdef PERF_STATS
+    perf_print(&perf_region, "Coremark");
+#endif
     p->portable_id = 0;
 }
 
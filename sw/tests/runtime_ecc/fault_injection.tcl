@@ -14,12 +14,12 @@ when {$now == 700000ns} {
   echo "Flipping!"
   set bitflippaddr 2048
   set indent [expr int(floor(rand()*39))]
-  set current_value [examine /tb_safety_island_preloaded/fixt_safety_island/i_dut/i_safety_island_top/gen_sram_bank(0)/i_mem_bank/i_bank/sram($bitflippaddr)($indent)]
+  set current_value [examine /tb_safety_island_preloaded/fixt_safety_island/i_dut/i_safety_island_top/gen_sram_bank(0)/gen_bank/i_mem_bank/i_bank/sram($bitflippaddr)($indent)]
   if {$current_value == "1'h0"} {
-    force -deposit /tb_safety_island_preloaded/fixt_safety_island/i_dut/i_safety_island_top/gen_sram_bank(0)/i_mem_bank/i_bank/sram($bitflippaddr)($indent) 1
+    force -deposit /tb_safety_island_preloaded/fixt_safety_island/i_dut/i_safety_island_top/gen_sram_bank(0)/gen_bank/i_mem_bank/i_bank/sram($bitflippaddr)($indent) 1
   }
   if {$current_value == "1'h1"} {
-    force -deposit /tb_safety_island_preloaded/fixt_safety_island/i_dut/i_safety_island_top/gen_sram_bank(0)/i_mem_bank/i_bank/sram($bitflippaddr)($indent) 0
+    force -deposit /tb_safety_island_preloaded/fixt_safety_island/i_dut/i_safety_island_top/gen_sram_bank(0)/gen_bank/i_mem_bank/i_bank/sram($bitflippaddr)($indent) 0
   }
 
 }
@@ -30,19 +30,19 @@ when {$now == 3200000ns} {
   set bitflippaddr 2048
   set indent [expr int(floor(rand()*39))]
   set indent2 [expr (int(floor(rand()*39))+1)%39]
-  set current_value [examine /tb_safety_island_preloaded/fixt_safety_island/i_dut/i_safety_island_top/gen_sram_bank(0)/i_mem_bank/i_bank/sram($bitflippaddr)($indent)]
+  set current_value [examine /tb_safety_island_preloaded/fixt_safety_island/i_dut/i_safety_island_top/gen_sram_bank(0)/gen_bank/i_mem_bank/i_bank/sram($bitflippaddr)($indent)]
   if {$current_value == "1'h0"} {
-    force -deposit /tb_safety_island_preloaded/fixt_safety_island/i_dut/i_safety_island_top/gen_sram_bank(0)/i_mem_bank/i_bank/sram($bitflippaddr)($indent) 1
+    force -deposit /tb_safety_island_preloaded/fixt_safety_island/i_dut/i_safety_island_top/gen_sram_bank(0)/gen_bank/i_mem_bank/i_bank/sram($bitflippaddr)($indent) 1
   }
   if {$current_value == "1'h1"} {
-    force -deposit /tb_safety_island_preloaded/fixt_safety_island/i_dut/i_safety_island_top/gen_sram_bank(0)/i_mem_bank/i_bank/sram($bitflippaddr)($indent) 0
+    force -deposit /tb_safety_island_preloaded/fixt_safety_island/i_dut/i_safety_island_top/gen_sram_bank(0)/gen_bank/i_mem_bank/i_bank/sram($bitflippaddr)($indent) 0
   }
-  set current_value [examine /tb_safety_island_preloaded/fixt_safety_island/i_dut/i_safety_island_top/gen_sram_bank(0)/i_mem_bank/i_bank/sram($bitflippaddr)($indent2)]
+  set current_value [examine /tb_safety_island_preloaded/fixt_safety_island/i_dut/i_safety_island_top/gen_sram_bank(0)/gen_bank/i_mem_bank/i_bank/sram($bitflippaddr)($indent2)]
   if {$current_value == "1'h0"} {
-    force -deposit /tb_safety_island_preloaded/fixt_safety_island/i_dut/i_safety_island_top/gen_sram_bank(0)/i_mem_bank/i_bank/sram($bitflippaddr)($indent2) 1
+    force -deposit /tb_safety_island_preloaded/fixt_safety_island/i_dut/i_safety_island_top/gen_sram_bank(0)/gen_bank/i_mem_bank/i_bank/sram($bitflippaddr)($indent2) 1
   }
   if {$current_value == "1'h1"} {
-    force -deposit /tb_safety_island_preloaded/fixt_safety_island/i_dut/i_safety_island_top/gen_sram_bank(0)/i_mem_bank/i_bank/sram($bitflippaddr)($indent2) 0
+    force -deposit /tb_safety_island_preloaded/fixt_safety_island/i_dut/i_safety_island_top/gen_sram_bank(0)/gen_bank/i_mem_bank/i_bank/sram($bitflippaddr)($indent2) 0
   }
 
 }
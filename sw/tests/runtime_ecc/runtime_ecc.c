@@ -22,13 +22,40 @@
 #include <stdlib.h>
 
 #include "ECC.h"
+#include "csr.h"
+#include "clicint.h"
+#include "mem_banks.h"
+#if USE_ECC_LOG
+#include "ecc_log.h"
+#endif
 
 #define BITFLIPADDR ARCHI_SAFETY_ISLAND_BASE_ADDR+0x2000
 #define ARRAY_SIZE 0x8000
 
+#if USE_ECC_LOG
+static int ecc_log_irq_pending(void) {
+    uintptr_t clicint = csr_read(CSR_MCLICBASE) + CLICINT_CLICINT_REG_OFFSET(ECC_LOG_IRQ);
+    return (readw(clicint) >> CLICINT_CLICINT_IP_BIT) & 1;
+}
+
+static int check_entry(struct ecc_log_entry *e, uint32_t flags, uint32_t addr) {
+    uint32_t bank = SAFED_ADDR_TO_BANK(BITFLIPADDR);
+    if ((e->info & ~0xFF) != (ECC_LOG_ENTRY_VALID | flags) || ECC_LOG_ENTRY_BANK(e->info) != bank
+        || e->addr != addr) {
+        printf("ECC log entry not correct: %x %x\r\n", e->info, e->addr);
+        return 1;
+    }
+    return 0;
+}
+#endif
+
 int main(void) {
     unsigned int errors = 0;
     unsigned int test_value = 0;
+#if USE_ECC_LOG
+    struct ecc_log_entry log[SAFED_ECC_LOG_DEPTH];
+    uint32_t flip_offset = BITFLIPADDR - SAFED_BANK_ADDR(SAFED_ADDR_TO_BANK(BITFLIPADDR));
+#endif
 
     // Get large enough memory space (that isn't used for other stuff)
     unsigned int *mem_array = pi_l2_malloc(ARRAY_SIZE);
@@ -44,6 +71,15 @@ int main(void) {
     }
     test_value = pulp_read32(BITFLIPADDR);
 
+#if USE_ECC_LOG
+    // Interrupt on the first corrected error and on uncorrectable errors, only the pending bit
+    // (level-triggered) is checked
+    writew(0, csr_read(CSR_MCLICBASE) + CLICINT_CLICINT_REG_OFFSET(ECC_LOG_IRQ));
+    pulp_write32(ARCHI_ECC_LOG_ADDR+ECC_LOG_THRESHOLD_OFFSET, 1);
+    pulp_write32(ARCHI_ECC_LOG_ADDR+ECC_LOG_CTRL_OFFSET,
+                 ECC_LOG_CTRL_THRESHOLD_IRQ | ECC_LOG_CTRL_UNCORRECTABLE_IRQ);
+#endif
+
     // wait for bit flip (external script!)
     for (int i = 0; i < 10000; i++) {
         asm volatile ("nop");
@@ -54,15 +90,32 @@ int main(void) {
         printf("Test Value no longer matches after flip!");
         errors += 1;
     }
-    // Check flip count status register
-    unsigned int ecc_errors = pulp_read32(ARCHI_ECC_MGR_ADDR+ECC_MANAGER_MISMATCH_COUNT_REG_OFFSET); // + (0x20*BankId)
-    if (ecc_errors != 1) {
-        printf("ECC error count not correct!\r\n");
+    // Check flip count status register, only the flipped bank may count
+    for (int bank = 0; bank < SAFED_NUM_BANKS; bank++) {
+        unsigned int ecc_errors = pulp_read32(SAFED_ECC_MGR_BANK_ADDR(bank)+ECC_MANAGER_MISMATCH_COUNT_REG_OFFSET);
+        if (ecc_errors != (bank == SAFED_ADDR_TO_BANK(BITFLIPADDR) ? 1 : 0)) {
+            printf("ECC error count of bank %d not correct: %d\r\n", bank, ecc_errors);
+            errors += 1;
+        }
+    }
+
+#if USE_ECC_LOG
+    // The corrected error raised the threshold interrupt, clearing the count lowers it again
+    if (!ecc_log_irq_pending()) {
+        printf("ECC log interrupt not pending after corrected error\r\n");
+        errors += 1;
+    }
+    pulp_write32(ARCHI_ECC_LOG_ADDR+ECC_LOG_CORRECTED_OFFSET, 0);
+    if (ecc_log_irq_pending()) {
+        printf("ECC log interrupt still pending after clearing the count\r\n");
         errors += 1;
     }
+#endif
 
     // enable scrubber
-    pulp_write32(ARCHI_ECC_MGR_ADDR+ECC_MANAGER_SCRUB_INTERVAL_REG_OFFSET, 2);
+    for (int bank = 0; bank < SAFED_NUM_BANKS; bank++) {
+        pulp_write32(SAFED_ECC_MGR_BANK_ADDR(bank)+ECC_MANAGER_SCRUB_INTERVAL_REG_OFFSET, 2);
+    }
 
     // wait for scrubber (2*bank_size+margin cycles)
     for (int i = 0; i < 40000; i++) {
@@ -70,14 +123,18 @@ int main(void) {
     }
 
     // check scrubber fixed (scrub corrected count, read value and ensure not correction not needed)
-    unsigned int scrub_fix_count = pulp_read32(ARCHI_ECC_MGR_ADDR+ECC_MANAGER_SCRUB_FIX_COUNT_REG_OFFSET);
-    if (scrub_fix_count != 1) {
-        printf("Scrub fix count not correct: %d\r\n", scrub_fix_count);
-        errors += 1;
+    for (int bank = 0; bank < SAFED_NUM_BANKS; bank++) {
+        unsigned int scrub_fix_count = pulp_read32(SAFED_ECC_MGR_BANK_ADDR(bank)+ECC_MANAGER_SCRUB_FIX_COUNT_REG_OFFSET);
+        if (scrub_fix_count != (bank == SAFED_ADDR_TO_BANK(BITFLIPADDR) ? 1 : 0)) {
+            printf("Scrub fix count of bank %d not correct: %d\r\n", bank, scrub_fix_count);
+            errors += 1;
+        }
     }
 
     // disable scrubber
-    pulp_write32(ARCHI_ECC_MGR_ADDR+ECC_MANAGER_SCRUB_INTERVAL_REG_OFFSET, 0);
+    for (int bank = 0; bank < SAFED_NUM_BANKS; bank++) {
+        pulp_write32(SAFED_ECC_MGR_BANK_ADDR(bank)+ECC_MANAGER_SCRUB_INTERVAL_REG_OFFSET, 0);
+    }
 
     // wait for double bit flip (external script!)
     for (int i = 0; i < 10000; i++) {
@@ -103,6 +160,34 @@ int main(void) {
         errors += 1;
     }
 
+#if USE_ECC_LOG
+    // The log holds the corrected access, the scrubber fix and the uncorrectable access in order
+    if (!ecc_log_irq_pending()) {
+        printf("ECC log interrupt not pending after uncorrectable error\r\n");
+        errors += 1;
+    }
+    int num_entries = ecc_log_drain(log, SAFED_ECC_LOG_DEPTH);
+    if (num_entries != 3) {
+        printf("ECC log holds %d entries instead of 3\r\n", num_entries);
+        errors += 1;
+    } else {
+        errors += check_entry(&log[0], 0, flip_offset);
+        errors += check_entry(&log[1], ECC_LOG_ENTRY_SCRUB, 0);
+        errors += check_entry(&log[2], ECC_LOG_ENTRY_UNCORRECTABLE, flip_offset);
+        if (log[1].time <= log[0].time || log[2].time <= log[1].time) {
+            printf("ECC log timestamps not increasing\r\n");
+            errors += 1;
+        }
+    }
+    pulp_write32(ARCHI_ECC_LOG_ADDR+ECC_LOG_CORRECTED_OFFSET, 0);
+    pulp_write32(ARCHI_ECC_LOG_ADDR+ECC_LOG_STATUS_OFFSET,
+                 ECC_LOG_STATUS_OVERFLOW | ECC_LOG_STATUS_UNCORRECTABLE);
+    if (ecc_log_irq_pending()) {
+        printf("ECC log interrupt still pending after clearing the status\r\n");
+        errors += 1;
+    }
+#endif
+
     pi_l2_free(mem_array, ARRAY_SIZE);
     printf("Errors: %d\r\n", errors);
 
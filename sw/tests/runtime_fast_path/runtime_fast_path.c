@@ -0,0 +1,100 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Cycles per core access to the timer and the CLIC.
+ *
+ * Reads the timer counter and a CLIC register, and updates the threshold of a
+ * CLIC line as a control loop would, NUM_ACCESSES times each. The SoC control
+ * registers always take the crossbar and the peripheral tree and serve as the
+ * reference: with USE_DATA_FAST_PATH, the direct accesses have to be faster
+ * and the cycles saved per access are reported.
+ */
+
+#include "pulp.h"
+#include <stdint.h>
+#include <stdio.h>
+
+#include "csr.h"
+#include "io.h"
+#include "clic.h"
+#include "clicint.h"
+#include "timer.h"
+
+#define NUM_ACCESSES 64
+
+#ifndef USE_DATA_FAST_PATH
+#define USE_DATA_FAST_PATH 0
+#endif
+
+static unsigned int read_cycles(uintptr_t addr)
+{
+    unsigned int start = csr_read(CSR_MCYCLE);
+    for (int i = 0; i < NUM_ACCESSES; i++)
+        (void)readw(addr);
+    return (csr_read(CSR_MCYCLE) - start) / NUM_ACCESSES;
+}
+
+/* Read-modify-write, an even number of times */
+static unsigned int update_cycles(uintptr_t addr, uint32_t toggle)
+{
+    unsigned int start = csr_read(CSR_MCYCLE);
+    for (int i = 0; i < NUM_ACCESSES; i++)
+        writew(readw(addr) ^ toggle, addr);
+    return (csr_read(CSR_MCYCLE) - start) / NUM_ACCESSES;
+}
+
+static void report(const char *name, unsigned int cycles, unsigned int ref)
+{
+    printf("%s: %d cycles per access, %d saved\r\n", name, cycles,
+           cycles < ref ? ref - cycles : 0);
+}
+
+int main(void)
+{
+    unsigned int errors = 0;
+    uintptr_t mclicbase = csr_read(CSR_MCLICBASE);
+    uintptr_t clicint = mclicbase + CLICINT_CLICINT_REG_OFFSET(40);
+    unsigned int soc_ctrl, timer, clic, clic_update, soc_ctrl_update;
+
+    csr_write(CSR_MCOUNTINHIBIT, 0);
+
+    /* Reference: read and write back the boot address */
+    soc_ctrl = read_cycles(ARCHI_SOC_CTRL_ADDR);
+    soc_ctrl_update = update_cycles(ARCHI_SOC_CTRL_ADDR, 0);
+
+    timer = read_cycles(SAFED_TIMER_ADDR(0) + TIMER_CNT_LO_OFFSET);
+    clic = read_cycles(mclicbase + MCLIC_MCLICCFG_REG_OFFSET);
+    /* Line 40 is an input interrupt that stays disabled */
+    clic_update = update_cycles(clicint, 0x1 << CLICINT_CLICINT_CTL_OFFSET);
+
+    printf("SoC control: %d cycles per read, %d per update\r\n", soc_ctrl,
+           soc_ctrl_update);
+    report("Timer read", timer, soc_ctrl);
+    report("CLIC read", clic, soc_ctrl);
+    report("CLIC update", clic_update, soc_ctrl_update);
+
+    if (USE_DATA_FAST_PATH &&
+        (clic >= soc_ctrl || clic_update >= soc_ctrl_update)) {
+        printf("Direct path not faster than the peripheral tree\r\n");
+        errors++;
+    }
+
+    printf("Errors: %d\r\n", errors);
+
+    return errors;
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Interrupt lines to the host.
+ *
+ * Raises NUM_IRQS interrupts towards the host, cycling through the lines.
+ * The testbench waits for each line and acknowledges it through the clear
+ * register; the island polls its own status register and prints the
+ * round-trip time. Needs tb_safety_island_preloaded.
+ */
+
+#include "pulp.h"
+#include <stdint.h>
+#include <stdio.h>
+
+#include "csr.h"
+#include "io.h"
+
+#ifndef NUM_IRQS
+#define NUM_IRQS 8
+#endif
+
+#ifndef NUM_HOST_IRQS
+#define NUM_HOST_IRQS 4
+#endif
+
+#define HOST_IRQ_TIMEOUT 100000
+
+int main(void)
+{
+    unsigned int errors = 0;
+    uintptr_t soc_ctrl = ARCHI_SOC_CTRL_ADDR;
+
+    csr_write(CSR_MCOUNTINHIBIT, 0);
+
+    for (int i = 0; i < NUM_IRQS; i++) {
+        uint32_t line = 1 << (i % NUM_HOST_IRQS);
+        int timeout = HOST_IRQ_TIMEOUT;
+
+        unsigned int start = csr_read(CSR_MCYCLE);
+        writew(line, soc_ctrl + SAFETY_SOC_CTRL_HOSTIRQ_SET_REG_OFFSET);
+        if (!(readw(soc_ctrl + SAFETY_SOC_CTRL_HOSTIRQ_REG_OFFSET) & line)) {
+            printf("Line %d not raised\r\n", i % NUM_HOST_IRQS);
+            errors++;
+        }
+        while ((readw(soc_ctrl + SAFETY_SOC_CTRL_HOSTIRQ_REG_OFFSET) & line) &&
+               --timeout)
+            ;
+        unsigned int cycles = csr_read(CSR_MCYCLE) - start;
+
+        if (!timeout) {
+            printf("Line %d not acknowledged\r\n", i % NUM_HOST_IRQS);
+            writew(line, soc_ctrl + SAFETY_SOC_CTRL_HOSTIRQ_CLR_REG_OFFSET);
+            errors++;
+        } else {
+            printf("Line %d acknowledged after %d cycles\r\n",
+                   i % NUM_HOST_IRQS, cycles);
+        }
+    }
+
+    return errors;
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Fetches of the last word of cached lines.
+ *
+ * NUM_LINES lines of code are generated in external memory: every word adds
+ * a distinct value to a0, the last word of each line a larger one, and a ret
+ * follows. The code is entered at the last word of its first line, so the
+ * demand miss returns that word first, and run once cold (demand miss and
+ * prefetches) and once from the cache. A line installed with stale data in
+ * any beat changes the sum. Build the hardware with SAFED_USE_ICACHE=1.
+ */
+
+#include "pulp.h"
+#include <stdint.h>
+#include <stdio.h>
+
+#include "io.h"
+#include "icache.h"
+
+#define XIP_ADDR  0x20000000
+#define NUM_LINES 4
+
+/* addi a0, a0, imm */
+#define ADDI_A0_A0(imm) ((((imm) & 0xfff) << 20) | (10 << 15) | (10 << 7) | 0x13)
+#define RET             0x00008067
+
+typedef unsigned int (*kernel_fn)(unsigned int);
+
+int main(void)
+{
+    unsigned int errors = 0;
+    uintptr_t icache = ARCHI_ICACHE_ADDR;
+    volatile uint32_t *code = (volatile uint32_t *)XIP_ADDR;
+    unsigned int line_words, words, expected = 0;
+
+    line_words = ICACHE_INFO_LINE_BYTES(readw(icache + ICACHE_INFO_OFFSET)) / 4;
+    words = NUM_LINES * line_words;
+
+    /* Entry at the last word of line 0 */
+    for (unsigned int w = line_words - 1; w < words; w++) {
+        int imm = w % line_words == line_words - 1 ? 0x100 + w : w + 1;
+        code[w] = ADDI_A0_A0(imm);
+        expected += imm;
+    }
+    code[words] = RET;
+    asm volatile("fence.i" ::: "memory");
+
+    writew(ICACHE_CTRL_ENABLE | ICACHE_CTRL_PREFETCH, icache + ICACHE_CTRL_OFFSET);
+    writew(1, icache + ICACHE_INVALIDATE_OFFSET);
+    writew(0, icache + ICACHE_HITS_OFFSET);
+
+    kernel_fn fn = (kernel_fn)(XIP_ADDR + 4 * (line_words - 1));
+    for (int run = 0; run < 2; run++) {
+        unsigned int result = fn(0);
+        if (result != expected) {
+            printf("Run %d returned %x instead of %x\r\n", run, result,
+                   expected);
+            errors++;
+        }
+    }
+
+    if (readw(icache + ICACHE_HITS_OFFSET) == 0) {
+        printf("No fetch served from the cache\r\n");
+        errors++;
+    }
+
+    printf("Errors: %d\r\n", errors);
+
+    return errors;
+}
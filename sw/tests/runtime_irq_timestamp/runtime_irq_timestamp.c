@@ -0,0 +1,113 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Interrupt latency and jitter of the timer 0 compare interrupt.
+ *
+ * Timer 0 raises its compare interrupt periodically and the vectored handler in
+ * handler.S counts it. Slot 0 of the interrupt timestamps follows the CLIC
+ * line, and the test checks the latency from the rise of the line to the
+ * handshake of each of the last IRQ_TS_DEPTH samples against MAX_LATENCY.
+ */
+
+#include "pulp.h"
+#include <stdint.h>
+#include <stdio.h>
+
+#include "csr.h"
+#include "io.h"
+#include "clic.h"
+#include "clicint.h"
+#include "timer.h"
+#include "irq_timestamp.h"
+
+#define PERIOD   600
+#define NUM_IRQS 8
+
+#ifndef MAX_LATENCY
+#define MAX_LATENCY 110
+#endif
+
+void clic_setup_mtvec(void);
+void clic_setup_mtvt(void);
+
+volatile uint32_t irq_count;
+
+int main(void)
+{
+    unsigned int errors = 0;
+    uintptr_t ts = ARCHI_IRQ_TIMESTAMP_ADDR;
+    uintptr_t timer = SAFED_TIMER_ADDR(0);
+    uintptr_t clicint = csr_read(CSR_MCLICBASE) +
+                        CLICINT_CLICINT_REG_OFFSET(SAFED_TIMER_IRQ_LO(0));
+    uint32_t count, min = UINT32_MAX, max = 0;
+
+    clic_setup_mtvec();
+    clic_setup_mtvt();
+
+    /* Vectored, edge-triggered, enabled */
+    writew((0x1 << CLICINT_CLICINT_ATTR_SHV_BIT) |
+               (0x1 << CLICINT_CLICINT_ATTR_TRIG_OFFSET) |
+               (0xaa << CLICINT_CLICINT_CTL_OFFSET) |
+               (0x1 << CLICINT_CLICINT_IE_BIT),
+           clicint);
+    writew((0x4 << MCLIC_MCLICCFG_MNLBITS_OFFSET),
+           csr_read(CSR_MCLICBASE) + MCLIC_MCLICCFG_REG_OFFSET);
+    csr_write(CSR_MINTTHRESH, 0);
+    csr_read_set(CSR_MSTATUS, MIE);
+
+    writew(IRQ_TS_SEL_ENABLE | SAFED_TIMER_IRQ_LO(0), ts + IRQ_TS_SEL_OFFSET(0));
+
+    writew(PERIOD, timer + TIMER_CMP_LO_OFFSET);
+    writew(TIMER_CFG_ENABLE | TIMER_CFG_RESET | TIMER_CFG_IRQ_EN |
+               TIMER_CFG_CMP_CLR,
+           timer + TIMER_CFG_LO_OFFSET);
+
+    while (irq_count < NUM_IRQS)
+        ;
+
+    writew(0, timer + TIMER_CFG_LO_OFFSET);
+    writew(0, clicint);
+
+    count = readw(ts + IRQ_TS_COUNT_OFFSET(0));
+    if (count < NUM_IRQS) {
+        printf("Too few samples: %d of %d interrupts\r\n", count, irq_count);
+        errors++;
+    }
+
+    for (int k = 0; k < IRQ_TS_DEPTH; k++) {
+        uint32_t asserted = readw(ts + IRQ_TS_ASSERT_OFFSET(0, k));
+        uint32_t latency = readw(ts + IRQ_TS_HANDSHAKE_OFFSET(0, k)) - asserted;
+        printf("Sample %d: asserted at %d, latency %d cycles\r\n", k, asserted,
+               latency);
+        if (latency == 0 || latency > MAX_LATENCY) {
+            printf("Latency out of range\r\n");
+            errors++;
+        }
+        min = latency < min ? latency : min;
+        max = latency > max ? latency : max;
+    }
+
+    printf("Latency %d to %d cycles, jitter %d cycles, %d missed\r\n", min,
+           max, max - min, readw(ts + IRQ_TS_MISSED_OFFSET(0)));
+
+    writew(0, ts + IRQ_TS_SEL_OFFSET(0));
+
+    printf("Errors: %d\r\n", errors);
+
+    return errors;
+}
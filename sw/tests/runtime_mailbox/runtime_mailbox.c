@@ -0,0 +1,74 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: SCMI mailbox round trips.
+ *
+ * The testbench sends NUM_MSGS messages on channel 0 over the AXI input and
+ * measures the latency from its doorbell to the completion interrupt. The
+ * island waits for the doorbell through the CLIC pending bit, answers with
+ * the payload incremented by one, frees the channel and raises the completion
+ * interrupt. Needs tb_safety_island_preloaded.
+ */
+
+#include "pulp.h"
+#include <stdint.h>
+#include <stdio.h>
+
+#include "csr.h"
+#include "io.h"
+#include "clicint.h"
+#include "mailbox.h"
+
+#ifndef NUM_MSGS
+#define NUM_MSGS 16
+#endif
+
+int main(void)
+{
+    unsigned int errors = 0;
+    uintptr_t chan = MAILBOX_CHANNEL_ADDR(0);
+    uintptr_t clicint = csr_read(CSR_MCLICBASE) +
+                        CLICINT_CLICINT_REG_OFFSET(MAILBOX_IRQ);
+
+    /* Level-triggered, not enabled: only the pending bit is checked */
+    writew(0, clicint);
+
+    for (int i = 0; i < NUM_MSGS; i++) {
+        while (!(readw(clicint) & (1 << CLICINT_CLICINT_IP_BIT)))
+            ;
+
+        uint32_t header = readw(chan + SCMI_MESSAGE_HEADER_C0_REG_OFFSET);
+        uint32_t payload = readw(chan + SCMI_MESSAGE_PAYLOAD_1_C0_REG_OFFSET);
+        if (header != i) {
+            printf("Message %d: header %x\r\n", i, header);
+            errors++;
+        }
+
+        /* Read back, so the level of the doorbell is low before polling */
+        writew(0, chan + SCMI_DOORBELL_C0_REG_OFFSET);
+        (void)readw(chan + SCMI_DOORBELL_C0_REG_OFFSET);
+        writew(payload + 1, chan + SCMI_MESSAGE_PAYLOAD_1_C0_REG_OFFSET);
+        writew(1 << SCMI_CHANNEL_STATUS_C0_CHANNEL_FREE_BIT,
+               chan + SCMI_CHANNEL_STATUS_C0_REG_OFFSET);
+        writew(1 << SCMI_COMPLETION_INTERRUPT_C0_INTR_BIT,
+               chan + SCMI_COMPLETION_INTERRUPT_C0_REG_OFFSET);
+    }
+
+    printf("Answered %d messages, %d errors\r\n", NUM_MSGS, errors);
+    return errors;
+}
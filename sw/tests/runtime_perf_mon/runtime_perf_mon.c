@@ -0,0 +1,101 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Island-level performance monitor.
+ *
+ * Counts a block of loads and stores to external memory, takes a snapshot and
+ * checks the counters of the core data port and the AXI output read latency
+ * histogram against the issued accesses. The snapshot must not change while
+ * the counters keep running.
+ */
+
+#include "pulp.h"
+#include <stdint.h>
+#include <stdio.h>
+
+#include "perf_mon.h"
+
+#define EXT_BASE  0x20000000
+#define NUM_WORDS 64
+
+static inline uint32_t perf_mon_read(uint32_t offset) {
+    return pulp_read32(ARCHI_PERF_MON_ADDR + offset);
+}
+
+int main(void) {
+    volatile uint32_t *ext = (volatile uint32_t *)EXT_BASE;
+    unsigned int errors = 0;
+    uint32_t sum = 0, rd_lat = 0, wr_lat = 0, cycles;
+
+    pulp_write32(ARCHI_PERF_MON_ADDR + PERF_MON_CTRL_OFFSET,
+                 PERF_MON_CTRL_ENABLE | PERF_MON_CTRL_CLEAR);
+
+    for (int i = 0; i < NUM_WORDS; i++)
+        ext[i] = i;
+    for (int i = 0; i < NUM_WORDS; i++)
+        sum += ext[i];
+
+    pulp_write32(ARCHI_PERF_MON_ADDR + PERF_MON_CTRL_OFFSET,
+                 PERF_MON_CTRL_ENABLE | PERF_MON_CTRL_SNAPSHOT);
+
+    if (sum != NUM_WORDS * (NUM_WORDS - 1) / 2)
+        errors++;
+
+    cycles = perf_mon_read(PERF_MON_CYCLES_OFFSET);
+    if (cycles == 0 || perf_mon_read(PERF_MON_CYCLES_OFFSET) != cycles) {
+        printf("Snapshot not stable\r\n");
+        errors++;
+    }
+
+    if (perf_mon_read(PERF_MON_MGR_GNT_OFFSET(PERF_MON_MGR_CORE_DATA)) <
+        2 * NUM_WORDS) {
+        printf("Too few core data grants\r\n");
+        errors++;
+    }
+    if (perf_mon_read(PERF_MON_MGR_GNT_OFFSET(PERF_MON_MGR_CORE_INSTR)) == 0) {
+        printf("No core instruction grants\r\n");
+        errors++;
+    }
+
+    for (int i = 0; i < PERF_MON_NUM_LAT_BINS; i++) {
+        rd_lat += perf_mon_read(PERF_MON_AXI_RD_LAT_OFFSET(i));
+        wr_lat += perf_mon_read(PERF_MON_AXI_WR_LAT_OFFSET(i));
+    }
+    // Stores may be posted by the write buffer and bypass the histogram
+    if (rd_lat < NUM_WORDS) {
+        printf("Too few AXI output reads: %d\r\n", rd_lat);
+        errors++;
+    }
+
+    for (int i = 0; i < PERF_MON_NUM_MGRS; i++)
+        printf("Manager %d: %d grants, %d stall cycles\r\n", i,
+               perf_mon_read(PERF_MON_MGR_GNT_OFFSET(i)),
+               perf_mon_read(PERF_MON_MGR_STALL_OFFSET(i)));
+    for (int i = 0; i < PERF_MON_NUM_LAT_BINS; i++)
+        printf("AXI latency bin %d: %d reads, %d writes\r\n", i,
+               perf_mon_read(PERF_MON_AXI_RD_LAT_OFFSET(i)),
+               perf_mon_read(PERF_MON_AXI_WR_LAT_OFFSET(i)));
+    printf("Cycles: %d, AXI writes: %d\r\n", cycles, wr_lat);
+
+    // Stop the counters
+    pulp_write32(ARCHI_PERF_MON_ADDR + PERF_MON_CTRL_OFFSET, 0);
+
+    printf("Errors: %d\r\n", errors);
+
+    return errors;
+}
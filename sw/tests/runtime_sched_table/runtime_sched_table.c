@@ -0,0 +1,134 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Two-task time-triggered schedule on the activation table.
+ *
+ * Table 0 activates task A (line 0) every quarter of a FRAME_LEN cycle frame
+ * and task B (line 1) once per frame at offset B_OFFSET. The vectored
+ * handlers in handler.S count the activations, and task B samples the frame
+ * time at its entry. After NUM_FRAMES frames, table 1 with task B only at
+ * the frame start is loaded and switched in at a frame boundary.
+ */
+
+#include "pulp.h"
+#include <stdint.h>
+#include <stdio.h>
+
+#include "csr.h"
+#include "io.h"
+#include "clic.h"
+#include "clicint.h"
+#include "sched_table.h"
+
+#define FRAME_LEN  1000
+#define B_OFFSET   100
+#define NUM_FRAMES 4
+
+#ifndef MAX_LATENCY
+#define MAX_LATENCY 60
+#endif
+
+void clic_setup_mtvec(void);
+void clic_setup_mtvt(void);
+
+volatile uint32_t count_a, count_b, time_b;
+volatile uint32_t sched_time_addr = ARCHI_SCHED_TABLE_ADDR + SCHED_TABLE_TIME_OFFSET;
+
+static const struct sched_activation table0[] = {
+    {0, 0x1}, {B_OFFSET, 0x2}, {250, 0x1}, {500, 0x1}, {750, 0x1}};
+static const struct sched_activation table1[] = {{0, 0x2}};
+
+static void wait_frames(uint32_t n)
+{
+    uint32_t start = sched_table_read(SCHED_TABLE_FRAMES_OFFSET);
+    while (sched_table_read(SCHED_TABLE_FRAMES_OFFSET) - start < n)
+        ;
+}
+
+int main(void)
+{
+    unsigned int errors = 0;
+    uint32_t a, b, status;
+
+    clic_setup_mtvec();
+    clic_setup_mtvt();
+
+    /* Vectored, edge-triggered, enabled */
+    for (int line = 0; line < 2; line++)
+        writew((0x1 << CLICINT_CLICINT_ATTR_SHV_BIT) |
+                   (0x1 << CLICINT_CLICINT_ATTR_TRIG_OFFSET) |
+                   (0xaa << CLICINT_CLICINT_CTL_OFFSET) |
+                   (0x1 << CLICINT_CLICINT_IE_BIT),
+               csr_read(CSR_MCLICBASE) +
+                   CLICINT_CLICINT_REG_OFFSET(SCHED_TABLE_IRQ(line)));
+    writew((0x4 << MCLIC_MCLICCFG_MNLBITS_OFFSET),
+           csr_read(CSR_MCLICBASE) + MCLIC_MCLICCFG_REG_OFFSET);
+    csr_write(CSR_MINTTHRESH, 0);
+    csr_read_set(CSR_MSTATUS, MIE);
+
+    sched_table_load(0, FRAME_LEN, table0,
+                     sizeof(table0) / sizeof(table0[0]));
+    sched_table_write(SCHED_TABLE_PRESCALER_OFFSET, 0);
+    sched_table_write(SCHED_TABLE_FRAMES_OFFSET, 0);
+    sched_table_write(SCHED_TABLE_CTRL_OFFSET,
+                      SCHED_TABLE_CTRL_ENABLE | SCHED_TABLE_CTRL_TABLE(0));
+
+    wait_frames(NUM_FRAMES);
+    a = count_a;
+    b = count_b;
+    printf("Table 0: %d activations of A, %d of B in %d frames\r\n", a, b,
+           NUM_FRAMES);
+    /* The first activation of the next frame may already be taken */
+    if (a < 4 * NUM_FRAMES || a > 4 * NUM_FRAMES + 1 || b != NUM_FRAMES) {
+        printf("Unexpected activations\r\n");
+        errors++;
+    }
+    if (time_b - B_OFFSET > MAX_LATENCY) {
+        printf("Task B entered at frame time %d\r\n", time_b);
+        errors++;
+    }
+
+    /* Rewrite the inactive table and switch at the frame boundary */
+    sched_table_load(1, FRAME_LEN, table1,
+                     sizeof(table1) / sizeof(table1[0]));
+    sched_table_switch();
+    status = sched_table_read(SCHED_TABLE_STATUS_OFFSET);
+    if (SCHED_TABLE_STATUS_TABLE(status) != 1) {
+        printf("Table 1 not active: status %08x\r\n", status);
+        errors++;
+    }
+    if (sched_table_read(SCHED_TABLE_TIME_OFFSET) > FRAME_LEN / 2) {
+        printf("Switched outside the frame boundary\r\n");
+        errors++;
+    }
+
+    a = count_a;
+    b = count_b;
+    wait_frames(2);
+    sched_table_write(SCHED_TABLE_CTRL_OFFSET, 0);
+    printf("Table 1: %d activations of A, %d of B in 2 frames\r\n",
+           count_a - a, count_b - b);
+    if (count_a != a || count_b - b < 2 || count_b - b > 3) {
+        printf("Unexpected activations after the switch\r\n");
+        errors++;
+    }
+
+    printf("Errors: %d\r\n", errors);
+
+    return errors;
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Sensor readout DMA.
+ *
+ * Two descriptors copy "sensor registers" from memory behind the AXI output
+ * into a ring buffer in SRAM. The list is first started by software, then
+ * periodically by the low timer compare event. The completion interrupt is
+ * checked through the CLIC pending bit. For comparison, the cycles the core
+ * needs to read the same registers itself are printed.
+ */
+
+#include "pulp.h"
+#include <stdint.h>
+#include <stdio.h>
+
+#include "csr.h"
+#include "io.h"
+#include "clicint.h"
+#include "sensor_dma.h"
+
+#define SENSOR_ADDR 0x20000000
+#define DESC0_WORDS 8
+#define DESC1_WORDS 4
+#define SEQ_WORDS   (DESC0_WORDS + DESC1_WORDS)
+#define RING_WORDS  32
+#define TIMER_SEQS  2
+
+/* apb_timer_unit low timer */
+#define TIMER_CFG_LO_OFFSET 0x00
+#define TIMER_CMP_LO_OFFSET 0x10
+#define TIMER_CFG_ENABLE    (1 << 0)
+#define TIMER_CFG_RESET     (1 << 1)
+#define TIMER_CFG_IRQ_EN    (1 << 2)
+#define TIMER_CFG_CMP_CLR   (1 << 4)
+
+static uint32_t ring[RING_WORDS];
+
+static uint32_t sensor_value(int word) { return 0xc0de0000 + word; }
+
+int main(void)
+{
+    unsigned int errors = 0;
+    uintptr_t dma = ARCHI_SENSOR_DMA_ADDR;
+    uintptr_t clicint = csr_read(CSR_MCLICBASE) +
+                        CLICINT_CLICINT_REG_OFFSET(SENSOR_DMA_IRQ);
+    uintptr_t timer = timer_base_fc(0, 1);
+    volatile uint32_t *sensors = (volatile uint32_t *)SENSOR_ADDR;
+
+    for (int i = 0; i < DESC0_WORDS; i++)
+        sensors[i] = sensor_value(i);
+    for (int i = 0; i < DESC1_WORDS; i++)
+        sensors[0x40 + i] = sensor_value(DESC0_WORDS + i);
+
+    /* Reference: the core reads the sensors and copies them to SRAM */
+    csr_write(CSR_MCOUNTINHIBIT, 0);
+    unsigned int start = csr_read(CSR_MCYCLE);
+    for (int i = 0; i < DESC0_WORDS; i++)
+        ring[i] = sensors[i];
+    for (int i = 0; i < DESC1_WORDS; i++)
+        ring[DESC0_WORDS + i] = sensors[0x40 + i];
+    printf("Core readout: %d cycles\r\n", csr_read(CSR_MCYCLE) - start);
+
+    /* Edge-triggered, not enabled: only the pending bit is checked */
+    writew(0x1 << CLICINT_CLICINT_ATTR_TRIG_OFFSET, clicint);
+
+    writew(SENSOR_ADDR, dma + SENSOR_DMA_DESC_SRC_OFFSET(0));
+    writew(DESC0_WORDS, dma + SENSOR_DMA_DESC_LEN_OFFSET(0));
+    writew(SENSOR_ADDR + 0x100, dma + SENSOR_DMA_DESC_SRC_OFFSET(1));
+    writew(DESC1_WORDS, dma + SENSOR_DMA_DESC_LEN_OFFSET(1));
+    writew(2, dma + SENSOR_DMA_NUM_DESC_OFFSET);
+    writew((uintptr_t)ring, dma + SENSOR_DMA_RING_BASE_OFFSET);
+    writew(sizeof(ring), dma + SENSOR_DMA_RING_SIZE_OFFSET);
+    writew(0, dma + SENSOR_DMA_RING_WPTR_OFFSET);
+    for (int i = 0; i < RING_WORDS; i++)
+        ring[i] = 0;
+    writew(SENSOR_DMA_CTRL_ENABLE | SENSOR_DMA_CTRL_IRQ_EN,
+           dma + SENSOR_DMA_CTRL_OFFSET);
+
+    /* Software trigger */
+    writew(1, dma + SENSOR_DMA_TRIGGER_OFFSET);
+    while (readw(dma + SENSOR_DMA_STATUS_OFFSET) & SENSOR_DMA_STATUS_BUSY)
+        ;
+
+    if (!(readw(clicint) & (1 << CLICINT_CLICINT_IP_BIT))) {
+        printf("No completion interrupt\r\n");
+        errors++;
+    }
+    writew(0x1 << CLICINT_CLICINT_ATTR_TRIG_OFFSET, clicint);
+
+    for (int i = 0; i < SEQ_WORDS; i++) {
+        if (ring[i] != sensor_value(i)) {
+            printf("ring[%d] = %x, expected %x\r\n", i, ring[i],
+                   sensor_value(i));
+            errors++;
+        }
+    }
+
+    /* Timer trigger */
+    writew(SENSOR_DMA_CTRL_ENABLE | SENSOR_DMA_CTRL_IRQ_EN |
+               SENSOR_DMA_CTRL_TIMER_EN,
+           dma + SENSOR_DMA_CTRL_OFFSET);
+    writew(500, timer + TIMER_CMP_LO_OFFSET);
+    writew(TIMER_CFG_ENABLE | TIMER_CFG_RESET | TIMER_CFG_IRQ_EN |
+               TIMER_CFG_CMP_CLR,
+           timer + TIMER_CFG_LO_OFFSET);
+
+    while (readw(dma + SENSOR_DMA_DONE_COUNT_OFFSET) < 1 + TIMER_SEQS)
+        ;
+    writew(SENSOR_DMA_CTRL_ENABLE, dma + SENSOR_DMA_CTRL_OFFSET);
+    writew(0, timer + TIMER_CFG_LO_OFFSET);
+    while (readw(dma + SENSOR_DMA_STATUS_OFFSET) & SENSOR_DMA_STATUS_BUSY)
+        ;
+
+    unsigned int done = readw(dma + SENSOR_DMA_DONE_COUNT_OFFSET);
+    unsigned int wptr = readw(dma + SENSOR_DMA_RING_WPTR_OFFSET);
+    printf("Sequences: %d, ring write pointer: %d\r\n", done, wptr);
+    if (wptr != (done * SEQ_WORDS * 4) % sizeof(ring)) {
+        printf("Unexpected ring write pointer\r\n");
+        errors++;
+    }
+    for (unsigned int n = 0; n < done * SEQ_WORDS; n++) {
+        /* Only the words of the last pass through the ring are checked */
+        if (n + RING_WORDS < done * SEQ_WORDS)
+            continue;
+        if (ring[n % RING_WORDS] != sensor_value(n % SEQ_WORDS)) {
+            printf("ring[%d] = %x, expected %x\r\n", n % RING_WORDS,
+                   ring[n % RING_WORDS], sensor_value(n % SEQ_WORDS));
+            errors++;
+        }
+    }
+    if (readw(dma + SENSOR_DMA_STATUS_OFFSET) & SENSOR_DMA_STATUS_BUS_ERR) {
+        printf("DMA bus error\r\n");
+        errors++;
+    }
+
+    printf("Errors: %d\r\n", errors);
+
+    return errors;
+}
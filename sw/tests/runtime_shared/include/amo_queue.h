@@ -0,0 +1,46 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Lock-free queues shared between the island and the host
+ * testbench (+AMO_QUEUE, axi_amo_queue), in the top page of bank 0. The host
+ * uses AXI ATOPs, the island RISC-V AMOs on the same words.
+ */
+
+#ifndef __AMO_QUEUE_H
+#define __AMO_QUEUE_H
+
+#define AMO_QUEUE_BASE (ARCHI_LOCAL_BANK_ADDR(1) - 0x1000)
+
+// Number of operations per side, written by the island once initialized
+#define AMO_QUEUE_READY_OFFSET     0x000
+// MPSC: ticket counter and number of finished producers
+#define AMO_QUEUE_MPSC_TAIL_OFFSET 0x004
+#define AMO_QUEUE_MPSC_DONE_OFFSET 0x008
+// SPSC: host producer and island consumer counters
+#define AMO_QUEUE_SPSC_TAIL_OFFSET 0x010
+#define AMO_QUEUE_SPSC_HEAD_OFFSET 0x014
+#define AMO_QUEUE_MPSC_SLOT_OFFSET(i) (0x100 + 4 * (i))
+#define AMO_QUEUE_SPSC_RING_OFFSET(i) (0x400 + 4 * (i))
+
+#define AMO_QUEUE_MAX_OPS   96
+#define AMO_QUEUE_RING      16
+// Producer tag of the MPSC items
+#define AMO_QUEUE_TAG_HOST   0x80000000
+#define AMO_QUEUE_TAG_ISLAND 0x40000000
+
+#endif
@@ -41,6 +41,9 @@
 #define CSR_MINTTHRESH 0x347
 #define CSR_MCLICBASE  0x350
 #define CSR_MNXTICFG   0xBD0
+#define CSR_MCOUNTINHIBIT 0x320
+#define CSR_MCYCLE     0xB00
+#define CSR_MINSTRET   0xB02
 #define MIE 8
 
 #define __CSR_EXPAND(x) #x
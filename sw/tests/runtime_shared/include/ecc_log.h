@@ -0,0 +1,76 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Register map of the ECC event log (UseEccLog). Its interrupt
+ * is CLIC line ECC_LOG_IRQ, which is level-triggered. Without it, accesses
+ * respond with an error.
+ */
+
+#ifndef __ECC_LOG_H
+#define __ECC_LOG_H
+
+#include <stdint.h>
+
+#include "io.h"
+
+#define ECC_LOG_IRQ 24
+
+#define ECC_LOG_CTRL_OFFSET       0x000
+#define ECC_LOG_THRESHOLD_OFFSET  0x004
+#define ECC_LOG_STATUS_OFFSET     0x008
+#define ECC_LOG_CORRECTED_OFFSET  0x00C
+#define ECC_LOG_ENTRY_INFO_OFFSET 0x010
+#define ECC_LOG_ENTRY_ADDR_OFFSET 0x014
+#define ECC_LOG_ENTRY_TIME_OFFSET 0x018
+
+#define ECC_LOG_CTRL_THRESHOLD_IRQ     (1 << 0)
+#define ECC_LOG_CTRL_UNCORRECTABLE_IRQ (1 << 1)
+
+#define ECC_LOG_STATUS_LEVEL_MASK    0xFFFF
+#define ECC_LOG_STATUS_OVERFLOW      (1 << 16)
+#define ECC_LOG_STATUS_UNCORRECTABLE (1 << 17)
+
+#define ECC_LOG_ENTRY_VALID         (1u << 31)
+#define ECC_LOG_ENTRY_UNCORRECTABLE (1 << 30)
+#define ECC_LOG_ENTRY_SCRUB         (1 << 29)
+#define ECC_LOG_ENTRY_BANK(info)    ((info) & 0xFF)
+
+struct ecc_log_entry {
+    uint32_t info;
+    uint32_t addr; /* Byte offset in the bank, 0 for scrubber events */
+    uint32_t time;
+};
+
+/* Drain up to max entries into buf, returns the number of entries read */
+static inline int ecc_log_drain(struct ecc_log_entry *buf, int max)
+{
+    int n = 0;
+    while (n < max) {
+        uint32_t info = readw(ARCHI_ECC_LOG_ADDR + ECC_LOG_ENTRY_INFO_OFFSET);
+        if (!(info & ECC_LOG_ENTRY_VALID))
+            break;
+        buf[n].info = info;
+        buf[n].addr = readw(ARCHI_ECC_LOG_ADDR + ECC_LOG_ENTRY_ADDR_OFFSET);
+        /* Reading the timestamp removes the entry */
+        buf[n].time = readw(ARCHI_ECC_LOG_ADDR + ECC_LOG_ENTRY_TIME_OFFSET);
+        n++;
+    }
+    return n;
+}
+
+#endif
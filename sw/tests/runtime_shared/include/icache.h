@@ -0,0 +1,38 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Register map of the instruction cache for fetches from the
+ * AXI output (UseICache). Without the cache, accesses respond with an error.
+ */
+
+#ifndef __ICACHE_H
+#define __ICACHE_H
+
+#define ICACHE_CTRL_OFFSET       0x00
+#define ICACHE_INVALIDATE_OFFSET 0x04
+#define ICACHE_HITS_OFFSET       0x08
+#define ICACHE_MISSES_OFFSET     0x0C
+#define ICACHE_INFO_OFFSET       0x10
+
+#define ICACHE_CTRL_ENABLE   (1 << 0)
+#define ICACHE_CTRL_PREFETCH (1 << 1)
+
+#define ICACHE_INFO_NUM_LINES(info)  ((info) & 0xffff)
+#define ICACHE_INFO_LINE_BYTES(info) (((info) >> 16) & 0xffff)
+
+#endif
@@ -0,0 +1,47 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Register map of the interrupt latency timestamps on the
+ * core-local register bus (UseIrqTimestamp). Each slot follows one CLIC line
+ * and keeps the last IRQ_TS_DEPTH samples in a ring. Can be included from
+ * assembly.
+ */
+
+#ifndef __IRQ_TIMESTAMP_H
+#define __IRQ_TIMESTAMP_H
+
+#define IRQ_TS_CYCLES_OFFSET 0x000
+
+#define IRQ_TS_SLOT_OFFSET(slot)   (0x100 * ((slot) + 1))
+#define IRQ_TS_SEL_OFFSET(slot)    (IRQ_TS_SLOT_OFFSET(slot) + 0x000)
+#define IRQ_TS_COUNT_OFFSET(slot)  (IRQ_TS_SLOT_OFFSET(slot) + 0x004)
+#define IRQ_TS_MISSED_OFFSET(slot) (IRQ_TS_SLOT_OFFSET(slot) + 0x008)
+#define IRQ_TS_SAMPLE_OFFSET(slot, k)                                          \
+	(IRQ_TS_SLOT_OFFSET(slot) + 0x010 + 0x10 * (k))
+#define IRQ_TS_ASSERT_OFFSET(slot, k)    (IRQ_TS_SAMPLE_OFFSET(slot, k) + 0x0)
+#define IRQ_TS_HANDSHAKE_OFFSET(slot, k) (IRQ_TS_SAMPLE_OFFSET(slot, k) + 0x4)
+#define IRQ_TS_CLAIM_OFFSET(slot, k)     (IRQ_TS_SAMPLE_OFFSET(slot, k) + 0x8)
+
+#define IRQ_TS_SEL_CLAIM  (1 << 30)
+#define IRQ_TS_SEL_ENABLE (1 << 31)
+
+/* Default configuration (IrqTimestampSlots, IrqTimestampDepth) */
+#define IRQ_TS_NUM_SLOTS 2
+#define IRQ_TS_DEPTH     4
+
+#endif
@@ -0,0 +1,35 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: SCMI mailbox channels. Each channel has the register layout of
+ * scmi.h, channel c starts at MAILBOX_CHANNEL_ADDR(c). The doorbells of all
+ * channels raise CLIC line MAILBOX_IRQ, which is level-triggered.
+ */
+
+#ifndef __MAILBOX_H
+#define __MAILBOX_H
+
+#include "scmi.h"
+
+#define MAILBOX_IRQ 23
+
+#define MAILBOX_CHANNEL_BYTES 0x28
+#define MAILBOX_CHANNEL_ADDR(c) \
+    (ARCHI_MAILBOX_ADDR + MAILBOX_CHANNEL_BYTES * (c))
+
+#endif
@@ -0,0 +1,38 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Memory bank layout of the safety island, from the archi
+ * headers. The bank count (ARCHI_SAFETY_ISLAND_NB_BANKS) is passed by the
+ * test Makefiles from SAFED_NUM_BANKS and has to match the NumBanks of the
+ * simulated hardware.
+ */
+
+#ifndef __MEM_BANKS_H
+#define __MEM_BANKS_H
+
+#define SAFED_NUM_BANKS ARCHI_SAFETY_ISLAND_NB_BANKS
+#define SAFED_BANK_SIZE ARCHI_SAFETY_ISLAND_BANK_SIZE
+#define SAFED_BANK_ADDR(bank) ARCHI_LOCAL_BANK_ADDR(bank)
+#define SAFED_ADDR_TO_BANK(addr)                                               \
+	(((addr) - SAFED_BANK_ADDR(0)) / SAFED_BANK_SIZE)
+
+/* Each bank has its own ECC manager register window */
+#define SAFED_ECC_MGR_BANK_ADDR(bank) ARCHI_ECC_MGR_BANK_ADDR(bank)
+#define SAFED_ECC_MGR_SCRUB_INTERVAL_OFFSET 0x4
+
+#endif
@@ -0,0 +1,191 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Core performance counters of the CV32E40P (NumMhpmCounters).
+ *
+ * perf_setup() selects one event per counter in mhpmevent3 and up and enables
+ * all counters, perf_start() and perf_stop() sample them around a code region
+ * and perf_print() prints the events of the region with their share of the
+ * cycles. The deltas are 32 bits wide. SAFED_NUM_MHPM_COUNTERS has to match
+ * NumMhpmCounters of the simulated hardware.
+ */
+
+#ifndef __PERF_H
+#define __PERF_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "csr.h"
+
+#ifndef SAFED_NUM_MHPM_COUNTERS
+#define SAFED_NUM_MHPM_COUNTERS 6
+#endif
+
+/* Counters restored by the TCLS resynchronization handler */
+#define PERF_MAX_COUNTERS 8
+
+/* Event bits of mhpmevent */
+#define PERF_EVENT_CYCLES       0
+#define PERF_EVENT_INSTR        1
+#define PERF_EVENT_LD_STALL     2  /* Load-use hazard */
+#define PERF_EVENT_JMP_STALL    3  /* Jump register hazard */
+#define PERF_EVENT_IMISS        4  /* Cycles waiting for instruction fetches */
+#define PERF_EVENT_LD           5
+#define PERF_EVENT_ST           6
+#define PERF_EVENT_JUMP         7
+#define PERF_EVENT_BRANCH       8
+#define PERF_EVENT_BRANCH_TAKEN 9  /* Mispredicted, branches are predicted not taken */
+#define PERF_EVENT_COMP_INSTR   10
+#define PERF_EVENT_PIPE_STALL   11 /* Only with PULP_CLUSTER */
+#define PERF_EVENT_APU_TYPE     12 /* APU type conflicts */
+#define PERF_EVENT_APU_CONT     13 /* APU contention */
+#define PERF_EVENT_APU_DEP      14 /* APU dependency stalls */
+#define PERF_EVENT_APU_WB       15 /* APU write-back port conflicts */
+#define PERF_NUM_EVENTS         16
+
+static const char *const perf_event_names[PERF_NUM_EVENTS] = {
+    "cycles",   "instr", "ld_stall", "jmp_stall", "imiss",     "ld",
+    "st",       "jump",  "branch",   "br_taken",  "comp_instr", "pipe_stall",
+    "apu_type", "apu_cont", "apu_dep", "apu_wb"};
+
+/* Stalls and misses, in the order of the counters */
+static const unsigned int perf_default_events[] = {
+    PERF_EVENT_LD_STALL,     PERF_EVENT_JMP_STALL, PERF_EVENT_IMISS,
+    PERF_EVENT_BRANCH_TAKEN, PERF_EVENT_APU_CONT,  PERF_EVENT_APU_DEP,
+    PERF_EVENT_LD,           PERF_EVENT_ST};
+
+struct perf_region {
+    int num_events;
+    unsigned int events[SAFED_NUM_MHPM_COUNTERS];
+    uint32_t cycles;
+    uint32_t instret;
+    uint32_t counts[SAFED_NUM_MHPM_COUNTERS];
+};
+
+/* mhpmcounter<i+3>, the CSR number has to be a constant */
+static inline uint32_t perf_read_counter(int i)
+{
+    switch (i) {
+    case 0: return csr_read(0xB03);
+    case 1: return csr_read(0xB04);
+    case 2: return csr_read(0xB05);
+    case 3: return csr_read(0xB06);
+    case 4: return csr_read(0xB07);
+    case 5: return csr_read(0xB08);
+    case 6: return csr_read(0xB09);
+    case 7: return csr_read(0xB0A);
+    default: return 0;
+    }
+}
+
+static inline void perf_write_counter(int i, uint32_t val)
+{
+    switch (i) {
+    case 0: csr_write(0xB03, val); csr_write(0xB83, 0); break;
+    case 1: csr_write(0xB04, val); csr_write(0xB84, 0); break;
+    case 2: csr_write(0xB05, val); csr_write(0xB85, 0); break;
+    case 3: csr_write(0xB06, val); csr_write(0xB86, 0); break;
+    case 4: csr_write(0xB07, val); csr_write(0xB87, 0); break;
+    case 5: csr_write(0xB08, val); csr_write(0xB88, 0); break;
+    case 6: csr_write(0xB09, val); csr_write(0xB89, 0); break;
+    case 7: csr_write(0xB0A, val); csr_write(0xB8A, 0); break;
+    default: break;
+    }
+}
+
+/* mhpmevent<i+3> */
+static inline void perf_write_event(int i, uint32_t mask)
+{
+    switch (i) {
+    case 0: csr_write(0x323, mask); break;
+    case 1: csr_write(0x324, mask); break;
+    case 2: csr_write(0x325, mask); break;
+    case 3: csr_write(0x326, mask); break;
+    case 4: csr_write(0x327, mask); break;
+    case 5: csr_write(0x328, mask); break;
+    case 6: csr_write(0x329, mask); break;
+    case 7: csr_write(0x32A, mask); break;
+    default: break;
+    }
+}
+
+/* Select events (PERF_EVENT_*) for the first num counters, or the default
+ * stall and miss events with events NULL, clear and enable all counters */
+static inline void perf_setup(struct perf_region *r, const unsigned int *events,
+                              int num)
+{
+    if (!events)
+        events = perf_default_events;
+    if (num > SAFED_NUM_MHPM_COUNTERS)
+        num = SAFED_NUM_MHPM_COUNTERS;
+    if (num > PERF_MAX_COUNTERS)
+        num = PERF_MAX_COUNTERS;
+
+    csr_write(CSR_MCOUNTINHIBIT, 0xFFFFFFFF);
+    r->num_events = num;
+    for (int i = 0; i < num; i++) {
+        r->events[i] = events[i];
+        perf_write_event(i, 1u << events[i]);
+        perf_write_counter(i, 0);
+    }
+    csr_write(CSR_MCOUNTINHIBIT, 0);
+}
+
+static inline void perf_start(struct perf_region *r)
+{
+    for (int i = 0; i < r->num_events; i++)
+        r->counts[i] = perf_read_counter(i);
+    r->instret = csr_read(CSR_MINSTRET);
+    r->cycles = csr_read(CSR_MCYCLE);
+}
+
+static inline void perf_stop(struct perf_region *r)
+{
+    r->cycles = csr_read(CSR_MCYCLE) - r->cycles;
+    r->instret = csr_read(CSR_MINSTRET) - r->instret;
+    for (int i = 0; i < r->num_events; i++)
+        r->counts[i] = perf_read_counter(i) - r->counts[i];
+}
+
+/* Events per thousand cycles, without a 64-bit division. The counts of the
+ * selectable events do not exceed the cycles. */
+static inline uint32_t perf_permille(uint32_t count, uint32_t cycles)
+{
+    if (cycles == 0)
+        return 0;
+    if (cycles > 0xFFFFFFFF / 1000)
+        return count / (cycles / 1000);
+    return count * 1000 / cycles;
+}
+
+static inline void perf_print(const struct perf_region *r, const char *name)
+{
+    uint32_t ipc = perf_permille(r->instret, r->cycles);
+    printf("%s: %u cycles, %u instructions (IPC %u.%03u)\n", name,
+           (unsigned int)r->cycles, (unsigned int)r->instret, ipc / 1000,
+           ipc % 1000);
+    for (int i = 0; i < r->num_events; i++) {
+        uint32_t pm = perf_permille(r->counts[i], r->cycles);
+        printf("  %-10s %10u  %2u.%u%% of cycles\n",
+               perf_event_names[r->events[i]], (unsigned int)r->counts[i],
+               pm / 10, pm % 10);
+    }
+}
+
+#endif
@@ -0,0 +1,66 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Register map of the island-level performance monitor on the
+ * core-local register bus (UsePerfMon). The counter registers return the last
+ * snapshot. Without the monitor, accesses respond with an error.
+ */
+
+#ifndef __PERF_MON_H
+#define __PERF_MON_H
+
+#define PERF_MON_CTRL_OFFSET           0x000
+#define PERF_MON_CYCLES_OFFSET         0x004
+#define PERF_MON_IRQ_ACKS_OFFSET       0x008
+#define PERF_MON_IRQ_LAT_SUM_OFFSET    0x00C
+#define PERF_MON_IRQ_LAT_MAX_OFFSET    0x010
+#define PERF_MON_ECC_CORR_OFFSET       0x014
+#define PERF_MON_MGR_GNT_OFFSET(mgr)   (0x040 + 8 * (mgr))
+#define PERF_MON_MGR_STALL_OFFSET(mgr) (0x044 + 8 * (mgr))
+#define PERF_MON_BANK_CONF_OFFSET(bank) (0x080 + 4 * (bank))
+#define PERF_MON_AXI_RD_LAT_OFFSET(bin) (0x100 + 4 * (bin))
+#define PERF_MON_AXI_WR_LAT_OFFSET(bin) (0x120 + 4 * (bin))
+
+#define PERF_MON_CTRL_ENABLE   (1 << 0)
+#define PERF_MON_CTRL_CLEAR    (1 << 1)
+#define PERF_MON_CTRL_SNAPSHOT (1 << 2)
+
+// Crossbar managers; define USE_SENSOR_DMA and USE_TRACE as configured in the hardware
+#ifndef USE_SENSOR_DMA
+#define USE_SENSOR_DMA 0
+#endif
+#ifndef USE_TRACE
+#define USE_TRACE 0
+#endif
+#define PERF_MON_MGR_DEBUG       0
+#define PERF_MON_MGR_CORE_SHADOW 1
+#define PERF_MON_MGR_CORE_DATA   2
+#define PERF_MON_MGR_CORE_INSTR  3
+#define PERF_MON_MGR_AXI_INPUT   4
+// With UseSensorDma and UseTrace, following the managers above
+#define PERF_MON_MGR_SENSOR_DMA  5
+#define PERF_MON_MGR_TRACE       (5 + USE_SENSOR_DMA)
+#define PERF_MON_NUM_MGRS        (5 + USE_SENSOR_DMA + USE_TRACE)
+// With UseSplitMode, instruction and data manager of harts 1 and 2
+#define PERF_MON_MGR_SPLIT_INSTR(hart) (PERF_MON_NUM_MGRS + 2 * ((hart) - 1))
+#define PERF_MON_MGR_SPLIT_DATA(hart)  (PERF_MON_NUM_MGRS + 1 + 2 * ((hart) - 1))
+
+// Latency bins: [0,4), [4,8), ..., [128,256), >= 256 cycles
+#define PERF_MON_NUM_LAT_BINS 8
+
+#endif
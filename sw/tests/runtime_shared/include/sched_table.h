@@ -0,0 +1,92 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Register map of the time-triggered activation table
+ * (UseSchedTable). Line i of an activation mask is CLIC line
+ * SCHED_TABLE_IRQ(i). The lines pulse, so they should be configured as
+ * edge-triggered. Without the table, accesses respond with an error.
+ */
+
+#ifndef __SCHED_TABLE_H
+#define __SCHED_TABLE_H
+
+#include <stdint.h>
+
+#include "io.h"
+
+#define SCHED_TABLE_IRQ(line) (25 + (line))
+
+#define SCHED_TABLE_CTRL_OFFSET      0x000
+#define SCHED_TABLE_STATUS_OFFSET    0x004
+#define SCHED_TABLE_SWITCH_OFFSET    0x008
+#define SCHED_TABLE_PRESCALER_OFFSET 0x00C
+#define SCHED_TABLE_TIME_OFFSET      0x010
+#define SCHED_TABLE_FRAMES_OFFSET    0x014
+
+#define SCHED_TABLE_TABLE_OFFSET(t)      (0x400 * ((t) + 1))
+#define SCHED_TABLE_FRAME_LEN_OFFSET(t)  (SCHED_TABLE_TABLE_OFFSET(t) + 0x000)
+#define SCHED_TABLE_COUNT_OFFSET(t)      (SCHED_TABLE_TABLE_OFFSET(t) + 0x004)
+#define SCHED_TABLE_ENTRY_OFFSET(t, e)   (SCHED_TABLE_TABLE_OFFSET(t) + 0x100 + 8 * (e))
+#define SCHED_TABLE_OFFSET_OFFSET(t, e)  (SCHED_TABLE_ENTRY_OFFSET(t, e) + 0x0)
+#define SCHED_TABLE_MASK_OFFSET(t, e)    (SCHED_TABLE_ENTRY_OFFSET(t, e) + 0x4)
+
+#define SCHED_TABLE_CTRL_ENABLE     (1 << 0)
+#define SCHED_TABLE_CTRL_REF_CLK    (1 << 1)
+#define SCHED_TABLE_CTRL_TABLE(t)   ((t) << 2)
+
+#define SCHED_TABLE_STATUS_PENDING  (1 << 0)
+#define SCHED_TABLE_STATUS_TABLE(s) (((s) >> 1) & 0x1)
+
+struct sched_activation {
+    uint32_t offset;
+    uint32_t mask; /* Bit i raises SCHED_TABLE_IRQ(i) */
+};
+
+static inline uint32_t sched_table_read(uint32_t offset)
+{
+    return readw(ARCHI_SCHED_TABLE_ADDR + offset);
+}
+
+static inline void sched_table_write(uint32_t offset, uint32_t val)
+{
+    writew(val, ARCHI_SCHED_TABLE_ADDR + offset);
+}
+
+/* Fill table t, which must not be active, with n activations sorted by
+ * offset */
+static inline void sched_table_load(int t, uint32_t frame_len,
+                                    const struct sched_activation *act, int n)
+{
+    sched_table_write(SCHED_TABLE_FRAME_LEN_OFFSET(t), frame_len);
+    for (int e = 0; e < n; e++) {
+        sched_table_write(SCHED_TABLE_OFFSET_OFFSET(t, e), act[e].offset);
+        sched_table_write(SCHED_TABLE_MASK_OFFSET(t, e), act[e].mask);
+    }
+    sched_table_write(SCHED_TABLE_COUNT_OFFSET(t), n);
+}
+
+/* Swap to the inactive table at the next frame boundary and wait for it */
+static inline void sched_table_switch(void)
+{
+    sched_table_write(SCHED_TABLE_SWITCH_OFFSET, 1);
+    while (sched_table_read(SCHED_TABLE_STATUS_OFFSET) &
+           SCHED_TABLE_STATUS_PENDING)
+        ;
+}
+
+#endif
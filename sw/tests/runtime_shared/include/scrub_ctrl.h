@@ -0,0 +1,42 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Register map of the adaptive scrub policy (UseScrubCtrl).
+ * Without it, accesses respond with an error.
+ */
+
+#ifndef __SCRUB_CTRL_H
+#define __SCRUB_CTRL_H
+
+#define SCRUB_CTRL_CTRL_OFFSET         0x000
+#define SCRUB_CTRL_MIN_INTERVAL_OFFSET 0x004
+#define SCRUB_CTRL_MAX_INTERVAL_OFFSET 0x008
+
+#define SCRUB_CTRL_BANK_OFFSET(bank)   (0x100 + 0x20 * (bank))
+#define SCRUB_CTRL_INTERVAL_OFFSET     0x00
+#define SCRUB_CTRL_SWEEPS_OFFSET       0x04
+#define SCRUB_CTRL_SWEEP_CYCLES_OFFSET 0x08
+#define SCRUB_CTRL_SWEEP_FIXES_OFFSET  0x0C
+#define SCRUB_CTRL_STALLS_OFFSET       0x10
+
+#define SCRUB_CTRL_CTRL_ENABLE (1 << 0)
+
+/* Cycles the scrubber holds a bank after a trigger (ScrubCycles) */
+#define SCRUB_CTRL_SCRUB_CYCLES 3
+
+#endif
@@ -0,0 +1,49 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Register map of the timer-triggered sensor readout DMA. Its
+ * completion interrupt is CLIC line SENSOR_DMA_IRQ and should be configured
+ * as edge-triggered.
+ */
+
+#ifndef __SENSOR_DMA_H
+#define __SENSOR_DMA_H
+
+#define SENSOR_DMA_IRQ 22
+
+#define SENSOR_DMA_CTRL_OFFSET       0x00
+#define SENSOR_DMA_TRIGGER_OFFSET    0x04
+#define SENSOR_DMA_STATUS_OFFSET     0x08
+#define SENSOR_DMA_RING_BASE_OFFSET  0x0C
+#define SENSOR_DMA_RING_SIZE_OFFSET  0x10
+#define SENSOR_DMA_RING_WPTR_OFFSET  0x14
+#define SENSOR_DMA_NUM_DESC_OFFSET   0x18
+#define SENSOR_DMA_DONE_COUNT_OFFSET 0x1C
+#define SENSOR_DMA_DESC_SRC_OFFSET(i) (0x40 + 8 * (i))
+#define SENSOR_DMA_DESC_LEN_OFFSET(i) (0x44 + 8 * (i))
+
+#define SENSOR_DMA_CTRL_ENABLE    (1 << 0)
+#define SENSOR_DMA_CTRL_IRQ_EN    (1 << 1)
+#define SENSOR_DMA_CTRL_TIMER_EN  (1 << 2)
+#define SENSOR_DMA_CTRL_TIMER_HI  (1 << 3)
+
+#define SENSOR_DMA_STATUS_BUSY    (1 << 0)
+#define SENSOR_DMA_STATUS_BUS_ERR (1 << 1)
+#define SENSOR_DMA_STATUS_OVERRUN (1 << 2)
+
+#endif
@@ -0,0 +1,40 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Register map of the split mode control on the core-local
+ * register bus (UseSplitMode). Writing MODE restarts the three cores of the
+ * TCLS in the written mode at their BOOT_ADDR. Can be included from assembly.
+ */
+
+#ifndef __SPLIT_MODE_H
+#define __SPLIT_MODE_H
+
+#define SPLIT_CTRL_MODE_OFFSET            0x000
+#define SPLIT_CTRL_BOOT_ADDR_OFFSET(hart) (0x010 + 4 * (hart))
+#define SPLIT_CTRL_IRQ_OFFSET             0x020
+#define SPLIT_CTRL_IRQ_CLR_OFFSET         0x024
+
+#define SPLIT_CTRL_MODE_SPLIT (1 << 0)
+
+/* Bus error registers of harts 1 and 2, relative to ARCHI_SPLIT_ERR_ADDR */
+#define SPLIT_ERR_INSTR_OFFSET(hart) (0x020 * ((hart) - 1))
+#define SPLIT_ERR_DATA_OFFSET(hart)  (0x020 * ((hart) - 1) + 0x010)
+
+#define SPLIT_NUM_HARTS 3
+
+#endif
@@ -0,0 +1,33 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Register map of the store-merge buffers in front of the
+ * memory banks (UseStoreMerge). Without the buffers, accesses respond with an
+ * error.
+ */
+
+#ifndef __STORE_MERGE_H
+#define __STORE_MERGE_H
+
+#define STORE_MERGE_CTRL_OFFSET         0x00
+#define STORE_MERGE_HITS_OFFSET(bank)   (0x10 + 8 * (bank))
+#define STORE_MERGE_MISSES_OFFSET(bank) (0x14 + 8 * (bank))
+
+#define STORE_MERGE_CTRL_ENABLE (1 << 0)
+
+#endif
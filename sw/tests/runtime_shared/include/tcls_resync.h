@@ -0,0 +1,46 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Register map of the TCLS resynchronization assist on the
+ * core-local register bus (UseTclsResync). The resynchronization request is
+ * CLIC line TCLS_RESYNC_IRQ. Can be included from assembly.
+ */
+
+#ifndef __TCLS_RESYNC_H
+#define __TCLS_RESYNC_H
+
+#define TCLS_RESYNC_IRQ 21
+
+#define TCLS_RESYNC_STATUS_OFFSET      0x000
+#define TCLS_RESYNC_RESUMED_OFFSET     0x004
+#define TCLS_RESYNC_COUNT_OFFSET       0x008
+#define TCLS_RESYNC_LAST_CYCLES_OFFSET 0x00C
+#define TCLS_RESYNC_MAX_CYCLES_OFFSET  0x010
+#define TCLS_RESYNC_CORRECTED_OFFSET   0x014
+#define TCLS_RESYNC_STATE_OFFSET(i)    (0x100 + 4 * (i))
+
+#define TCLS_RESYNC_NUM_STATE_WORDS 64
+
+/* State words of the handler: x1-x31 in 1-31, then mepc, mstatus, mcause,
+ * mcountinhibit, mcycle(h) and minstret(h) in 32-39, and mhpmevent<n>,
+ * mhpmcounter<n> and mhpmcounter<n>h of the counters 3-10 in 40-63 */
+#define TCLS_RESYNC_STATE_COUNTERS(n) TCLS_RESYNC_STATE_OFFSET(40 + 3 * ((n) - 3))
+
+#define TCLS_RESYNC_STATUS_PENDING (1 << 0)
+
+#endif
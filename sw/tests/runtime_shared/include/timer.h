@@ -0,0 +1,84 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Timers of the safety island (safety_island_timer or
+ * apb_timer_unit, with the same register map). The timer count
+ * (SAFED_NUM_TIMERS), the number of input interrupts (SAFED_NUM_INTERRUPTS)
+ * and of timer event inputs (SAFED_NUM_TIMER_EVENTS) are passed by the test
+ * Makefiles and have to match the simulated hardware.
+ */
+
+#ifndef __TIMER_H
+#define __TIMER_H
+
+#ifndef SAFED_NUM_TIMERS
+#define SAFED_NUM_TIMERS 1
+#endif
+
+#ifndef SAFED_NUM_INTERRUPTS
+#define SAFED_NUM_INTERRUPTS 64
+#endif
+
+#ifndef SAFED_NUM_TIMER_EVENTS
+#define SAFED_NUM_TIMER_EVENTS 4
+#endif
+
+/* Each timer has its own register window */
+#define SAFED_TIMER_STRIDE 0x1000
+#define SAFED_TIMER_ADDR(timer)                                                \
+	(ARCHI_SAFETY_ISLAND_PERIPHERALS_ADDR + ARCHI_TIMER_OFFSET +           \
+	 (timer) * SAFED_TIMER_STRIDE)
+
+/* CLIC lines: timer 0 on 16/17, further timers after the input interrupts */
+#define SAFED_TIMER_IRQ_LO(timer)                                              \
+	((timer) == 0 ? 16 : 32 + SAFED_NUM_INTERRUPTS + 2 * ((timer) - 1))
+#define SAFED_TIMER_IRQ_HI(timer) (SAFED_TIMER_IRQ_LO(timer) + 1)
+
+#define TIMER_CFG_LO_OFFSET 0x00
+#define TIMER_CFG_HI_OFFSET 0x04
+#define TIMER_CNT_LO_OFFSET 0x08
+#define TIMER_CNT_HI_OFFSET 0x0C
+#define TIMER_CMP_LO_OFFSET 0x10
+#define TIMER_CMP_HI_OFFSET 0x14
+/* Only with UseRegTimer: reading SNAP_LO latches the hi counter in SNAP_HI */
+#define TIMER_SNAP_LO_OFFSET 0x28
+#define TIMER_SNAP_HI_OFFSET 0x2C
+/* Only with UseRegTimer: input capture per channel */
+#define TIMER_CAP_CFG_LO_OFFSET   0x30
+#define TIMER_CAP_CFG_HI_OFFSET   0x34
+#define TIMER_CAP_LO_OFFSET       0x38
+#define TIMER_CAP_HI_OFFSET       0x3C
+#define TIMER_CAP_PREV_LO_OFFSET  0x40
+#define TIMER_CAP_PREV_HI_OFFSET  0x44
+#define TIMER_CAP_COUNT_LO_OFFSET 0x48
+#define TIMER_CAP_COUNT_HI_OFFSET 0x4C
+
+#define TIMER_CFG_ENABLE  (1 << 0)
+#define TIMER_CFG_RESET   (1 << 1)
+#define TIMER_CFG_IRQ_EN  (1 << 2)
+#define TIMER_CFG_CMP_CLR (1 << 4)
+#define TIMER_CFG_64BIT   (1 << 31)
+
+#define TIMER_CAP_RISE (1 << 0)
+#define TIMER_CAP_FALL (1 << 1)
+/* Event input i, or input interrupt i after the SAFED_NUM_TIMER_EVENTS
+ * inputs */
+#define TIMER_CAP_SRC(src)      ((src) << 8)
+#define TIMER_CAP_SRC_IRQ(irq)  TIMER_CAP_SRC(SAFED_NUM_TIMER_EVENTS + (irq))
+
+#endif
@@ -0,0 +1,106 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Register map and packet format of the branch trace encoder on
+ * the core-local register bus (UseTrace). Packets are two words in the buffer,
+ * the header and the fetch address; sw/trace_decoder decodes a dump of the
+ * buffer. Without the encoder, accesses respond with an error.
+ */
+
+#ifndef __TRACE_H
+#define __TRACE_H
+
+#include <stdint.h>
+
+#include "io.h"
+
+#define TRACE_CTRL_OFFSET       0x000
+#define TRACE_STATUS_OFFSET     0x004
+#define TRACE_BUF_BASE_OFFSET   0x008
+#define TRACE_BUF_SIZE_OFFSET   0x00C
+#define TRACE_WRITE_PTR_OFFSET  0x010
+#define TRACE_START_ADDR_OFFSET 0x014
+#define TRACE_STOP_ADDR_OFFSET  0x018
+#define TRACE_DROPPED_OFFSET    0x01C
+
+#define TRACE_CTRL_ENABLE (1 << 0)
+#define TRACE_CTRL_WRAP   (1 << 1)
+
+#define TRACE_STATUS_ACTIVE  (1 << 0)
+#define TRACE_STATUS_WRAPPED (1 << 1)
+#define TRACE_STATUS_FULL    (1 << 2)
+#define TRACE_STATUS_DROPPED (1 << 3)
+#define TRACE_STATUS_ERROR   (1 << 4)
+
+/* Packet header */
+#define TRACE_PKT_BRANCH 0
+#define TRACE_PKT_IRQ    1 /* First discontinuity after taking an interrupt */
+#define TRACE_PKT_START  2
+#define TRACE_PKT_STOP   3
+
+#define TRACE_PKT_TYPE(hdr)   ((hdr) & 0x3)
+#define TRACE_PKT_SEQ(hdr)    (((hdr) >> 2) & 0x3F)
+#define TRACE_PKT_IRQ_ID(hdr) (((hdr) >> 8) & 0xFF)
+#define TRACE_PKT_CYCLES(hdr) ((hdr) >> 16)
+
+#define TRACE_PKT_WORDS 2
+
+static inline uint32_t trace_read(uint32_t offset)
+{
+    return readw(ARCHI_TRACE_ADDR + offset);
+}
+
+static inline void trace_write(uint32_t offset, uint32_t val)
+{
+    writew(val, ARCHI_TRACE_ADDR + offset);
+}
+
+/* Arm a trace into buf of size bytes (a multiple of 8) between the fetches of
+ * start and stop, 0 for the next fetch and for no stop address */
+static inline void trace_start(uint32_t *buf, uint32_t size, uintptr_t start,
+                               uintptr_t stop, int wrap)
+{
+    trace_write(TRACE_CTRL_OFFSET, 0);
+    trace_write(TRACE_BUF_BASE_OFFSET, (uint32_t)(uintptr_t)buf);
+    trace_write(TRACE_BUF_SIZE_OFFSET, size);
+    trace_write(TRACE_START_ADDR_OFFSET, start);
+    trace_write(TRACE_STOP_ADDR_OFFSET, stop);
+    trace_write(TRACE_STATUS_OFFSET,
+                TRACE_STATUS_DROPPED | TRACE_STATUS_ERROR);
+    trace_write(TRACE_DROPPED_OFFSET, 0);
+    trace_write(TRACE_CTRL_OFFSET,
+                TRACE_CTRL_ENABLE | (wrap ? TRACE_CTRL_WRAP : 0));
+}
+
+/* Stop the trace, returns the number of words written, or the buffer size in
+ * words after a wrap */
+static inline uint32_t trace_stop(void)
+{
+    uint32_t ctrl = trace_read(TRACE_CTRL_OFFSET);
+    trace_write(TRACE_CTRL_OFFSET, ctrl & ~TRACE_CTRL_ENABLE);
+    /* Wait for the stop packet to be written */
+    while (trace_read(TRACE_STATUS_OFFSET) & TRACE_STATUS_ACTIVE)
+        ;
+    for (volatile int i = 0; i < 16; i++)
+        ;
+    if (trace_read(TRACE_STATUS_OFFSET) & TRACE_STATUS_WRAPPED)
+        return trace_read(TRACE_BUF_SIZE_OFFSET) / 4;
+    return trace_read(TRACE_WRITE_PTR_OFFSET) / 4;
+}
+
+#endif
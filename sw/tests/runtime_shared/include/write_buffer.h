@@ -0,0 +1,38 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Fence for the posted-write buffer on the AXI output
+ * (UseWriteBuffer). The buffer holds back atomics until all buffered bursts
+ * have received their B response, so an atomic that leaves memory unchanged
+ * returns only once all earlier writes have landed in external memory. Issue
+ * it before signalling the host (host interrupt, mailbox completion) about
+ * data written to external memory. Without the buffer, it costs one atomic.
+ */
+
+#ifndef __WRITE_BUFFER_H
+#define __WRITE_BUFFER_H
+
+#include <stdint.h>
+
+/* `ext` is any word in external memory that supports atomics */
+static inline void write_buffer_fence(volatile uint32_t *ext)
+{
+    asm volatile("amoor.w zero, zero, (%0)" : : "r"(ext) : "memory");
+}
+
+#endif
@@ -0,0 +1,38 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Register map of the crossbar QoS stage (UseXbarQos) at
+ * ARCHI_XBAR_QOS_ADDR. Managers are indexed as PERF_MON_MGR_* in perf_mon.h.
+ * Without the QoS stage, accesses respond with an error.
+ */
+
+#ifndef __XBAR_QOS_H
+#define __XBAR_QOS_H
+
+#define XBAR_QOS_CTRL_OFFSET               0x000
+#define XBAR_QOS_WINDOW_OFFSET             0x004
+#define XBAR_QOS_MGR_CFG_OFFSET(mgr)       (0x040 + 4 * (mgr))
+#define XBAR_QOS_MGR_THROTTLED_OFFSET(mgr) (0x080 + 4 * (mgr))
+#define XBAR_QOS_MGR_MAX_WAIT_OFFSET(mgr)  (0x0C0 + 4 * (mgr))
+
+#define XBAR_QOS_CTRL_ENABLE (1 << 0)
+
+// Priority 0 (lowest) to 3, and grants per window (0: no limit)
+#define XBAR_QOS_MGR_CFG(prio, budget) (((budget) << 16) | ((prio) & 0x3))
+
+#endif
@@ -0,0 +1,150 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Parallel benchmark in split mode.
+ *
+ * The same kernel runs once in TCLS mode and once split across the three
+ * harts. For the split run, split_enter (split.S) saves the state of main and
+ * restarts the cores in split mode at split_entry. Hart 0 kicks harts 1 and 2
+ * with their software interrupt, runs its share, waits for the others and
+ * restarts the cores in TCLS mode at split_resume, which returns to main. The
+ * island's performance monitor counts the cycles of both runs, including the
+ * two restarts. Needs UseSplitMode and UsePerfMon.
+ */
+
+#include "pulp.h"
+#include <stdint.h>
+#include <stdio.h>
+
+#include "csr.h"
+#include "io.h"
+#include "perf_mon.h"
+#include "split_mode.h"
+
+#ifndef NUM_WORDS
+#define NUM_WORDS 1536
+#endif
+#define CHUNK (NUM_WORDS / SPLIT_NUM_HARTS)
+
+void split_enter(void);
+void split_resume(void);
+void split_entry(void);
+
+uint32_t split_hartid_base;
+
+static uint32_t x[NUM_WORDS];
+static uint32_t y_tcls[NUM_WORDS], y_split[NUM_WORDS];
+
+static volatile uint32_t hart_ids[SPLIT_NUM_HARTS];
+static volatile uint32_t done[SPLIT_NUM_HARTS];
+
+static void kernel(uint32_t *y, unsigned int start, unsigned int end)
+{
+    for (unsigned int i = start; i < end; i++) {
+        uint32_t v = x[i];
+        for (int r = 0; r < 8; r++)
+            v = v * 1103515245 + 12345;
+        y[i] = v ^ (v >> 16);
+    }
+}
+
+static uint32_t cycles(void)
+{
+    uintptr_t perf = ARCHI_PERF_MON_ADDR;
+    writew(PERF_MON_CTRL_ENABLE | PERF_MON_CTRL_SNAPSHOT,
+           perf + PERF_MON_CTRL_OFFSET);
+    return readw(perf + PERF_MON_CYCLES_OFFSET);
+}
+
+void split_worker(unsigned int hart)
+{
+    uintptr_t split = ARCHI_SPLIT_CTRL_ADDR;
+
+    hart_ids[hart] = csr_read(CSR_MHARTID);
+
+    if (hart == 0) {
+        writew((1 << 1) | (1 << 2), split + SPLIT_CTRL_IRQ_OFFSET);
+    } else {
+        while (!(readw(split + SPLIT_CTRL_IRQ_OFFSET) & (1 << hart)))
+            ;
+        writew(1 << hart, split + SPLIT_CTRL_IRQ_CLR_OFFSET);
+    }
+
+    kernel(y_split, hart * CHUNK, (hart + 1) * CHUNK);
+    done[hart] = 1;
+    if (hart != 0)
+        return;
+
+    while (!done[1] || !done[2])
+        ;
+    writew((uint32_t)split_resume, split + SPLIT_CTRL_BOOT_ADDR_OFFSET(0));
+    writew(0, split + SPLIT_CTRL_MODE_OFFSET);
+    while (1)
+        ;
+}
+
+int main(void)
+{
+    unsigned int errors = 0;
+    uintptr_t split = ARCHI_SPLIT_CTRL_ADDR;
+
+    for (int i = 0; i < NUM_WORDS; i++)
+        x[i] = i * 2654435761u;
+
+    writew(PERF_MON_CTRL_CLEAR, ARCHI_PERF_MON_ADDR + PERF_MON_CTRL_OFFSET);
+
+    uint32_t start = cycles();
+    kernel(y_tcls, 0, NUM_WORDS);
+    uint32_t tcls_cycles = cycles() - start;
+
+    split_hartid_base = csr_read(CSR_MHARTID);
+    for (int h = 0; h < SPLIT_NUM_HARTS; h++) {
+        done[h] = 0;
+        hart_ids[h] = 0;
+        writew((uint32_t)split_entry, split + SPLIT_CTRL_BOOT_ADDR_OFFSET(h));
+    }
+
+    start = cycles();
+    split_enter();
+    uint32_t split_cycles = cycles() - start;
+
+    if (readw(split + SPLIT_CTRL_MODE_OFFSET) & SPLIT_CTRL_MODE_SPLIT) {
+        printf("Not back in TCLS mode\r\n");
+        errors++;
+    }
+
+    for (int h = 0; h < SPLIT_NUM_HARTS; h++) {
+        if (hart_ids[h] != split_hartid_base + h) {
+            printf("Hart %d: hart ID %d\r\n", h, hart_ids[h]);
+            errors++;
+        }
+    }
+
+    for (int i = 0; i < NUM_WORDS; i++) {
+        if (y_split[i] != y_tcls[i]) {
+            printf("Word %d: %x, expected %x\r\n", i, y_split[i], y_tcls[i]);
+            errors++;
+            break;
+        }
+    }
+
+    printf("TCLS: %d cycles, split: %d cycles, speed-up %d/100\r\n",
+           tcls_cycles, split_cycles, 100 * tcls_cycles / split_cycles);
+
+    return errors;
+}
@@ -0,0 +1,19 @@
+# Flips one bit of s11 (x27) in the register file of core 1 while the
+# resynchronization test spins on it. The HMR unit detects the mismatch on the
+# next store of s11 and requests a resynchronization.
+
+echo "TCLS fault injection enabled\n"
+
+set rf /tb_safety_island_preloaded/fixt_safety_island/i_dut/i_safety_island_top/i_core_wrap/gen_TCLS_core/gen_cores(1)/i_cv32e40p/core_i/id_stage_i/register_file_i
+
+when {$now == 400000ns} {
+  set bit [expr int(floor(rand()*32))]
+  echo "Flipping bit $bit of x27 in core 1"
+  set current_value [examine $rf/mem(27)($bit)]
+  if {$current_value == "1'h0"} {
+    force -deposit $rf/mem(27)($bit) 1
+  }
+  if {$current_value == "1'h1"} {
+    force -deposit $rf/mem(27)($bit) 0
+  }
+}
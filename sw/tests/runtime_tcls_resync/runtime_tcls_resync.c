@@ -0,0 +1,105 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: TCLS resynchronization through the resynchronization assist.
+ *
+ * The test keeps a known value in s11 and stores it repeatedly. The fault
+ * injection script flips a bit of s11 in one of the cores, the HMR unit
+ * detects the mismatch and raises the resynchronization interrupt. The handler
+ * in handler.S restores the voted state and the test checks that s11 holds the
+ * known value again in all cores. Needs TCLS and INJECT_FAULT.
+ */
+
+#include "pulp.h"
+#include <stdint.h>
+#include <stdio.h>
+
+#include "csr.h"
+#include "io.h"
+#include "clic.h"
+#include "clicint.h"
+#include "tcls_resync.h"
+
+#define GOLDEN 0x5afe15a5
+
+#ifndef NUM_ITER
+#define NUM_ITER 4000
+#endif
+
+void clic_setup_mtvec(void);
+void clic_setup_mtvt(void);
+
+volatile uint32_t sink;
+
+int main(void)
+{
+    unsigned int errors = 0;
+    uintptr_t resync = ARCHI_TCLS_RESYNC_ADDR;
+    uintptr_t clicint = csr_read(CSR_MCLICBASE) +
+                        CLICINT_CLICINT_REG_OFFSET(TCLS_RESYNC_IRQ);
+
+    clic_setup_mtvec();
+    clic_setup_mtvt();
+
+    /* Vectored, edge-triggered, enabled */
+    writew((0x1 << CLICINT_CLICINT_ATTR_SHV_BIT) |
+               (0x1 << CLICINT_CLICINT_ATTR_TRIG_OFFSET) |
+               (0xaa << CLICINT_CLICINT_CTL_OFFSET) |
+               (0x1 << CLICINT_CLICINT_IE_BIT),
+           clicint);
+    writew((0x4 << MCLIC_MCLICCFG_MNLBITS_OFFSET),
+           csr_read(CSR_MCLICBASE) + MCLIC_MCLICCFG_REG_OFFSET);
+    csr_write(CSR_MINTTHRESH, 0);
+
+    writew(0, resync + TCLS_RESYNC_MAX_CYCLES_OFFSET);
+
+    /* A faulty s11 reaches the voters on the next store */
+    register uint32_t golden asm("s11") = GOLDEN;
+    for (int i = 0; i < NUM_ITER; i++) {
+        asm volatile("sw %1, 0(%0)" : : "r"(&sink), "r"(golden) : "memory");
+    }
+    asm volatile("" : "+r"(golden));
+
+    if (golden != GOLDEN) {
+        printf("s11 not restored: %x\r\n", golden);
+        errors++;
+    }
+
+    uint32_t count = readw(resync + TCLS_RESYNC_COUNT_OFFSET);
+    if (count == 0) {
+        printf("No resynchronization\r\n");
+        errors++;
+    }
+    if (readw(resync + TCLS_RESYNC_STATUS_OFFSET) & TCLS_RESYNC_STATUS_PENDING) {
+        printf("Resynchronization still pending\r\n");
+        errors++;
+    }
+
+    /* No fault was injected into the state buffer */
+    if (readw(resync + TCLS_RESYNC_CORRECTED_OFFSET) != 0) {
+        printf("Corrected state buffer errors: %d\r\n",
+               readw(resync + TCLS_RESYNC_CORRECTED_OFFSET));
+        errors++;
+    }
+
+    printf("Resynchronizations: %d, last %d cycles, max %d cycles\r\n", count,
+           readw(resync + TCLS_RESYNC_LAST_CYCLES_OFFSET),
+           readw(resync + TCLS_RESYNC_MAX_CYCLES_OFFSET));
+
+    return errors;
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Input capture of timer 0 on hardware event edges.
+ *
+ * The testbench loops the host interrupt lines back to the timer event
+ * inputs, so toggling host interrupt 0 makes edges on event 0. The lo channel
+ * captures both edges of NUM_EDGES toggles; each capture has to lie between
+ * the counter values read before and after the toggle, and CAP_PREV has to
+ * hold the capture before. Needs UseRegTimer and tb_safety_island_preloaded
+ * without HOST_IRQS.
+ */
+
+#include "pulp.h"
+#include <stdint.h>
+#include <stdio.h>
+
+#include "io.h"
+#include "timer.h"
+
+#define NUM_EDGES       8
+#define CAPTURE_TIMEOUT 1000
+
+int main(void)
+{
+    unsigned int errors = 0;
+    uintptr_t timer = SAFED_TIMER_ADDR(0);
+    uintptr_t soc_ctrl = ARCHI_SOC_CTRL_ADDR;
+    uint32_t before, after, cap, prev = 0, count;
+
+    writew(TIMER_CFG_RESET, timer + TIMER_CFG_LO_OFFSET);
+    writew(TIMER_CAP_RISE | TIMER_CAP_FALL | TIMER_CAP_SRC(0),
+           timer + TIMER_CAP_CFG_LO_OFFSET);
+    writew(0, timer + TIMER_CAP_COUNT_LO_OFFSET);
+    writew(TIMER_CFG_ENABLE, timer + TIMER_CFG_LO_OFFSET);
+
+    for (int i = 0; i < NUM_EDGES; i++) {
+        int timeout = CAPTURE_TIMEOUT;
+
+        before = readw(timer + TIMER_CNT_LO_OFFSET);
+        writew(0x1, soc_ctrl + (i % 2 ? SAFETY_SOC_CTRL_HOSTIRQ_CLR_REG_OFFSET
+                                      : SAFETY_SOC_CTRL_HOSTIRQ_SET_REG_OFFSET));
+        while ((count = readw(timer + TIMER_CAP_COUNT_LO_OFFSET)) == i &&
+               --timeout)
+            ;
+        after = readw(timer + TIMER_CNT_LO_OFFSET);
+
+        if (!timeout || count != i + 1) {
+            printf("Edge %d: %d captures\r\n", i, count);
+            errors++;
+            break;
+        }
+
+        cap = readw(timer + TIMER_CAP_LO_OFFSET);
+        if (cap < before || cap > after) {
+            printf("Edge %d: captured %d outside %d-%d\r\n", i, cap, before,
+                   after);
+            errors++;
+        }
+        if (i > 0 && readw(timer + TIMER_CAP_PREV_LO_OFFSET) != prev) {
+            printf("Edge %d: previous capture %d, expected %d\r\n", i,
+                   readw(timer + TIMER_CAP_PREV_LO_OFFSET), prev);
+            errors++;
+        }
+        printf("Edge %d at %d, %d cycles after the toggle\r\n", i, cap,
+               cap - before);
+        prev = cap;
+    }
+
+    /* Edges of another event input are not captured */
+    writew(TIMER_CAP_RISE | TIMER_CAP_FALL | TIMER_CAP_SRC(1),
+           timer + TIMER_CAP_CFG_LO_OFFSET);
+    writew(0, timer + TIMER_CAP_COUNT_LO_OFFSET);
+    writew(0x1, soc_ctrl + SAFETY_SOC_CTRL_HOSTIRQ_SET_REG_OFFSET);
+    writew(0x1, soc_ctrl + SAFETY_SOC_CTRL_HOSTIRQ_CLR_REG_OFFSET);
+    for (volatile int i = 0; i < 100; i++)
+        ;
+    if ((count = readw(timer + TIMER_CAP_COUNT_LO_OFFSET)) != 0) {
+        printf("%d captures on an unused source\r\n", count);
+        errors++;
+    }
+
+    writew(0, timer + TIMER_CAP_CFG_LO_OFFSET);
+    writew(0, timer + TIMER_CFG_LO_OFFSET);
+
+    printf("Errors: %d\r\n", errors);
+
+    return errors;
+}
@@ -16,12 +16,79 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+/* Description: Free-running timer, then concurrent periods on the low and
+ * high counters of all SAFED_NUM_TIMERS timers. The compare interrupts are
+ * polled on their (edge-triggered, not enabled) CLIC lines and counted per
+ * period.
+ */
+
 #include "pulp.h"
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 
+#include "csr.h"
+#include "io.h"
+#include "clicint.h"
+#include "timer.h"
+
+#define NUM_PERIODS  (2 * SAFED_NUM_TIMERS)
+#define PERIOD(i)    (1000 + 300 * (i))
+#define BASE_EVENTS  8
+
+static uintptr_t period_timer(int i) { return SAFED_TIMER_ADDR(i / 2); }
+
+static int period_irq(int i) {
+    return i % 2 ? SAFED_TIMER_IRQ_HI(i / 2) : SAFED_TIMER_IRQ_LO(i / 2);
+}
+
+static unsigned int concurrent_periods(void) {
+    uintptr_t mclicbase = csr_read(CSR_MCLICBASE);
+    unsigned int events[NUM_PERIODS] = {0};
+    unsigned int errors = 0;
+
+    for (int i = 0; i < NUM_PERIODS; i++) {
+        uintptr_t clicint =
+            mclicbase + CLICINT_CLICINT_REG_OFFSET(period_irq(i));
+        writew(0x1 << CLICINT_CLICINT_ATTR_TRIG_OFFSET, clicint);
+        writew(PERIOD(i), period_timer(i) + (i % 2 ? TIMER_CMP_HI_OFFSET
+                                                   : TIMER_CMP_LO_OFFSET));
+    }
+    for (int i = 0; i < NUM_PERIODS; i++)
+        writew(TIMER_CFG_ENABLE | TIMER_CFG_RESET | TIMER_CFG_IRQ_EN |
+                   TIMER_CFG_CMP_CLR,
+               period_timer(i) + (i % 2 ? TIMER_CFG_HI_OFFSET
+                                        : TIMER_CFG_LO_OFFSET));
+
+    while (events[0] < BASE_EVENTS) {
+        for (int i = 0; i < NUM_PERIODS; i++) {
+            uintptr_t clicint =
+                mclicbase + CLICINT_CLICINT_REG_OFFSET(period_irq(i));
+            if (readw(clicint) & (1 << CLICINT_CLICINT_IP_BIT)) {
+                writew(0x1 << CLICINT_CLICINT_ATTR_TRIG_OFFSET, clicint);
+                events[i]++;
+            }
+        }
+    }
+
+    for (int i = 0; i < NUM_PERIODS; i++)
+        writew(0, period_timer(i) + (i % 2 ? TIMER_CFG_HI_OFFSET
+                                           : TIMER_CFG_LO_OFFSET));
+
+    for (int i = 0; i < NUM_PERIODS; i++) {
+        unsigned int expected = BASE_EVENTS * PERIOD(0) / PERIOD(i);
+        printf("Timer %d %s: %d events of %d cycles\r\n", i / 2,
+               i % 2 ? "hi" : "lo", events[i], PERIOD(i));
+        if (events[i] + 1 < expected || events[i] > expected + 1)
+            errors++;
+    }
+
+    return errors;
+}
+
 int main(void) {
+    unsigned int errors;
+
     volatile int unsigned timer_addr = timer_base_fc(0, 1);
     printf("Timer addr: %x\n\r", timer_addr);
 
@@ -40,5 +107,8 @@ int main(void) {
     volatile int time = timer_count_get(timer_addr);
     printf("Free-running timer value: %d\r\n", time);
 
-    return 0;
+    errors = concurrent_periods();
+    printf("Errors: %d\r\n", errors);
+
+    return errors;
 }
@@ -0,0 +1,124 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Cycles per 64-bit timestamp of timer 0.
+ *
+ * The timer counts in 64-bit mode from just below the carry into the hi
+ * counter, and NUM_STAMPS timestamps are taken with the hi/lo/hi retry loop
+ * and, with USE_REG_TIMER, with the snapshot registers. The timestamps have to
+ * increase across the carry; the cycles per timestamp are reported.
+ */
+
+#include "pulp.h"
+#include <stdint.h>
+#include <stdio.h>
+
+#include "csr.h"
+#include "io.h"
+#include "timer.h"
+
+#define NUM_STAMPS 64
+/* The carry into the hi counter happens while the timestamps are taken */
+#define CNT_PRESET (0xFFFFFFFF - 4 * NUM_STAMPS)
+
+#ifndef USE_REG_TIMER
+#define USE_REG_TIMER 0
+#endif
+
+static inline uint64_t stamp_retry(uintptr_t base)
+{
+    uint32_t hi, lo;
+    do {
+        hi = readw(base + TIMER_CNT_HI_OFFSET);
+        lo = readw(base + TIMER_CNT_LO_OFFSET);
+    } while (hi != readw(base + TIMER_CNT_HI_OFFSET));
+    return ((uint64_t)hi << 32) | lo;
+}
+
+static inline uint64_t stamp_snapshot(uintptr_t base)
+{
+    uint32_t lo = readw(base + TIMER_SNAP_LO_OFFSET);
+    return ((uint64_t)readw(base + TIMER_SNAP_HI_OFFSET) << 32) | lo;
+}
+
+static void timer_preset(uintptr_t base)
+{
+    writew(0, base + TIMER_CFG_LO_OFFSET);
+    writew(CNT_PRESET, base + TIMER_CNT_LO_OFFSET);
+    writew(0, base + TIMER_CNT_HI_OFFSET);
+    writew(TIMER_CFG_ENABLE | TIMER_CFG_64BIT, base + TIMER_CFG_LO_OFFSET);
+}
+
+static unsigned int check(const char *name, uint64_t *stamps,
+                          unsigned int cycles)
+{
+    unsigned int errors = 0;
+
+    for (int i = 1; i < NUM_STAMPS; i++) {
+        if (stamps[i] <= stamps[i - 1]) {
+            printf("%s: timestamp %d not increasing\r\n", name, i);
+            errors++;
+        }
+    }
+    if ((stamps[NUM_STAMPS - 1] >> 32) != 1) {
+        printf("%s: no carry into the hi counter\r\n", name);
+        errors++;
+    }
+    printf("%s: %d cycles per timestamp\r\n", name, cycles);
+
+    return errors;
+}
+
+#define MEASURE(stamp, stamps, cycles)                                         \
+    do {                                                                       \
+        timer_preset(base);                                                    \
+        unsigned int start = csr_read(CSR_MCYCLE);                             \
+        for (int i = 0; i < NUM_STAMPS; i++)                                   \
+            (stamps)[i] = stamp(base);                                         \
+        (cycles) = (csr_read(CSR_MCYCLE) - start) / NUM_STAMPS;                \
+    } while (0)
+
+int main(void)
+{
+    uintptr_t base = SAFED_TIMER_ADDR(0);
+    uint64_t stamps[NUM_STAMPS];
+    unsigned int errors = 0;
+    unsigned int retry, snapshot;
+
+    csr_write(CSR_MCOUNTINHIBIT, 0);
+
+    MEASURE(stamp_retry, stamps, retry);
+    errors += check("hi/lo/hi", stamps, retry);
+
+    if (USE_REG_TIMER) {
+        MEASURE(stamp_snapshot, stamps, snapshot);
+        errors += check("Snapshot", stamps, snapshot);
+        printf("Snapshot saves %d cycles per timestamp\r\n",
+               snapshot < retry ? retry - snapshot : 0);
+        if (snapshot >= retry) {
+            printf("Snapshot not faster than the retry loop\r\n");
+            errors++;
+        }
+    }
+
+    writew(0, base + TIMER_CFG_LO_OFFSET);
+
+    printf("Errors: %d\r\n", errors);
+
+    return errors;
+}
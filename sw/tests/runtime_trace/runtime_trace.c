@@ -0,0 +1,103 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Branch trace of a small function into island SRAM.
+ *
+ * The trace starts at the first fetch of traced() and is stopped by software
+ * after it returns. The test checks the start and stop packets and that the
+ * loop in traced() produced a branch packet per iteration, and prints the
+ * buffer for sw/trace_decoder:
+ *   grep '^trace:' <log> | cut -d' ' -f2 > trace.hex
+ *   sw/trace_decoder/trace_decoder -x trace.hex runtime_trace
+ */
+
+#include "pulp.h"
+#include <stdint.h>
+#include <stdio.h>
+
+#include "io.h"
+#include "trace.h"
+
+#define BUF_WORDS  128
+#define ITERATIONS 8
+
+static uint32_t trace_buf[BUF_WORDS] __attribute__((aligned(8)));
+
+volatile uint32_t sink;
+
+__attribute__((noinline, aligned(4))) uint32_t traced(uint32_t n)
+{
+    uint32_t acc = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        acc = acc * 3 + i;
+        sink = acc;
+    }
+    return acc;
+}
+
+int main(void)
+{
+    unsigned int errors = 0;
+    uint32_t words, hdr, status, branches = 0;
+
+    trace_start(trace_buf, sizeof(trace_buf), (uintptr_t)traced, 0, 0);
+    traced(ITERATIONS);
+    words = trace_stop();
+
+    status = trace_read(TRACE_STATUS_OFFSET);
+    if (status & (TRACE_STATUS_DROPPED | TRACE_STATUS_ERROR | TRACE_STATUS_FULL)) {
+        printf("Unexpected status %08x, %d dropped\r\n", status,
+               trace_read(TRACE_DROPPED_OFFSET));
+        errors++;
+    }
+
+    if (words < 2 * TRACE_PKT_WORDS) {
+        printf("Only %d words traced\r\n", words);
+        return errors + 1;
+    }
+
+    hdr = trace_buf[0];
+    if (TRACE_PKT_TYPE(hdr) != TRACE_PKT_START ||
+        trace_buf[1] != ((uintptr_t)traced & ~0x3)) {
+        printf("Bad start packet %08x %08x\r\n", hdr, trace_buf[1]);
+        errors++;
+    }
+
+    hdr = trace_buf[words - TRACE_PKT_WORDS];
+    if (TRACE_PKT_TYPE(hdr) != TRACE_PKT_STOP) {
+        printf("Bad stop packet %08x\r\n", hdr);
+        errors++;
+    }
+
+    for (uint32_t w = 0; w < words; w += TRACE_PKT_WORDS)
+        if (TRACE_PKT_TYPE(trace_buf[w]) == TRACE_PKT_BRANCH)
+            branches++;
+    /* Each iteration but the last takes the loop branch, plus the return */
+    if (branches < ITERATIONS) {
+        printf("Only %d branch packets\r\n", branches);
+        errors++;
+    }
+
+    printf("%d words, %d branch packets\r\n", words, branches);
+    for (uint32_t w = 0; w < words; w++)
+        printf("trace: %08x\r\n", trace_buf[w]);
+
+    printf("Errors: %d\r\n", errors);
+
+    return errors;
+}
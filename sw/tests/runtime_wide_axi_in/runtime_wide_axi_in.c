@@ -0,0 +1,97 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Wide AXI input path into the memory banks.
+ *
+ * The testbench first measures the host-to-SRAM bandwidth (+AXI_BANDWIDTH,
+ * printed as bytes/cycle) and then preloads this binary through the AXI
+ * input, so its initialized data also checks the interleaving of the wide
+ * path across sub-banks. While the testbench streams AXI input traffic
+ * (+AXI_TRAFFIC), the core runs LR/SC increments, which must neither fail
+ * forever nor lose updates. With SAFED_WIDE_AXI_IN=1 the reported write and
+ * read bandwidth approach the full AXI data width per cycle.
+ */
+
+#include "pulp.h"
+#include <stdint.h>
+#include <stdio.h>
+
+#define TABLE_WORDS 512
+#define NUM_INCR    256
+
+static inline uint32_t lr_w(volatile uint32_t *addr) {
+    uint32_t data;
+    asm volatile("lr.w %[data], (%[addr])"
+                 : [ data ] "=r"(data)
+                 : [ addr ] "r"(addr)
+                 : "memory");
+    return data;
+}
+
+static inline uint32_t sc_w(volatile uint32_t *addr, uint32_t data) {
+    uint32_t err;
+    asm volatile("sc.w %[err], %[data], (%[addr])"
+                 : [ err ] "=r"(err)
+                 : [ addr ] "r"(addr), [ data ] "r"(data)
+                 : "memory");
+    return err;
+}
+
+#define T(i) (0x5a5a0000u ^ ((i) * 0x9e3779b1u))
+#define T4(i) T(i), T(i + 1), T(i + 2), T(i + 3)
+#define T16(i) T4(i), T4(i + 4), T4(i + 8), T4(i + 12)
+#define T64(i) T16(i), T16(i + 16), T16(i + 32), T16(i + 48)
+
+// Initialized data, written by the testbench through the AXI input
+static const uint32_t table[TABLE_WORDS] = {
+    T64(0),   T64(64),  T64(128), T64(192),
+    T64(256), T64(320), T64(384), T64(448),
+};
+
+static volatile uint32_t counter;
+
+int main(void) {
+    unsigned int errors = 0;
+    unsigned int retries = 0;
+
+    for (int i = 0; i < TABLE_WORDS; i++) {
+        if (table[i] != T(i))
+            errors++;
+    }
+    if (errors)
+        printf("Preloaded data mismatch: %d words\r\n", errors);
+
+    counter = 0;
+    for (int i = 0; i < NUM_INCR; i++) {
+        uint32_t val;
+        do {
+            val = lr_w(&counter);
+            retries++;
+        } while (sc_w(&counter, val + 1));
+        retries--;
+    }
+    if (counter != NUM_INCR) {
+        printf("LR/SC counter: %d, expected %d\r\n", counter, NUM_INCR);
+        errors++;
+    }
+
+    printf("SC retries: %d\r\n", retries);
+    printf("Errors: %d\r\n", errors);
+
+    return errors;
+}
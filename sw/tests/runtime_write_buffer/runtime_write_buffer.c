@@ -0,0 +1,89 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Sequential stores to the AXI output through the posted-write
+ * buffer.
+ *
+ * Times a block of sequential word stores to external memory and checks that
+ * loads following the stores (to the same and to neighbouring words) return
+ * the stored values. With SAFED_USE_WRITE_BUFFER=1, the stores are
+ * acknowledged immediately and merged into bursts, so the cycles per store no
+ * longer scale with the external latency. A fence then waits until the
+ * buffered stores have landed in external memory. The test also passes
+ * without the buffer.
+ */
+
+#include "pulp.h"
+#include <stdint.h>
+#include <stdio.h>
+
+#include "csr.h"
+#include "write_buffer.h"
+
+#define EXT_BASE  0x20000000
+#define NUM_WORDS 256
+
+int main(void) {
+    volatile uint32_t *ext = (volatile uint32_t *)EXT_BASE;
+    unsigned int errors = 0;
+    unsigned int start, store_cycles, fence_cycles, rmw_cycles;
+
+    csr_write(CSR_MCOUNTINHIBIT, 0);
+
+    // Sequential stores, merged into bursts by the buffer
+    start = csr_read(CSR_MCYCLE);
+    for (int i = 0; i < NUM_WORDS; i++)
+        ext[i] = 0xcafe0000 | i;
+    store_cycles = csr_read(CSR_MCYCLE) - start;
+
+    // Wait until the stores have been written to external memory
+    start = csr_read(CSR_MCYCLE);
+    write_buffer_fence(&ext[NUM_WORDS - 1]);
+    fence_cycles = csr_read(CSR_MCYCLE) - start;
+
+    // Loads must observe all buffered stores
+    for (int i = 0; i < NUM_WORDS; i++) {
+        if (ext[i] != (0xcafe0000 | i))
+            errors++;
+    }
+
+    // Read-after-write to the same word, while the word is still buffered
+    start = csr_read(CSR_MCYCLE);
+    for (int i = 0; i < NUM_WORDS; i++) {
+        ext[i] = i;
+        if (ext[i] != i)
+            errors++;
+    }
+    rmw_cycles = csr_read(CSR_MCYCLE) - start;
+
+    // Loads of the previous word while the following one is buffered
+    ext[0] = ~0u;
+    for (int i = 1; i < NUM_WORDS; i++) {
+        ext[i] = ~i;
+        if (ext[i - 1] != ~(i - 1))
+            errors++;
+    }
+
+    printf("Stores: %d cycles for %d words\r\n", store_cycles, NUM_WORDS);
+    printf("Fence: %d cycles\r\n", fence_cycles);
+    printf("Store-load pairs: %d cycles for %d words\r\n", rmw_cycles,
+           NUM_WORDS);
+    printf("Errors: %d\r\n", errors);
+
+    return errors;
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Crossbar interference benchmark.
+ *
+ * While the testbench streams AXI input traffic into the memory banks
+ * (+AXI_TRAFFIC), the core runs the same load/store kernel twice: first with
+ * the QoS stage disabled, then with the core's instruction and data managers
+ * at the highest priority and the AXI input at the lowest priority with a
+ * grant budget. For each run, the worst-case cycles from a core fetch or data
+ * request to its grant are printed, together with the cycles the AXI input
+ * was held back.
+ */
+
+#include "pulp.h"
+#include <stdint.h>
+#include <stdio.h>
+
+#include "perf_mon.h"
+#include "xbar_qos.h"
+
+#define NUM_WORDS  256
+#define NUM_ROUNDS 16
+
+// Grants of the AXI input per 256-cycle window with QoS enabled
+#define AXI_INPUT_BUDGET 32
+
+static volatile uint32_t buf[NUM_WORDS];
+
+static inline uint32_t xbar_qos_read(uint32_t offset) {
+    return pulp_read32(ARCHI_XBAR_QOS_ADDR + offset);
+}
+
+static inline void xbar_qos_write(uint32_t offset, uint32_t value) {
+    pulp_write32(ARCHI_XBAR_QOS_ADDR + offset, value);
+}
+
+static uint32_t kernel(void) {
+    uint32_t sum = 0;
+    for (int r = 0; r < NUM_ROUNDS; r++) {
+        for (int i = 0; i < NUM_WORDS; i++)
+            buf[i] = buf[i] * 3 + r;
+        for (int i = 0; i < NUM_WORDS; i++)
+            sum += buf[i];
+    }
+    return sum;
+}
+
+static void run(const char *name, uint32_t *sum) {
+    static const int mgrs[] = {PERF_MON_MGR_CORE_INSTR, PERF_MON_MGR_CORE_DATA,
+                               PERF_MON_MGR_AXI_INPUT};
+
+    for (int i = 0; i < NUM_WORDS; i++)
+        buf[i] = i;
+    for (int i = 0; i < 3; i++) {
+        xbar_qos_write(XBAR_QOS_MGR_THROTTLED_OFFSET(mgrs[i]), 0);
+        xbar_qos_write(XBAR_QOS_MGR_MAX_WAIT_OFFSET(mgrs[i]), 0);
+    }
+
+    *sum = kernel();
+
+    printf("%s: fetch max wait %d, data max wait %d, AXI input max wait %d, "
+           "AXI input throttled %d cycles\r\n",
+           name,
+           xbar_qos_read(XBAR_QOS_MGR_MAX_WAIT_OFFSET(PERF_MON_MGR_CORE_INSTR)),
+           xbar_qos_read(XBAR_QOS_MGR_MAX_WAIT_OFFSET(PERF_MON_MGR_CORE_DATA)),
+           xbar_qos_read(XBAR_QOS_MGR_MAX_WAIT_OFFSET(PERF_MON_MGR_AXI_INPUT)),
+           xbar_qos_read(
+               XBAR_QOS_MGR_THROTTLED_OFFSET(PERF_MON_MGR_AXI_INPUT)));
+}
+
+int main(void) {
+    unsigned int errors = 0;
+    uint32_t sum_rr, sum_qos;
+
+    xbar_qos_write(XBAR_QOS_CTRL_OFFSET, 0);
+    run("Round robin", &sum_rr);
+
+    xbar_qos_write(XBAR_QOS_WINDOW_OFFSET, 256);
+    xbar_qos_write(XBAR_QOS_MGR_CFG_OFFSET(PERF_MON_MGR_CORE_INSTR),
+                   XBAR_QOS_MGR_CFG(3, 0));
+    xbar_qos_write(XBAR_QOS_MGR_CFG_OFFSET(PERF_MON_MGR_CORE_DATA),
+                   XBAR_QOS_MGR_CFG(3, 0));
+    xbar_qos_write(XBAR_QOS_MGR_CFG_OFFSET(PERF_MON_MGR_AXI_INPUT),
+                   XBAR_QOS_MGR_CFG(0, AXI_INPUT_BUDGET));
+    if (xbar_qos_read(XBAR_QOS_MGR_CFG_OFFSET(PERF_MON_MGR_AXI_INPUT)) !=
+        XBAR_QOS_MGR_CFG(0, AXI_INPUT_BUDGET)) {
+        printf("QoS configuration mismatch\r\n");
+        errors++;
+    }
+    xbar_qos_write(XBAR_QOS_CTRL_OFFSET, XBAR_QOS_CTRL_ENABLE);
+    run("QoS", &sum_qos);
+    xbar_qos_write(XBAR_QOS_CTRL_OFFSET, 0);
+
+    // Arbitration must not change the result
+    if (sum_rr != sum_qos) {
+        printf("Kernel result mismatch: 0x%x vs 0x%x\r\n", sum_rr, sum_qos);
+        errors++;
+    }
+
+    printf("Errors: %d\r\n", errors);
+
+    return errors;
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Description: Execute-in-place from external memory through the instruction
+ * cache.
+ *
+ * A small position-independent kernel is copied to memory behind the AXI
+ * output and timed when run from the local SRAM, from external memory with the
+ * cache disabled and from external memory with the cache enabled. Afterwards,
+ * the external copy is patched and the cache invalidated to check that the
+ * modified code is fetched. Build the hardware with SAFED_USE_ICACHE=1.
+ */
+
+#include "pulp.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "csr.h"
+#include "io.h"
+#include "icache.h"
+
+#define XIP_ADDR   0x20000000
+#define ITERATIONS 256
+
+/* Returns a0 * 3 with a loop body spanning several cache lines. Only relative
+ * branches are used, so the kernel can run from any address. */
+asm(".section .text\n"
+    ".balign 4\n"
+    ".option push\n"
+    ".option norvc\n"
+    ".global xip_kernel_start\n"
+    "xip_kernel_start:\n"
+    "    mv   t0, a0\n"
+    "    li   a0, 0\n"
+    "1:\n"
+    ".global xip_kernel_patch\n"
+    "xip_kernel_patch:\n"
+    "    addi a0, a0, 3\n"
+    "    .rept 15\n"
+    "    addi t1, t1, 1\n"
+    "    .endr\n"
+    "    addi t0, t0, -1\n"
+    "    bnez t0, 1b\n"
+    "    ret\n"
+    ".global xip_kernel_end\n"
+    "xip_kernel_end:\n"
+    ".option pop\n");
+
+extern uint32_t xip_kernel_start[];
+extern uint32_t xip_kernel_patch[];
+extern uint32_t xip_kernel_end[];
+
+typedef unsigned int (*kernel_fn)(unsigned int);
+
+/* addi a0, a0, imm */
+#define ADDI_A0_A0(imm) ((((imm) & 0xfff) << 20) | (10 << 15) | (10 << 7) | 0x13)
+
+static unsigned int run(kernel_fn fn, unsigned int *result)
+{
+    unsigned int start = csr_read(CSR_MCYCLE);
+    *result = fn(ITERATIONS);
+    return csr_read(CSR_MCYCLE) - start;
+}
+
+int main(void)
+{
+    unsigned int errors = 0;
+    unsigned int result;
+    uintptr_t icache = ARCHI_ICACHE_ADDR;
+    size_t size = (uintptr_t)xip_kernel_end - (uintptr_t)xip_kernel_start;
+    uintptr_t patch = (uintptr_t)xip_kernel_patch - (uintptr_t)xip_kernel_start;
+    kernel_fn sram_fn = (kernel_fn)xip_kernel_start;
+    kernel_fn xip_fn = (kernel_fn)XIP_ADDR;
+
+    uint32_t info = readw(icache + ICACHE_INFO_OFFSET);
+    printf("ICache: %d lines of %d bytes, kernel: %d bytes\r\n",
+           ICACHE_INFO_NUM_LINES(info), ICACHE_INFO_LINE_BYTES(info),
+           (int)size);
+
+    memcpy((void *)XIP_ADDR, xip_kernel_start, size);
+    asm volatile("fence.i" ::: "memory");
+    writew(1, icache + ICACHE_INVALIDATE_OFFSET);
+
+    csr_write(CSR_MCOUNTINHIBIT, 0);
+
+    unsigned int sram = run(sram_fn, &result);
+    errors += result != 3 * ITERATIONS;
+
+    writew(0, icache + ICACHE_CTRL_OFFSET);
+    unsigned int uncached = run(xip_fn, &result);
+    errors += result != 3 * ITERATIONS;
+
+    writew(ICACHE_CTRL_ENABLE | ICACHE_CTRL_PREFETCH, icache + ICACHE_CTRL_OFFSET);
+    writew(0, icache + ICACHE_HITS_OFFSET);
+    writew(0, icache + ICACHE_MISSES_OFFSET);
+    unsigned int cached = run(xip_fn, &result);
+    errors += result != 3 * ITERATIONS;
+    unsigned int hits = readw(icache + ICACHE_HITS_OFFSET);
+    unsigned int misses = readw(icache + ICACHE_MISSES_OFFSET);
+
+    printf("SRAM:           %d cycles\r\n", sram);
+    printf("XIP, uncached:  %d cycles (%d.%02dx)\r\n", uncached,
+           uncached / sram, (uncached % sram) * 100 / sram);
+    printf("XIP, cached:    %d cycles (%d.%02dx), %d hits, %d misses\r\n",
+           cached, cached / sram, (cached % sram) * 100 / sram, hits, misses);
+
+    /* Self-modifying code: the cache is only coherent after an invalidate */
+    writew(ADDI_A0_A0(5), XIP_ADDR + patch);
+    asm volatile("fence.i" ::: "memory");
+    writew(1, icache + ICACHE_INVALIDATE_OFFSET);
+    run(xip_fn, &result);
+    if (result != 5 * ITERATIONS) {
+        printf("Patched kernel returned %d instead of %d\r\n", result,
+               5 * ITERATIONS);
+        errors++;
+    }
+
+    printf("Errors: %d\r\n", errors);
+
+    return errors;
+}
@@ -0,0 +1,534 @@
+/*
+ * Copyright 2024 ETH Zurich
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+// Host-side decoder of the branch trace buffer of the safety island (UseTrace).
+//
+// The encoder only sees the fetches of the core: it writes a packet for each fetch that does not
+// follow the previous one, with the word-aligned fetch address and the number of sequential
+// fetches in between. The decoder walks the program from the ELF between two packets and resolves
+// each control-flow instruction against the next packet:
+//   - a conditional branch is taken if its target is in the word of the packet's address,
+//   - jal is always taken and consumes the packet if its target is in that word,
+//   - returns take the address from a shadow call stack, other indirect jumps, mret and traps the
+//     packet's address.
+// As the core prefetches, the sequential fetches only bound the walk. If no instruction resolves
+// the packet within the bound (an interrupt, a trap or a hardware loop), the decoder reports the
+// gap and continues at the packet's address.
+//
+// Usage: trace_decoder [-x] [-s offset] <trace> <elf>
+//   -x         the trace is text, one 32-bit hex word per line (as printed by runtime_trace)
+//   -s offset  byte offset of the oldest packet in the buffer (WRITE_PTR after a wrap)
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace {
+
+enum PacketType { PktBranch = 0, PktIrq = 1, PktStart = 2, PktStop = 3 };
+
+struct Packet {
+  PacketType type;
+  uint32_t seq;
+  uint32_t irq_id;
+  uint32_t cycles;
+  uint32_t addr;
+};
+
+struct Section {
+  uint32_t addr;
+  std::vector<uint8_t> data;
+};
+
+// Executable sections and function symbols of a little-endian ELF32
+class Program {
+ public:
+  bool load(const std::string &path) {
+    std::ifstream f(path, std::ios::binary);
+    if (!f) {
+      fprintf(stderr, "Cannot open %s\n", path.c_str());
+      return false;
+    }
+    std::vector<uint8_t> elf((std::istreambuf_iterator<char>(f)), std::istreambuf_iterator<char>());
+    if (elf.size() < 52 || memcmp(elf.data(), "\x7f" "ELF", 4) != 0 || elf[4] != 1 ||
+        elf[5] != 1) {
+      fprintf(stderr, "%s is not a little-endian ELF32 file\n", path.c_str());
+      return false;
+    }
+
+    uint32_t shoff = rd32(elf, 0x20);
+    uint32_t shentsize = rd16(elf, 0x2E);
+    uint32_t shnum = rd16(elf, 0x30);
+    if (shoff + shnum * shentsize > elf.size()) {
+      fprintf(stderr, "%s: truncated section headers\n", path.c_str());
+      return false;
+    }
+
+    for (uint32_t i = 0; i < shnum; i++) {
+      uint32_t sh = shoff + i * shentsize;
+      uint32_t type = rd32(elf, sh + 0x04);
+      uint32_t flags = rd32(elf, sh + 0x08);
+      uint32_t addr = rd32(elf, sh + 0x0C);
+      uint32_t offset = rd32(elf, sh + 0x10);
+      uint32_t size = rd32(elf, sh + 0x14);
+      uint32_t link = rd32(elf, sh + 0x18);
+      uint32_t entsize = rd32(elf, sh + 0x24);
+
+      // SHT_PROGBITS with SHF_EXECINSTR
+      if (type == 1 && (flags & 0x4) && offset + size <= elf.size()) {
+        Section s;
+        s.addr = addr;
+        s.data.assign(elf.begin() + offset, elf.begin() + offset + size);
+        sections_.push_back(s);
+      }
+
+      // SHT_SYMTAB, names in the linked string table
+      if (type == 2 && entsize >= 16 && link < shnum && offset + size <= elf.size()) {
+        uint32_t strsh = shoff + link * shentsize;
+        uint32_t stroff = rd32(elf, strsh + 0x10);
+        uint32_t strsize = rd32(elf, strsh + 0x14);
+        for (uint32_t sym = offset; sym + 16 <= offset + size; sym += entsize) {
+          uint32_t name = rd32(elf, sym);
+          uint32_t value = rd32(elf, sym + 4);
+          uint32_t symsize = rd32(elf, sym + 8);
+          uint8_t info = elf[sym + 12];
+          // STT_FUNC
+          if ((info & 0xF) == 2 && name < strsize && stroff + name < elf.size()) {
+            Symbol &s = symbols_[value];
+            s.name = std::string(reinterpret_cast<const char *>(&elf[stroff + name]));
+            s.size = symsize;
+          }
+        }
+      }
+    }
+
+    if (sections_.empty()) {
+      fprintf(stderr, "%s: no executable sections\n", path.c_str());
+      return false;
+    }
+    return true;
+  }
+
+  bool contains(uint32_t addr) const { return find(addr, 2) != nullptr; }
+
+  // Instruction at addr, 0 if outside the program
+  uint32_t fetch(uint32_t addr) const {
+    const uint8_t *p = find(addr, 2);
+    if (!p) {
+      return 0;
+    }
+    uint32_t insn = p[0] | (p[1] << 8);
+    if ((insn & 0x3) == 0x3) {
+      const uint8_t *q = find(addr + 2, 2);
+      if (!q) {
+        return 0;
+      }
+      insn |= (q[0] << 16) | (q[1] << 24);
+    }
+    return insn;
+  }
+
+  std::string symbolize(uint32_t addr) const {
+    auto it = symbols_.upper_bound(addr);
+    if (it == symbols_.begin()) {
+      return "";
+    }
+    --it;
+    if (addr - it->first >= it->second.size && it->second.size != 0) {
+      return "";
+    }
+    char buf[32];
+    snprintf(buf, sizeof(buf), "+0x%x", addr - it->first);
+    return "<" + it->second.name + (addr == it->first ? "" : buf) + ">";
+  }
+
+ private:
+  static uint32_t rd16(const std::vector<uint8_t> &b, uint32_t o) {
+    return o + 2 <= b.size() ? b[o] | (b[o + 1] << 8) : 0;
+  }
+
+  static uint32_t rd32(const std::vector<uint8_t> &b, uint32_t o) {
+    return o + 4 <= b.size() ? rd16(b, o) | (rd16(b, o + 2) << 16) : 0;
+  }
+
+  const uint8_t *find(uint32_t addr, uint32_t len) const {
+    for (const Section &s : sections_) {
+      if (addr >= s.addr && addr - s.addr + len <= s.data.size()) {
+        return &s.data[addr - s.addr];
+      }
+    }
+    return nullptr;
+  }
+
+  struct Symbol {
+    std::string name;
+    uint32_t size;
+  };
+
+  std::vector<Section> sections_;
+  std::map<uint32_t, Symbol> symbols_;
+};
+
+// -----------------
+// Instruction decoding
+// -----------------
+
+enum Flow {
+  FlowNone,
+  FlowBranch,    // Conditional branch to target
+  FlowJump,      // jal to target
+  FlowCall,      // jal to target, link in ra
+  FlowIndirect,  // jalr to an unknown target
+  FlowIndCall,   // jalr to an unknown target, link in ra
+  FlowReturn,    // jalr to ra
+  FlowTrap,      // mret, ecall, ebreak: the target is the next packet
+};
+
+struct Insn {
+  uint32_t size;
+  Flow flow;
+  uint32_t target;
+  const char *name;
+};
+
+int32_t sext(uint32_t val, int bits) {
+  uint32_t m = 1u << (bits - 1);
+  return static_cast<int32_t>((val ^ m) - m);
+}
+
+bool is_link(uint32_t reg) { return reg == 1 || reg == 5; }
+
+Insn decode(uint32_t pc, uint32_t insn) {
+  Insn d = {(insn & 0x3) == 0x3 ? 4u : 2u, FlowNone, 0, ""};
+
+  if (d.size == 4) {
+    uint32_t opcode = insn & 0x7F;
+    uint32_t rd = (insn >> 7) & 0x1F;
+    uint32_t rs1 = (insn >> 15) & 0x1F;
+    if (opcode == 0x63) {
+      uint32_t imm = ((insn >> 31) << 12) | (((insn >> 7) & 0x1) << 11) |
+                     (((insn >> 25) & 0x3F) << 5) | (((insn >> 8) & 0xF) << 1);
+      d.flow = FlowBranch;
+      d.target = pc + sext(imm, 13);
+      d.name = "branch";
+    } else if (opcode == 0x6F) {
+      uint32_t imm = ((insn >> 31) << 20) | (((insn >> 12) & 0xFF) << 12) |
+                     (((insn >> 20) & 0x1) << 11) | (((insn >> 21) & 0x3FF) << 1);
+      d.flow = is_link(rd) ? FlowCall : FlowJump;
+      d.target = pc + sext(imm, 21);
+      d.name = is_link(rd) ? "call" : "jump";
+    } else if (opcode == 0x67) {
+      if (rd == 0 && is_link(rs1)) {
+        d.flow = FlowReturn;
+        d.name = "ret";
+      } else {
+        d.flow = is_link(rd) ? FlowIndCall : FlowIndirect;
+        d.name = is_link(rd) ? "call indirect" : "jump indirect";
+      }
+    } else if (opcode == 0x73 && ((insn >> 12) & 0x7) == 0) {
+      uint32_t funct12 = insn >> 20;
+      if (funct12 == 0x302 || funct12 == 0x000 || funct12 == 0x001) {
+        d.flow = FlowTrap;
+        d.name = funct12 == 0x302 ? "mret" : funct12 == 0 ? "ecall" : "ebreak";
+      }
+    }
+    return d;
+  }
+
+  uint32_t op = insn & 0x3;
+  uint32_t funct3 = (insn >> 13) & 0x7;
+  if (op == 0x1 && (funct3 == 0x1 || funct3 == 0x5)) {
+    uint32_t imm = (((insn >> 12) & 0x1) << 11) | (((insn >> 11) & 0x1) << 4) |
+                   (((insn >> 9) & 0x3) << 8) | (((insn >> 8) & 0x1) << 10) |
+                   (((insn >> 7) & 0x1) << 6) | (((insn >> 6) & 0x1) << 7) |
+                   (((insn >> 3) & 0x7) << 1) | (((insn >> 2) & 0x1) << 5);
+    d.flow = funct3 == 0x1 ? FlowCall : FlowJump;
+    d.target = pc + sext(imm, 12);
+    d.name = funct3 == 0x1 ? "c.jal" : "c.j";
+  } else if (op == 0x1 && (funct3 == 0x6 || funct3 == 0x7)) {
+    uint32_t imm = (((insn >> 12) & 0x1) << 8) | (((insn >> 10) & 0x3) << 3) |
+                   (((insn >> 5) & 0x3) << 6) | (((insn >> 3) & 0x3) << 1) |
+                   (((insn >> 2) & 0x1) << 5);
+    d.flow = FlowBranch;
+    d.target = pc + sext(imm, 9);
+    d.name = funct3 == 0x6 ? "c.beqz" : "c.bnez";
+  } else if (op == 0x2 && funct3 == 0x4) {
+    uint32_t rs1 = (insn >> 7) & 0x1F;
+    uint32_t rs2 = (insn >> 2) & 0x1F;
+    bool bit12 = (insn >> 12) & 0x1;
+    if (rs2 == 0 && rs1 != 0) {
+      if (!bit12) {
+        d.flow = is_link(rs1) ? FlowReturn : FlowIndirect;
+        d.name = is_link(rs1) ? "ret" : "c.jr";
+      } else {
+        d.flow = FlowIndCall;
+        d.name = "c.jalr";
+      }
+    } else if (bit12 && rs1 == 0 && rs2 == 0) {
+      d.flow = FlowTrap;
+      d.name = "c.ebreak";
+    }
+  }
+  return d;
+}
+
+// -----------------
+// Trace decoding
+// -----------------
+
+class Decoder {
+ public:
+  explicit Decoder(const Program &prog) : prog_(prog) {}
+
+  void run(const std::vector<Packet> &pkts) {
+    for (const Packet &p : pkts) {
+      cycles_ += p.cycles;
+      switch (p.type) {
+        case PktStart:
+          printf("%10llu  start at 0x%08x %s\n", ull(cycles_), p.addr,
+                 prog_.symbolize(p.addr).c_str());
+          resync(p.addr);
+          break;
+        case PktStop:
+          if (valid_) {
+            walk_to_stop(p);
+          }
+          printf("%10llu  stop at 0x%08x %s\n", ull(cycles_), p.addr,
+                 prog_.symbolize(p.addr).c_str());
+          valid_ = false;
+          break;
+        case PktIrq:
+          // The interrupted instruction is not known, the fetches past it were not executed
+          printf("%10llu  interrupt %u, %u fetches not reconstructed\n", ull(cycles_), p.irq_id,
+                 p.seq);
+          num_irqs_++;
+          resync(p.addr);
+          break;
+        case PktBranch:
+          if (!valid_) {
+            resync(p.addr);
+          } else {
+            walk(p);
+          }
+          break;
+      }
+    }
+    printf("%llu instructions, %llu packets, %llu interrupts, %llu gaps\n", ull(num_insns_),
+           ull(pkts.size()), ull(num_irqs_), ull(num_gaps_));
+  }
+
+ private:
+  static unsigned long long ull(uint64_t v) { return static_cast<unsigned long long>(v); }
+
+  void resync(uint32_t addr) {
+    pc_ = addr;
+    valid_ = prog_.contains(addr);
+  }
+
+  void print(uint32_t pc, uint32_t insn, const Insn &d, const char *note) {
+    char enc[9];
+    snprintf(enc, sizeof(enc), "%0*x", d.size == 4 ? 8 : 4, insn);
+    printf("%10llu  0x%08x  %-8s  %-14s %-9s %s\n", ull(cycles_), pc, enc, d.name, note,
+           prog_.symbolize(pc).c_str());
+    num_insns_++;
+  }
+
+  // Upper bound of the bytes executed before the discontinuity of a packet
+  static uint32_t budget(const Packet &p) { return p.seq == 0x3F ? 1u << 24 : (p.seq + 2) * 4; }
+
+  // Execute from pc until an instruction takes the discontinuity of the packet
+  void walk(const Packet &p) {
+    uint32_t target = p.addr & ~0x3u;
+    uint32_t walked = 0;
+    while (walked < budget(p)) {
+      uint32_t insn = prog_.fetch(pc_);
+      if (insn == 0) {
+        break;
+      }
+      Insn d = decode(pc_, insn);
+      uint32_t next = pc_ + d.size;
+      walked += d.size;
+
+      switch (d.flow) {
+        case FlowNone:
+          print(pc_, insn, d, "");
+          pc_ = next;
+          continue;
+        case FlowBranch:
+          if ((d.target & ~0x3u) == target) {
+            print(pc_, insn, d, "taken");
+            pc_ = d.target;
+            return;
+          }
+          print(pc_, insn, d, "not taken");
+          pc_ = next;
+          continue;
+        case FlowCall:
+        case FlowJump:
+          print(pc_, insn, d, "");
+          if (d.flow == FlowCall) {
+            stack_.push_back(next);
+          }
+          pc_ = d.target;
+          if ((d.target & ~0x3u) == target) {
+            return;
+          }
+          continue;
+        case FlowReturn:
+          print(pc_, insn, d, "");
+          if (!stack_.empty() && (stack_.back() & ~0x3u) == target) {
+            pc_ = stack_.back();
+          } else {
+            pc_ = p.addr;
+          }
+          if (!stack_.empty()) {
+            stack_.pop_back();
+          }
+          return;
+        case FlowIndCall:
+          stack_.push_back(next);
+          print(pc_, insn, d, "");
+          pc_ = p.addr;
+          return;
+        case FlowIndirect:
+        case FlowTrap:
+          print(pc_, insn, d, "");
+          pc_ = p.addr;
+          return;
+      }
+    }
+    printf("%10llu  gap: no branch to 0x%08x from 0x%08x (trap or hardware loop)\n",
+           ull(cycles_), p.addr, pc_);
+    num_gaps_++;
+    resync(p.addr);
+  }
+
+  // Execute from pc sequentially up to the stop fetch
+  void walk_to_stop(const Packet &p) {
+    uint32_t stop = p.addr & ~0x3u;
+    uint32_t walked = 0;
+    while (walked < budget(p) && (pc_ & ~0x3u) != stop) {
+      uint32_t insn = prog_.fetch(pc_);
+      if (insn == 0) {
+        return;
+      }
+      Insn d = decode(pc_, insn);
+      walked += d.size;
+      if (d.flow == FlowJump || d.flow == FlowCall) {
+        print(pc_, insn, d, "");
+        if (d.flow == FlowCall) {
+          stack_.push_back(pc_ + d.size);
+        }
+        pc_ = d.target;
+      } else if (d.flow == FlowNone || d.flow == FlowBranch) {
+        print(pc_, insn, d, d.flow == FlowBranch ? "not taken" : "");
+        pc_ += d.size;
+      } else {
+        return;
+      }
+    }
+  }
+
+  const Program &prog_;
+  uint32_t pc_ = 0;
+  bool valid_ = false;
+  uint64_t cycles_ = 0;
+  uint64_t num_insns_ = 0;
+  uint64_t num_irqs_ = 0;
+  uint64_t num_gaps_ = 0;
+  std::vector<uint32_t> stack_;
+};
+
+bool read_trace(const std::string &path, bool hex, std::vector<uint32_t> &words) {
+  std::ifstream f(path, hex ? std::ios::in : std::ios::binary);
+  if (!f) {
+    fprintf(stderr, "Cannot open %s\n", path.c_str());
+    return false;
+  }
+  if (hex) {
+    std::string tok;
+    while (f >> tok) {
+      words.push_back(static_cast<uint32_t>(strtoul(tok.c_str(), nullptr, 16)));
+    }
+  } else {
+    uint8_t b[4];
+    while (f.read(reinterpret_cast<char *>(b), 4)) {
+      words.push_back(b[0] | (b[1] << 8) | (b[2] << 16) | (static_cast<uint32_t>(b[3]) << 24));
+    }
+  }
+  return true;
+}
+
+void usage(const char *argv0) {
+  fprintf(stderr, "Usage: %s [-x] [-s offset] <trace> <elf>\n", argv0);
+  fprintf(stderr, "  -x         trace is text, one hex word per line\n");
+  fprintf(stderr, "  -s offset  byte offset of the oldest packet (WRITE_PTR after a wrap)\n");
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  bool hex = false;
+  uint32_t offset = 0;
+  std::vector<std::string> args;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-x")) {
+      hex = true;
+    } else if (!strcmp(argv[i], "-s") && i + 1 < argc) {
+      offset = static_cast<uint32_t>(strtoul(argv[++i], nullptr, 0));
+    } else if (argv[i][0] == '-') {
+      usage(argv[0]);
+      return 1;
+    } else {
+      args.push_back(argv[i]);
+    }
+  }
+  if (args.size() != 2) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  Program prog;
+  std::vector<uint32_t> words;
+  if (!prog.load(args[1]) || !read_trace(args[0], hex, words)) {
+    return 1;
+  }
+
+  // Oldest packet first
+  std::vector<Packet> pkts;
+  size_t first = words.empty() ? 0 : (offset / 4) % words.size();
+  for (size_t w = 0; w + 1 < words.size(); w += 2) {
+    uint32_t hdr = words[(first + w) % words.size()];
+    Packet p;
+    p.type = static_cast<PacketType>(hdr & 0x3);
+    p.seq = (hdr >> 2) & 0x3F;
+    p.irq_id = (hdr >> 8) & 0xFF;
+    p.cycles = hdr >> 16;
+    p.addr = words[(first + w + 1) % words.size()];
+    pkts.push_back(p);
+  }
+
+  Decoder(prog).run(pkts);
+  return 0;
+}